@@ -0,0 +1,149 @@
+/*
+ * Times the per-word work in front of the BPE merges, on English and on
+ * mixed-script text:
+ *
+ *  - splitting a word into its initial symbols, with the UTF-8 boundary
+ *    scan and with the ASCII symbol table that _apply_bpe_single now uses
+ *  - lowercasing, with lower() (std::tolower) and with a "lower"
+ *    TransformPipeline (SIMD on ASCII)
+ *  - convert_to_ids end to end
+ *  - convert_to_ids_stack on a batch of sentences, on 1 thread and up to
+ *    one per core
+ *
+ * Build and run from the repository root:
+ *
+ *   g++ -O3 -std=c++17 -pthread -Iinclude bench/bench_bpe.cpp -o bench_bpe
+ *   ./bench_bpe tests/test_data/vocab.30k tests/test_data/codes.30k
+ */
+#include <chrono>
+#include <random>
+#include "vecxx/vecxx.h"
+
+template<typename F>
+double time_ms(F f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// The split _apply_bpe_single does for words that are not all ASCII
+void split_utf8(const std::string& word, TokenList_T& word_bpes) {
+    word_bpes.clear();
+    int pos = 0;
+    int last_start = 0;
+    while (word[pos]) {
+	bool new_char = (word[pos] & 0xc0) != 0x80;
+	if (new_char && pos > 0) {
+	    word_bpes.push_back(word.substr(last_start, pos - last_start));
+	    last_start = pos;
+	}
+	pos++;
+    }
+    word_bpes.push_back(word.substr(last_start, std::string::npos) + BPE_END_WORD);
+}
+
+void split_ascii(const std::string& word, TokenList_T& word_bpes) {
+    word_bpes.clear();
+    const std::string* symbols = bpe_ascii_symbols();
+    const size_t n = word.size();
+    for (size_t j = 0; j + 1 < n; ++j) {
+	word_bpes.push_back(symbols[(unsigned char)word[j]]);
+    }
+    word_bpes.push_back(symbols[128 + (unsigned char)word[n - 1]]);
+}
+
+TokenList_T make_words(const TokenList_T& pool, size_t n) {
+    std::mt19937 rng(1337);
+    TokenList_T words;
+    for (size_t i = 0; i < n; ++i) {
+	words.push_back(pool[rng() % pool.size()]);
+    }
+    return words;
+}
+
+int main(int argc, char** argv) {
+    std::string vocab_file = argc > 1 ? argv[1] : "tests/test_data/vocab.30k";
+    std::string codes_file = argc > 2 ? argv[2] : "tests/test_data/codes.30k";
+    size_t num_words = argc > 3 ? std::stoul(argv[3]) : 200000;
+
+    TokenList_T english_pool = split("My name is Dan . I am from Ann Arbor , Michigan , in Washtenaw County . "
+				     "The Quick brown fox jumps over the lazy dog while Vectorizers Encode "
+				     "Sentences into Subword Identifiers");
+    TokenList_T mixed_pool = split("Café naïve São Paulo Москва Россия 東京 日本語 Ελλάδα Straße "
+				   "Zürich résumé Kraków İstanbul and the of New York");
+    BPEVocab vocab(vocab_file, codes_file);
+    VocabVectorizer vec(&vocab, TransformPipeline("lower"));
+
+    for (auto& corpus : {std::make_pair("english", english_pool), std::make_pair("mixed", mixed_pool)}) {
+	TokenList_T words = make_words(corpus.second, num_words);
+	size_t ascii = 0;
+	for (auto& w : words) {
+	    ascii += is_ascii(w);
+	}
+	std::cout << corpus.first << ": " << words.size() << " words, "
+		  << (100.0 * ascii / words.size()) << "% ASCII" << std::endl;
+	auto report = [&](const char* name, double ms) {
+	    std::cout << "  " << name << ": " << (ms * 1e6 / words.size()) << " ns/word" << std::endl;
+	};
+
+	TokenList_T word_bpes;
+	size_t symbols = 0;
+	report("split, UTF-8 scan", time_ms([&]() {
+	    for (auto& w : words) {
+		split_utf8(w, word_bpes);
+		symbols += word_bpes.size();
+	    }
+	}));
+	report("split, ASCII table when ASCII", time_ms([&]() {
+	    for (auto& w : words) {
+		if (is_ascii(w)) {
+		    split_ascii(w, word_bpes);
+		}
+		else {
+		    split_utf8(w, word_bpes);
+		}
+		symbols += word_bpes.size();
+	    }
+	}));
+
+	size_t bytes = 0;
+	report("lower, std::tolower", time_ms([&]() {
+	    for (auto& w : words) {
+		bytes += lowercase(w).size();
+	    }
+	}));
+	TransformPipeline lower_pipeline("lower");
+	report("lower, TransformPipeline", time_ms([&]() {
+	    for (auto& w : words) {
+		bytes += lower_pipeline.apply(w).size();
+	    }
+	}));
+
+	report("convert_to_ids", time_ms([&]() {
+	    symbols += std::get<1>(vec.convert_to_ids(words));
+	}));
+	if (symbols == 0 || bytes == 0) {
+	    std::cout << "unexpected empty output" << std::endl;
+	}
+    }
+
+    TokenList_T words = make_words(english_pool, num_words);
+    ListTokenList_T batch;
+    for (size_t i = 0; i + 50 <= words.size(); i += 50) {
+	batch.push_back(TokenList_T(words.begin() + i, words.begin() + i + 50));
+    }
+    std::cout << "convert_to_ids_stack: " << batch.size() << " rows of 50 words" << std::endl;
+    std::unique_ptr<VocabVectorizer> stack_vec(make_vocab_vectorizer(&vocab, TransformPipeline("lower")));
+    for (size_t num_threads = 1; ; num_threads = std::min(2 * num_threads, default_num_threads())) {
+	stack_vec->set_num_threads(num_threads);
+	double ms = time_ms([&]() {
+	    stack_vec->convert_to_ids_stack(batch, 64);
+	});
+	std::cout << "  " << num_threads << " threads: " << ms << " ms" << std::endl;
+	if (num_threads == default_num_threads()) {
+	    break;
+	}
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * Measure how long the event loop stalls while big batches are encoded, as
+ * it would in an HTTP server: encodeTextStack runs on the main thread, and
+ * encodeTextStackAsync on libuv worker threads.  A timer that should fire
+ * every millisecond reports the lag, and the throughput is printed too.
+ *
+ * Build the addon and the TypeScript (npm run build), then run from the
+ * repository root:
+ *
+ *   node bench/bench_event_loop.js tests/test_data/vocab.30k tests/test_data/codes.30k
+ */
+const { monitorEventLoopDelay } = require('perf_hooks');
+const { BPEVocab, VocabVectorizer } = require('../dist');
+
+const SENTENCES = [
+    'My name is Dan . I am from Ann Arbor , Michigan , in Washtenaw County',
+    'The Quick brown fox jumps over the lazy dog while Vectorizers Encode Sentences',
+    'Subword units let the model handle rare words like Washtenaw and Ypsilanti'
+];
+
+async function run(name, numBatches, encode) {
+    const histogram = monitorEventLoopDelay({ resolution: 1 });
+    const ticker = setInterval(() => {}, 1);
+    histogram.enable();
+    const start = process.hrtime.bigint();
+    // Keep a few batches in flight, as concurrent requests would
+    const inFlight = [];
+    for (let i = 0; i < numBatches; ++i) {
+        inFlight.push(encode());
+        if (inFlight.length === 4) {
+            await inFlight.shift();
+        }
+        // Let timers run between batches, as a server would between requests
+        await new Promise((resolve) => setImmediate(resolve));
+    }
+    await Promise.all(inFlight);
+    const elapsed = Number(process.hrtime.bigint() - start) / 1e9;
+    histogram.disable();
+    clearInterval(ticker);
+    const ms = (ns) => (ns / 1e6).toFixed(1).padStart(7);
+    console.log(
+        `  ${name.padEnd(6)} ${(numBatches / elapsed).toFixed(0).padStart(6)} batches/s, event loop lag ` +
+            `p50 ${ms(histogram.percentile(50))} ms, p99 ${ms(histogram.percentile(99))} ms, max ${ms(histogram.max)} ms`
+    );
+}
+
+async function main() {
+    const vocabFile = process.argv[2] ?? 'tests/test_data/vocab.30k';
+    const codesFile = process.argv[3] ?? 'tests/test_data/codes.30k';
+    const batchSize = Number(process.argv[4] ?? 4096);
+    const numBatches = Number(process.argv[5] ?? 50);
+    const vocab = new BPEVocab(vocabFile, codesFile);
+    const vec = new VocabVectorizer(vocab, { transform: 'lower' });
+    const texts = Array.from({ length: batchSize }, (_, i) => SENTENCES[i % SENTENCES.length]);
+
+    console.log(`${numBatches} batches of ${batchSize} sentences`);
+    await run('sync', numBatches, () => Promise.resolve(vec.encodeTextStack(texts, 32)));
+    await run('async', numBatches, () => vec.encodeTextStackAsync(texts, 32));
+}
+
+main();
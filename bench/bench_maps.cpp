@@ -0,0 +1,92 @@
+/*
+ * Compares lookup speed for the vocab map implementations:
+ *
+ *  - std::unordered_map<std::string, Index_T> (what UnorderedMapStrInt used to wrap)
+ *  - UnorderedMapStrInt (FlatHashMap), with std::string and StringView_T keys
+ *  - PerfectHashMapStrInt (compiled, memory-mapped)
+ *
+ * Build and run from the repository root:
+ *
+ *   g++ -O3 -std=c++17 -Iinclude bench/bench_maps.cpp -o bench_maps
+ *   ./bench_maps tests/test_data/vocab.30k
+ */
+#include <chrono>
+#include <random>
+#include "vecxx/vecxx.h"
+
+template<typename F>
+double time_ms(F f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+    std::string vocab_file = argc > 1 ? argv[1] : "tests/test_data/vocab.30k";
+    int rounds = argc > 2 ? std::stoi(argv[2]) : 50;
+    std::string compiled_dir = vocab_file + ".bench.ph";
+
+    TokenList_T keys;
+    std::ifstream f(vocab_file.c_str());
+    if (!f.is_open()) {
+	std::cerr << "No file: " << vocab_file << std::endl;
+	return 1;
+    }
+    std::string line;
+    while (getline(f, line)) {
+	keys.push_back(split(line)[0]);
+    }
+    // Half hits, half misses, in random order
+    TokenList_T queries = keys;
+    for (auto& k : keys) {
+	queries.push_back(k + "#");
+    }
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(1337));
+
+    std::unordered_map<std::string, Index_T> node_map;
+    UnorderedMapStrInt flat_map;
+    for (size_t i = 0; i < keys.size(); ++i) {
+	node_map[keys[i]] = (Index_T)i;
+	flat_map[keys[i]] = (Index_T)i;
+    }
+    compile_str_int(flat_map, compiled_dir);
+    PerfectHashMapStrInt ph_map(compiled_dir);
+
+    size_t n = queries.size() * rounds;
+    size_t hits = 0;
+    auto report = [&](const char* name, double ms) {
+	std::cout << name << ": " << (ms * 1e6 / n) << " ns/lookup (" << hits << " hits)" << std::endl;
+	hits = 0;
+    };
+
+    report("std::unordered_map", time_ms([&]() {
+	for (int r = 0; r < rounds; ++r) {
+	    for (auto& q : queries) {
+		hits += node_map.find(q) != node_map.end();
+	    }
+	}
+    }));
+    report("UnorderedMapStrInt", time_ms([&]() {
+	for (int r = 0; r < rounds; ++r) {
+	    for (auto& q : queries) {
+		hits += std::get<0>(flat_map.find(q));
+	    }
+	}
+    }));
+    report("UnorderedMapStrInt (StringView_T)", time_ms([&]() {
+	for (int r = 0; r < rounds; ++r) {
+	    for (auto& q : queries) {
+		hits += std::get<0>(flat_map.find(StringView_T(q.data(), q.size())));
+	    }
+	}
+    }));
+    report("PerfectHashMapStrInt", time_ms([&]() {
+	for (int r = 0; r < rounds; ++r) {
+	    for (auto& q : queries) {
+		hits += std::get<0>(ph_map.find(q));
+	    }
+	}
+    }));
+    return 0;
+}
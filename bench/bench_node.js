@@ -0,0 +1,52 @@
+/*
+ * Time single calls on short chat messages, where the fixed cost of each call
+ * (crossing into the addon, converting arguments and results) is most of the
+ * work, rather than the BPE itself.
+ *
+ * Build the addon and the TypeScript (npm run build), then run from the
+ * repository root:
+ *
+ *   node bench/bench_node.js tests/test_data/vocab.30k tests/test_data/codes.30k
+ */
+const { BPEVocab, VocabVectorizer } = require('../dist');
+
+const MESSAGES = [
+    'hi there',
+    'Thanks , that works !',
+    'Can you send me the report by Friday ?',
+    'ok',
+    'What time is the meeting in Ann Arbor tomorrow ?'
+];
+
+function timeCalls(name, numCalls, call) {
+    for (let i = 0; i < 1000; ++i) {
+        call(i);
+    }
+    const start = process.hrtime.bigint();
+    for (let i = 0; i < numCalls; ++i) {
+        call(i);
+    }
+    const elapsed = Number(process.hrtime.bigint() - start) / 1e3;
+    console.log(`  ${name.padEnd(16)} ${(elapsed / numCalls).toFixed(2).padStart(8)} us/call`);
+}
+
+function main() {
+    const vocabFile = process.argv[2] ?? 'tests/test_data/vocab.30k';
+    const codesFile = process.argv[3] ?? 'tests/test_data/codes.30k';
+    const numCalls = Number(process.argv[4] ?? 100000);
+    const vocab = new BPEVocab(vocabFile, codesFile);
+    const tokens = MESSAGES.map((m) => m.split(/\s+/));
+
+    for (const [name, transform] of [
+        ['native lower', 'lower'],
+        ['JS toLowerCase', (s) => s.toLowerCase()]
+    ]) {
+        const vec = new VocabVectorizer(vocab, { transform, emitBeginToken: ['<GO>'], emitEndToken: ['<EOS>'] });
+        console.log(`${name}: ${numCalls} calls`);
+        timeCalls('convertToPieces', numCalls, (i) => vec.convertToPieces(tokens[i % tokens.length]));
+        timeCalls('convertToIds', numCalls, (i) => vec.convertToIds(tokens[i % tokens.length]));
+        timeCalls('encodeText', numCalls, (i) => vec.encodeText(MESSAGES[i % MESSAGES.length]));
+    }
+}
+
+main();
@@ -0,0 +1,61 @@
+"""
+Encode the same corpus from 1, 2, 4, ... Python threads and report the
+throughput, to show that the vectorizers release the GIL while they encode.
+
+Each vectorizer is set to num_threads = 1, so all the parallelism comes from
+the Python threads.  With the native "lower" transform throughput should
+grow with the number of threads, up to the number of cores.  With str.lower
+every token takes the GIL again, so it should stay flat.
+
+Build the extension (pip install .), then run from the repository root:
+
+  python bench/bench_threads.py tests/test_data/vocab.30k tests/test_data/codes.30k
+"""
+import os
+import sys
+import time
+from concurrent.futures import ThreadPoolExecutor
+from vecxx import BPEVocab, VocabVectorizer, TransformPipeline
+
+SENTENCES = [
+    "My name is Dan . I am from Ann Arbor , Michigan , in Washtenaw County",
+    "The Quick brown fox jumps over the lazy dog while Vectorizers Encode Sentences",
+    "Subword units let the model handle rare words like Washtenaw and Ypsilanti",
+]
+
+
+def run(vec, texts, num_threads, rows_per_call=64):
+    chunks = [texts[i:i + rows_per_call] for i in range(0, len(texts), rows_per_call)]
+    start = time.perf_counter()
+    with ThreadPoolExecutor(max_workers=num_threads) as pool:
+        for _ in pool.map(lambda chunk: vec.encode_text_stack(chunk, 32), chunks):
+            pass
+    return time.perf_counter() - start
+
+
+def main():
+    vocab_file = sys.argv[1] if len(sys.argv) > 1 else "tests/test_data/vocab.30k"
+    codes_file = sys.argv[2] if len(sys.argv) > 2 else "tests/test_data/codes.30k"
+    num_sentences = int(sys.argv[3]) if len(sys.argv) > 3 else 20000
+    texts = [SENTENCES[i % len(SENTENCES)] for i in range(num_sentences)]
+    vocab = BPEVocab(vocab_file=vocab_file, codes_file=codes_file)
+
+    max_threads = os.cpu_count() or 1
+    for name, transform in [("native lower", TransformPipeline("lower")), ("str.lower", str.lower)]:
+        vec = VocabVectorizer(vocab, transform=transform)
+        vec.num_threads = 1
+        print(f"{name}: {num_sentences} sentences")
+        baseline = None
+        num_threads = 1
+        while True:
+            elapsed = run(vec, texts, num_threads)
+            rate = num_sentences / elapsed
+            baseline = baseline or rate
+            print(f"  {num_threads:3d} threads: {rate:10.0f} sentences/s ({rate / baseline:.2f}x)")
+            if num_threads >= max_threads:
+                break
+            num_threads = min(2 * num_threads, max_threads)
+
+
+if __name__ == "__main__":
+    main()
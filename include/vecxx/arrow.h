@@ -0,0 +1,275 @@
+#ifndef __VECXX_ARROW_H__
+#define __VECXX_ARROW_H__
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include "vecxx/utils.h"
+
+/*
+ * The Arrow C data and stream interfaces, as given in the Arrow
+ * specification, so that columns can be exchanged with pyarrow (or any
+ * other Arrow implementation) without linking to it
+ */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+    void (*release)(struct ArrowArrayStream*);
+    void* private_data;
+};
+
+#endif
+
+inline bool _arrow_is_valid(const ArrowArray& array, int64_t i) {
+    auto validity = (const uint8_t*)array.buffers[0];
+    if (array.null_count == 0 || validity == NULL) {
+	return true;
+    }
+    int64_t j = array.offset + i;
+    return (validity[j >> 3] >> (j & 7)) & 1;
+}
+
+inline bool _arrow_is_format(const ArrowSchema& schema, const char* format) {
+    return std::strcmp(schema.format, format) == 0;
+}
+
+// Rows [begin, end) of a utf8 (Offset_T = int32_t) or large_utf8 array
+template<typename Offset_T>
+void _read_arrow_strings(const ArrowArray& array, int64_t begin, int64_t end, bool keep_nulls, TokenList_T& out) {
+    auto offsets = (const Offset_T*)array.buffers[1] + array.offset;
+    auto data = (const char*)array.buffers[2];
+    for (int64_t i = begin; i < end; ++i) {
+	if (!_arrow_is_valid(array, i)) {
+	    if (keep_nulls) {
+		out.push_back(std::string());
+	    }
+	    continue;
+	}
+	auto n = offsets[i + 1] - offsets[i];
+	out.push_back(n > 0 ? std::string(data + offsets[i], (size_t)n) : std::string());
+    }
+}
+
+inline void _read_arrow_strings(const ArrowSchema& schema, const ArrowArray& array, int64_t begin, int64_t end, bool keep_nulls, TokenList_T& out) {
+    if (_arrow_is_format(schema, "u")) {
+	_read_arrow_strings<int32_t>(array, begin, end, keep_nulls, out);
+    }
+    else if (_arrow_is_format(schema, "U")) {
+	_read_arrow_strings<int64_t>(array, begin, end, keep_nulls, out);
+    }
+    else {
+	throw std::runtime_error(std::string("Expected an Arrow string array, got format ") + schema.format);
+    }
+}
+
+template<typename Offset_T>
+void _read_arrow_token_lists(const ArrowSchema& schema, const ArrowArray& array, ListTokenList_T& out) {
+    auto offsets = (const Offset_T*)array.buffers[1] + array.offset;
+    const ArrowSchema& item_schema = *schema.children[0];
+    const ArrowArray& items = *array.children[0];
+    for (int64_t i = 0; i < array.length; ++i) {
+	out.push_back(TokenList_T());
+	if (_arrow_is_valid(array, i)) {
+	    _read_arrow_strings(item_schema, items, offsets[i], offsets[i + 1], false, out.back());
+	}
+    }
+}
+
+/*!
+ * True for a list<string> column (a row of tokens per sentence), false for
+ * a string column (a sentence per row)
+ */
+inline bool arrow_is_token_lists(const ArrowSchema& schema) {
+    return _arrow_is_format(schema, "+l") || _arrow_is_format(schema, "+L");
+}
+
+/*!
+ * Append the rows of a string or large_string array to texts, with ""
+ * for null rows.  The bytes are copied straight out of the array's buffers
+ */
+inline void read_arrow_strings(const ArrowSchema& schema, const ArrowArray& array, TokenList_T& texts) {
+    _read_arrow_strings(schema, array, 0, array.length, true, texts);
+}
+
+/*!
+ * Append the rows of a list<string> or large_list<string> array to
+ * list_tokens.  Null rows are empty and null tokens are dropped
+ */
+inline void read_arrow_token_lists(const ArrowSchema& schema, const ArrowArray& array, ListTokenList_T& list_tokens) {
+    if (_arrow_is_format(schema, "+l")) {
+	_read_arrow_token_lists<int32_t>(schema, array, list_tokens);
+    }
+    else if (_arrow_is_format(schema, "+L")) {
+	_read_arrow_token_lists<int64_t>(schema, array, list_tokens);
+    }
+    else {
+	throw std::runtime_error(std::string("Expected an Arrow list array, got format ") + schema.format);
+    }
+}
+
+/*!
+ *  Ids for rows of different lengths, laid out as an Arrow list<int32>:
+ *  the ids of row i are values()[offsets()[i]] up to values()[offsets()[i + 1]].
+ *  Copies share the buffers, and so do the arrays exported from them
+ */
+class RaggedIds
+{
+    struct Buffers {
+	VecList_T values;
+	VecList_T offsets;
+    };
+    std::shared_ptr<const Buffers> _buffers;
+
+    struct ExportedArray {
+	std::shared_ptr<const Buffers> buffers;
+	const void* data[2];
+	ArrowArray* children[1];
+	ArrowArray values;
+    };
+
+    static void _release_schema(ArrowSchema* schema) {
+	for (int64_t i = 0; i < schema->n_children; ++i) {
+	    ArrowSchema* child = schema->children[i];
+	    if (child->release != NULL) {
+		child->release(child);
+	    }
+	}
+	delete[] schema->children;
+	delete (ArrowSchema*)schema->private_data;
+	schema->release = NULL;
+    }
+    static void _release_values_schema(ArrowSchema* schema) {
+	schema->release = NULL;
+    }
+    static void _release_array(ArrowArray* array) {
+	for (int64_t i = 0; i < array->n_children; ++i) {
+	    ArrowArray* child = array->children[i];
+	    if (child->release != NULL) {
+		child->release(child);
+	    }
+	}
+	delete (ExportedArray*)array->private_data;
+	array->release = NULL;
+    }
+
+    static void _init_array(ArrowArray* array, int64_t length, ExportedArray* owner) {
+	array->length = length;
+	array->null_count = 0;
+	array->offset = 0;
+	array->n_buffers = 2;
+	array->n_children = 0;
+	array->buffers = owner->data;
+	array->children = NULL;
+	array->dictionary = NULL;
+	array->release = _release_array;
+	array->private_data = owner;
+    }
+
+public:
+    RaggedIds() : RaggedIds(VecList_T(), VecList_T()) {}
+    /*!
+     * Take over values, and the offsets of n rows (n + 1 of them, from 0)
+     */
+    RaggedIds(VecList_T&& values, VecList_T&& offsets) {
+	auto buffers = std::make_shared<Buffers>();
+	buffers->values = std::move(values);
+	buffers->offsets = std::move(offsets);
+	if (buffers->offsets.empty()) {
+	    buffers->offsets.push_back(0);
+	}
+	_buffers = buffers;
+    }
+
+    size_t size() const { return _buffers->offsets.size() - 1; }
+    const VecList_T& values() const { return _buffers->values; }
+    const VecList_T& offsets() const { return _buffers->offsets; }
+
+    /*!
+     * Fill in a schema and an array for a consumer of the C data interface,
+     * which releases them when it is done.  The array shares the buffers, so
+     * nothing is copied
+     */
+    void export_arrow(ArrowSchema* schema, ArrowArray* array) const {
+	auto values_schema = new ArrowSchema();
+	values_schema->format = "i";
+	values_schema->name = "item";
+	values_schema->metadata = NULL;
+	values_schema->flags = ARROW_FLAG_NULLABLE;
+	values_schema->n_children = 0;
+	values_schema->children = NULL;
+	values_schema->dictionary = NULL;
+	values_schema->release = _release_values_schema;
+	values_schema->private_data = NULL;
+
+	schema->format = "+l";
+	schema->name = "";
+	schema->metadata = NULL;
+	schema->flags = ARROW_FLAG_NULLABLE;
+	schema->n_children = 1;
+	schema->children = new ArrowSchema*[1];
+	schema->children[0] = values_schema;
+	schema->dictionary = NULL;
+	schema->release = _release_schema;
+	schema->private_data = values_schema;
+
+	// The values get their own hold on the buffers, since a consumer may
+	// move them out and release the list first
+	auto values_owner = new ExportedArray();
+	values_owner->buffers = _buffers;
+	values_owner->data[0] = NULL;
+	values_owner->data[1] = _buffers->values.data();
+	auto list_owner = new ExportedArray();
+	list_owner->buffers = _buffers;
+	list_owner->data[0] = NULL;
+	list_owner->data[1] = _buffers->offsets.data();
+	_init_array(&list_owner->values, (int64_t)_buffers->values.size(), values_owner);
+	list_owner->children[0] = &list_owner->values;
+
+	_init_array(array, (int64_t)size(), list_owner);
+	array->n_children = 1;
+	array->children = list_owner->children;
+    }
+};
+
+#endif
@@ -31,10 +31,16 @@ std::string pack_pair(const TPS_T& pair) {
     return pack_pair(pair.first, pair.second);
 }
 
+/*
+ * The BPE functions below take the codes, reversed codes and vocab as any
+ * map with their find(): Codes_T, RevCodes_T and MapStrInt, or StaticMaps
+ * when the concrete types are known (see VocabVectorizerT)
+ */
+template<typename RevCodesMap_T, typename VocabMap_T>
 void _decompose_bpe(const std::string s,
 		    TokenList_T &new_subwords,
-		    const RevCodes_T &reversed_codes,
-		    const MapStrInt &vocab,
+		    const RevCodesMap_T &reversed_codes,
+		    const VocabMap_T &vocab,
 		    bool is_final) {
 
 
@@ -47,7 +53,7 @@ void _decompose_bpe(const std::string s,
     }
     TPS_T pair = unpack_pair(pair_value);
     std::string token1 = pair.first;
-    bool found = vocab.exists(token1 + BPE_DELIM);
+    bool found = in_vocab(vocab, token1 + BPE_DELIM);
     if (!found) {
 	_decompose_bpe(token1,
 		       new_subwords, reversed_codes, vocab, false);
@@ -60,7 +66,7 @@ void _decompose_bpe(const std::string s,
     if (is_final) {
 	query = token2.substr(0, token2.size() - BPE_END_WORD_LENGTH);
     }
-    found = vocab.exists(query);
+    found = in_vocab(vocab, query);
     if (!found) {
 	_decompose_bpe(token2, new_subwords, reversed_codes, vocab, is_final);
     }
@@ -69,9 +75,10 @@ void _decompose_bpe(const std::string s,
     }
 }
 
+template<typename RevCodesMap_T, typename VocabMap_T>
 void _limit_vocab_bpe(const TokenList_T &subwords, TokenList_T &new_subwords,
-		      const RevCodes_T &reversed_codes,
-		      const MapStrInt &vocab) {
+		      const RevCodesMap_T &reversed_codes,
+		      const VocabMap_T &vocab) {
     std::string query;
     int sz = (int)subwords.size();
     for (int i = 0; i < sz; i++) {
@@ -82,7 +89,7 @@ void _limit_vocab_bpe(const TokenList_T &subwords, TokenList_T &new_subwords,
 	} else {
 	    query = subword + BPE_DELIM;
 	}
-	bool found = vocab.exists(query);
+	bool found = in_vocab(vocab, query);
 	if (!found) {
 	    _decompose_bpe(subword, new_subwords, reversed_codes, vocab, is_final);
 	} else {
@@ -92,10 +99,11 @@ void _limit_vocab_bpe(const TokenList_T &subwords, TokenList_T &new_subwords,
 }
 
 
+template<typename CodesMap_T, typename RevCodesMap_T, typename VocabMap_T>
 std::string process_bpe(TokenList_T &subwords,
-			const Codes_T &codes,
-			const RevCodes_T &reversed_codes,
-			const MapStrInt &vocab) {
+			const CodesMap_T &codes,
+			const RevCodesMap_T &reversed_codes,
+			const VocabMap_T &vocab) {
     // merge subWords as much as possible
     TokenList_T new_subwords;
     while (subwords.size() > 1) {
@@ -161,40 +169,68 @@ std::string process_bpe(TokenList_T &subwords,
 }
 
 
+/*!
+ * The initial BPE symbols for ASCII characters, so ASCII words are split
+ * without scanning for UTF-8 boundaries or building substrings: character
+ * c is at c, and c with the end-of-word marker at 128 + c
+ */
+const std::string* bpe_ascii_symbols() {
+    static const std::vector<std::string> symbols = []() {
+	std::vector<std::string> v(256);
+	for (int c = 0; c < 128; ++c) {
+	    v[c] = std::string(1, (char)c);
+	    v[128 + c] = std::string(1, (char)c) + BPE_END_WORD;
+	}
+	return v;
+    }();
+    return symbols.data();
+}
+
 // TODO: make this more efficient by changing process_bpe
-TokenList_T _apply_bpe_single(const TokenList_T& s,
-			      const Codes_T& codes,
-			      const RevCodes_T& reversed_codes,
-			      const MapStrInt& vocab,
-			      const SpecialVocab_T& special_tokens,
-			      const Transform_T& transform) {
+// The transform is a Transform_T or a TransformPipeline (see apply_transform)
+template<typename CodesMap_T, typename RevCodesMap_T, typename VocabMap_T, typename TransformFn>
+TokenList_T _apply_bpe_single(const TokenList_T& words,
+			      const CodesMap_T& codes,
+			      const RevCodesMap_T& reversed_codes,
+			      const VocabMap_T& vocab,
+			      const TransformFn& transform) {
     std::string cur;
-    TokenList_T words = s;
     int sz = (int)words.size();
     for (int i = 0; i < sz; i++) {
-	auto word = words[i];
-	auto it = special_tokens.find(word);
-	if (it != special_tokens.end()) {
-	    cur += " " + word;
+	bool found;
+	Index_T x;
+	std::tie(found, x) = vocab.find(words[i]);
+	if (found && is_special_id(x)) {
+	    cur += " " + words[i];
 	    if (i < sz - 1) cur += " ";
 	    continue;
 	}
-	word = transform(word);
+	const std::string& word = apply_transform(transform, words[i]);
 	TokenList_T word_bpes;
-	int pos = 0, real_length = 0;
-	int last_start = 0;
-	while (word[pos]) {
-	    bool new_char = (word[pos] & 0xc0) != 0x80;
-	    real_length += new_char;
-	    if (new_char && pos > 0) {
-		auto new_token = word.substr(last_start, pos - last_start);
-		word_bpes.push_back(new_token);
-		last_start = pos;
+	if (!word.empty() && is_ascii(word)) {
+	    const std::string* symbols = bpe_ascii_symbols();
+	    const size_t n = word.size();
+	    word_bpes.reserve(n);
+	    for (size_t j = 0; j + 1 < n; ++j) {
+		word_bpes.push_back(symbols[(unsigned char)word[j]]);
 	    }
-	    pos++;
+	    word_bpes.push_back(symbols[128 + (unsigned char)word[n - 1]]);
+	}
+	else {
+	    int pos = 0;
+	    int last_start = 0;
+	    while (word[pos]) {
+		bool new_char = (word[pos] & 0xc0) != 0x80;
+		if (new_char && pos > 0) {
+		    auto new_token = word.substr(last_start, pos - last_start);
+		    word_bpes.push_back(new_token);
+		    last_start = pos;
+		}
+		pos++;
+	    }
+	    auto bpe = word.substr(last_start, std::string::npos) + BPE_END_WORD;
+	    word_bpes.push_back(bpe);
 	}
-	auto bpe = word.substr(last_start, std::string::npos) + BPE_END_WORD;
-	word_bpes.push_back(bpe);
 	cur += process_bpe(word_bpes, codes, reversed_codes, vocab);
 	if (i < sz - 1) cur += " ";
     }
@@ -202,34 +238,91 @@ TokenList_T _apply_bpe_single(const TokenList_T& s,
 }
 
 void read_codes_mmap(const std::string& dir, Codes_T*& codes, RevCodes_T*& rev_codes) {
-    auto c = new PerfectHashMapStrInt(file_in_dir(dir, "ph-codes"));
-    auto rc = new PerfectHashMapStrStr(file_in_dir(dir, "ph-rcodes"));
+    auto c = open_perfect_hash_str_int(file_in_dir(dir, "ph-codes"));
+    auto rc = open_perfect_hash_str_str(file_in_dir(dir, "ph-rcodes"));
     codes = c;
     rev_codes = rc;
 
 }
-void read_codes_file(const std::string& infile, Codes_T*& codes, RevCodes_T*& rev_codes)
+/*!
+ *  Read a BPE codes file, with lines of "left right" or fastBPE's
+ *  "left right count".  Merge ranks are given by line order.  Like
+ *  read_vocab_file, the file is memory-mapped, and the packed pair and
+ *  concatenated keys are built and hashed in parallel chunks before being
+ *  bulk-inserted in order
+ */
+void read_codes_file(const std::string& infile, Codes_T*& codes, RevCodes_T*& rev_codes, size_t num_threads=0)
 {
     if (is_dir(infile)) {
 	read_codes_mmap(infile, codes, rev_codes);
 	return;
     }
-
+    struct Entry {
+	size_t pair_offset;
+	size_t pair_length;
+	size_t concat_length;
+	uint64_t pair_hash;
+	uint64_t concat_hash;
+    };
+    struct Chunk {
+	std::string keys;
+	std::vector<Entry> entries;
+    };
+    MappedFile f(infile);
+    std::vector<Chunk> chunks(num_threads ? num_threads : default_num_threads());
+    const size_t pack_delim_length = strlen(PACK_DELIM);
+    parallel_line_chunks(f.data(), f.size(), chunks.size(),
+			 [&chunks, pack_delim_length](size_t c, const char* p, const char* end) {
+	auto& chunk = chunks[c];
+	// Each line turns into "left  right" followed by "leftright"
+	chunk.keys.reserve(2 * (end - p));
+	chunk.entries.reserve(count_newlines(p, end) + 1);
+	StringView_T fields[2];
+	while (p < end) {
+	    const char* eol = find_newline(p, end);
+	    if (split_fields(p, eol, fields, 2) == 2) {
+		Entry e;
+		e.pair_offset = chunk.keys.size();
+		chunk.keys.append(fields[0].data(), fields[0].size());
+		chunk.keys.append(PACK_DELIM);
+		chunk.keys.append(fields[1].data(), fields[1].size());
+		e.pair_length = chunk.keys.size() - e.pair_offset;
+		chunk.keys.append(fields[0].data(), fields[0].size());
+		chunk.keys.append(fields[1].data(), fields[1].size());
+		e.concat_length = e.pair_length - pack_delim_length;
+		const char* k = chunk.keys.data() + e.pair_offset;
+		e.pair_hash = UnorderedMapStrInt::hash(StringView_T(k, e.pair_length));
+		e.concat_hash = UnorderedMapStrStr::hash(StringView_T(k + e.pair_length, e.concat_length));
+		chunk.entries.push_back(e);
+	    }
+	    p = (eol < end) ? eol + 1 : end;
+	}
+    });
+    size_t total = 0;
+    for (auto& chunk : chunks) {
+	total += chunk.entries.size();
+    }
     auto c = new UnorderedMapStrInt();
     auto rc = new UnorderedMapStrStr();
-    std::ifstream f(infile.c_str());
-    if (!f.is_open()) {
-        throw std::runtime_error(std::string("No file: ") + infile);
-    }
-    std::string line;
-    while (getline(f, line)) {
-	auto splits = split(line);
-	auto pair = pack_pair(splits[0], splits[1]);
-	std::string concat = splits[0] + splits[1];
-	(*c)[pair] = (uint32_t)c->size();
-	(*rc)[concat] = pair;
+    c->reserve(total, f.size());
+    rc->reserve(total, f.size());
+    for (auto& chunk : chunks) {
+	for (auto& e : chunk.entries) {
+	    const char* k = chunk.keys.data() + e.pair_offset;
+	    StringView_T pair(k, e.pair_length);
+	    StringView_T concat(k + e.pair_length, e.concat_length);
+	    Index_T rank = (Index_T)c->size();
+	    auto r = c->try_emplace(pair, e.pair_hash, rank);
+	    if (!r.second) {
+		*r.first = rank;
+	    }
+	    std::string pair_str(k, e.pair_length);
+	    auto rr = rc->try_emplace(concat, e.concat_hash, pair_str);
+	    if (!rr.second) {
+		*rr.first = pair_str;
+	    }
+	}
     }
-    f.close();
     codes = c;
     rev_codes = rc;
 }
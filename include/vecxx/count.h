@@ -0,0 +1,179 @@
+#ifndef __VECXX_COUNT_H__
+#define __VECXX_COUNT_H__
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include "vecxx/utils.h"
+#include "vecxx/iox.h"
+
+/*!
+ *  Count tokens over one or more text files natively.
+ *
+ *  Each file is memory-mapped and cut into line-aligned chunks, one per
+ *  thread.  Lines are split on the splitter (as split() does), each token
+ *  is optionally transformed, and counted into thread-local tables that are
+ *  already sharded by hash, so the merge is also parallel: thread p folds
+ *  shard p of every thread's table and no locking is needed.
+ *
+ *  If a transform is given it will be called from several threads at once,
+ *  unless num_threads is 1
+ */
+class CorpusCounter
+{
+    typedef FlatHashMap<int64_t> Counts_T;
+    std::string _splitter;
+    Transform_T _transform;
+    size_t _num_threads;
+    std::vector<Counts_T> _shards;
+
+    size_t _shard_of(uint64_t h) const {
+	return (size_t)((h >> 32) % _shards.size());
+    }
+
+    void _count_line(const char* p, const char* end, std::vector<Counts_T>& local) const {
+	if (end > p && end[-1] == '\r') {
+	    --end;
+	}
+	const size_t split_l = _splitter.size();
+	while (p < end) {
+	    const char* next = std::search(p, end, _splitter.begin(), _splitter.end());
+	    if (next != p) {
+		StringView_T token(p, next - p);
+		if (_transform) {
+		    std::string t = _transform(std::string(p, next - p));
+		    _add(local, StringView_T(t.data(), t.size()), 1);
+		}
+		else {
+		    _add(local, token, 1);
+		}
+	    }
+	    p = (next < end) ? next + split_l : end;
+	}
+    }
+
+    void _add(std::vector<Counts_T>& shards, StringView_T token, int64_t n) const {
+	uint64_t h = Counts_T::hash(token);
+	*shards[_shard_of(h)].try_emplace(token, h, 0).first += n;
+    }
+
+public:
+    CorpusCounter(const std::string& splitter=" ",
+		  const Transform_T& transform=Transform_T(),
+		  size_t num_threads=0) :
+	_splitter(splitter.empty() ? std::string(" ") : splitter),
+	_transform(transform),
+	_num_threads(num_threads ? num_threads : default_num_threads()) {
+	_shards.resize(_num_threads);
+    }
+
+    /*!
+     * Count the tokens in these files, adding to any earlier counts
+     */
+    void count(const TokenList_T& files) {
+	const size_t n = _num_threads;
+	std::vector<std::vector<Counts_T> > locals(n, std::vector<Counts_T>(n));
+	for (auto& file : files) {
+	    MappedFile f(file);
+	    parallel_line_chunks(f.data(), f.size(), n,
+				 [this, &locals](size_t c, const char* p, const char* end) {
+		while (p < end) {
+		    const char* eol = find_newline(p, end);
+		    _count_line(p, eol, locals[c]);
+		    p = (eol < end) ? eol + 1 : end;
+		}
+	    });
+	}
+	auto merge = [this, &locals, n](size_t shard) {
+	    Counts_T& out = _shards[shard];
+	    for (size_t c = 0; c < n; ++c) {
+		const Counts_T& in = locals[c][shard];
+		for (size_t i = 0; i < in.size(); ++i) {
+		    *out.try_emplace(in.key_view_at(i)).first += in.value_at(i);
+		}
+	    }
+	};
+	if (n == 1) {
+	    merge(0);
+	    return;
+	}
+	std::vector<std::thread> threads;
+	for (size_t shard = 0; shard < n; ++shard) {
+	    threads.push_back(std::thread(merge, shard));
+	}
+	for (auto& t : threads) {
+	    t.join();
+	}
+    }
+
+    size_t size() const {
+	size_t n = 0;
+	for (auto& shard : _shards) {
+	    n += shard.size();
+	}
+	return n;
+    }
+
+    Counter_T counts(int min_freq=0) const {
+	Counter_T counter;
+	for (auto& shard : _shards) {
+	    for (size_t i = 0; i < shard.size(); ++i) {
+		if (shard.value_at(i) > min_freq) {
+		    counter[shard.key_at(i)] = (int)shard.value_at(i);
+		}
+	    }
+	}
+	return counter;
+    }
+
+    /*!
+     * The tokens seen more than min_freq times (the same rule the WordVocab
+     * Counter_T constructor uses), most frequent first with ties broken by
+     * the token, keeping at most max_size of them if it is non-zero
+     */
+    TokenList_T top_k(size_t max_size=0, int min_freq=0) const {
+	std::vector<std::pair<int64_t, StringView_T> > entries;
+	entries.reserve(size());
+	for (auto& shard : _shards) {
+	    for (size_t i = 0; i < shard.size(); ++i) {
+		if (shard.value_at(i) > min_freq) {
+		    entries.push_back(std::make_pair(shard.value_at(i), shard.key_view_at(i)));
+		}
+	    }
+	}
+	auto by_count = [](const std::pair<int64_t, StringView_T>& a,
+			   const std::pair<int64_t, StringView_T>& b) {
+	    if (a.first != b.first) {
+		return a.first > b.first;
+	    }
+	    size_t n = std::min(a.second.size(), b.second.size());
+	    int cmp = n ? memcmp(a.second.data(), b.second.data(), n) : 0;
+	    return cmp != 0 ? cmp < 0 : a.second.size() < b.second.size();
+	};
+	if (max_size > 0 && max_size < entries.size()) {
+	    std::partial_sort(entries.begin(), entries.begin() + max_size, entries.end(), by_count);
+	    entries.resize(max_size);
+	}
+	else {
+	    std::sort(entries.begin(), entries.end(), by_count);
+	}
+	TokenList_T tokens;
+	tokens.reserve(entries.size());
+	for (auto& e : entries) {
+	    tokens.push_back(std::string(e.second.data(), e.second.size()));
+	}
+	return tokens;
+    }
+};
+
+Counter_T count_corpus(const TokenList_T& files,
+		       const std::string& splitter=" ",
+		       const Transform_T& transform=Transform_T(),
+		       size_t num_threads=0) {
+    CorpusCounter counter(splitter, transform, num_threads);
+    counter.count(files);
+    return counter.counts();
+}
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef __VECXX_FLAT_H__
+#define __VECXX_FLAT_H__
+
+/*
+ * An open-addressing string-keyed hash table in the style of SwissTable.
+ *
+ * Each slot has a one-byte control word: either EMPTY, or the low 7 bits
+ * of the key's hash.  Slots are probed a group of 16 control bytes at a
+ * time (with SSE2 where available), so most misses are rejected without
+ * touching a key, and most hits compare exactly one key.
+ *
+ * Keys live back-to-back in a single character arena and entries are kept
+ * in insertion order, so there is no per-entry allocation, and iteration is
+ * a linear walk.  Lookups can be done with a StringView_T, so callers with a
+ * (pointer, length) pair never need to build a std::string.
+ *
+ * There is no erase, the vocab tables built on this only ever grow.
+ */
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define VECXX_HAVE_SSE2 1
+#endif
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <string_view>
+typedef std::string_view StringView_T;
+#else
+// Just enough of std::string_view for lookups, when building pre-C++17
+class StringView_T
+{
+    const char* _p;
+    size_t _n;
+public:
+    StringView_T() : _p(""), _n(0) {}
+    StringView_T(const char* p, size_t n) : _p(p), _n(n) {}
+    StringView_T(const char* p) : _p(p), _n(strlen(p)) {}
+    StringView_T(const std::string& s) : _p(s.data()), _n(s.size()) {}
+    const char* data() const { return _p; }
+    size_t size() const { return _n; }
+    size_t length() const { return _n; }
+    bool empty() const { return _n == 0; }
+    char operator[](size_t i) const { return _p[i]; }
+    bool operator==(const StringView_T& o) const {
+	return _n == o._n && (_n == 0 || memcmp(_p, o._p, _n) == 0);
+    }
+    bool operator!=(const StringView_T& o) const { return !(*this == o); }
+};
+#endif
+
+inline int lowest_bit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int i = 0;
+    while (!(mask & 1)) {
+	mask >>= 1;
+	++i;
+    }
+    return i;
+#endif
+}
+
+inline uint64_t _flat_mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= UINT64_C(0xff51afd7ed558ccd);
+    h ^= h >> 33;
+    h *= UINT64_C(0xc4ceb9fe1a85ec53);
+    h ^= h >> 33;
+    return h;
+}
+
+/*!
+ *  A fast, non-cryptographic 64-bit string hash, reading 8 bytes at a time
+ */
+inline uint64_t flat_hash(const char* p, size_t n) {
+    const uint64_t k = UINT64_C(0x9e3779b97f4a7c15);
+    uint64_t h = UINT64_C(0x2545f4914f6cdd1d) ^ (n * k);
+    while (n >= 8) {
+	uint64_t w;
+	memcpy(&w, p, 8);
+	h = (h ^ _flat_mix(w)) * k;
+	p += 8;
+	n -= 8;
+    }
+    if (n > 0) {
+	uint64_t w = 0;
+	memcpy(&w, p, n);
+	h = (h ^ _flat_mix(w)) * k;
+    }
+    return _flat_mix(h);
+}
+
+template<typename V>
+class FlatHashMap
+{
+    static const int8_t EMPTY = -128;
+    static const size_t GROUP = 16;
+    static const uint32_t NO_ENTRY = 0xFFFFFFFF;
+
+    struct Entry {
+	uint64_t offset;
+	uint32_t length;
+	V value;
+    };
+
+    std::vector<int8_t> _ctrl;
+    std::vector<uint32_t> _slots;
+    std::vector<Entry> _entries;
+    std::vector<char> _arena;
+    size_t _group_mask;
+
+    static int8_t _h2(uint64_t h) { return (int8_t)(h & 0x7F); }
+    static size_t _h1(uint64_t h) { return (size_t)(h >> 7); }
+
+    // Bitmask of the positions in a group whose control byte is c
+    static uint32_t _match(const int8_t* g, int8_t c) {
+#ifdef VECXX_HAVE_SSE2
+	__m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(g));
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(c)));
+#else
+	uint32_t mask = 0;
+	for (size_t i = 0; i < GROUP; ++i) {
+	    mask |= (uint32_t)(g[i] == c) << i;
+	}
+	return mask;
+#endif
+    }
+    bool _key_equals(const Entry& e, const char* p, size_t n) const {
+	return e.length == n && (n == 0 || memcmp(&_arena[e.offset], p, n) == 0);
+    }
+
+    // Returns the entry index for a key, or NO_ENTRY
+    uint32_t _find(const char* p, size_t n, uint64_t h) const {
+	if (_entries.empty()) {
+	    return NO_ENTRY;
+	}
+	const int8_t h2 = _h2(h);
+	size_t g = _h1(h) & _group_mask;
+	for (size_t step = 1; ; ++step) {
+	    const int8_t* ctrl = &_ctrl[g * GROUP];
+	    for (uint32_t m = _match(ctrl, h2); m != 0; m &= m - 1) {
+		uint32_t e = _slots[g * GROUP + lowest_bit(m)];
+		if (_key_equals(_entries[e], p, n)) {
+		    return e;
+		}
+	    }
+	    if (_match(ctrl, EMPTY) != 0) {
+		return NO_ENTRY;
+	    }
+	    // Triangular probing visits every group when the count is a power of 2
+	    g = (g + step) & _group_mask;
+	}
+    }
+
+    void _place(uint32_t e, uint64_t h) {
+	size_t g = _h1(h) & _group_mask;
+	for (size_t step = 1; ; ++step) {
+	    uint32_t m = _match(&_ctrl[g * GROUP], EMPTY);
+	    if (m != 0) {
+		size_t slot = g * GROUP + lowest_bit(m);
+		_ctrl[slot] = _h2(h);
+		_slots[slot] = e;
+		return;
+	    }
+	    g = (g + step) & _group_mask;
+	}
+    }
+
+    void _rehash(size_t num_groups) {
+	_ctrl.assign(num_groups * GROUP, (int8_t)EMPTY);
+	_slots.assign(num_groups * GROUP, (uint32_t)NO_ENTRY);
+	_group_mask = num_groups - 1;
+	for (size_t i = 0; i < _entries.size(); ++i) {
+	    const Entry& e = _entries[i];
+	    const char* p = e.length ? &_arena[e.offset] : "";
+	    _place((uint32_t)i, flat_hash(p, e.length));
+	}
+    }
+
+    // Group count (a power of 2) keeping n entries under a 7/8 load factor
+    static size_t _groups_for(size_t n) {
+	size_t groups = 1;
+	while (groups * GROUP * 7 < n * 8) {
+	    groups <<= 1;
+	}
+	return groups;
+    }
+
+public:
+    typedef std::pair<std::string, V> value_type;
+
+    /*!
+     * Iterates entries in insertion order.  Dereferencing materializes a
+     * std::pair so callers can keep using ->first and ->second
+     */
+    class const_iterator
+    {
+	const FlatHashMap* _m;
+	size_t _i;
+	mutable size_t _loaded;
+	mutable value_type _v;
+    public:
+	const_iterator(const FlatHashMap* m, size_t i) : _m(m), _i(i), _loaded(NO_ENTRY) {}
+	const value_type& operator*() const {
+	    if (_loaded != _i) {
+		_v.first = _m->key_at(_i);
+		_v.second = _m->value_at(_i);
+		_loaded = _i;
+	    }
+	    return _v;
+	}
+	const value_type* operator->() const { return &(**this); }
+	const_iterator& operator++() { ++_i; return *this; }
+	bool operator==(const const_iterator& o) const { return _i == o._i; }
+	bool operator!=(const const_iterator& o) const { return _i != o._i; }
+    };
+
+    FlatHashMap() : _group_mask(0) {
+	_rehash(1);
+    }
+
+    void reserve(size_t n, size_t key_bytes=0) {
+	_entries.reserve(n);
+	if (key_bytes) {
+	    _arena.reserve(key_bytes);
+	}
+	size_t groups = _groups_for(n);
+	if (groups > _group_mask + 1) {
+	    _rehash(groups);
+	}
+    }
+
+    static uint64_t hash(StringView_T key) {
+	return flat_hash(key.data(), key.size());
+    }
+
+    const V* find(StringView_T key) const {
+	uint32_t e = _find(key.data(), key.size(), flat_hash(key.data(), key.size()));
+	return e == NO_ENTRY ? NULL : &_entries[e].value;
+    }
+    V* find(StringView_T key) {
+	uint32_t e = _find(key.data(), key.size(), flat_hash(key.data(), key.size()));
+	return e == NO_ENTRY ? NULL : &_entries[e].value;
+    }
+
+    /*!
+     * Insert the key if it is missing.  Returns the value slot and whether
+     * the key was inserted.  The pointer is valid until the next insert
+     */
+    std::pair<V*, bool> try_emplace(StringView_T key, const V& value=V()) {
+	return try_emplace(key, hash(key), value);
+    }
+    /*!
+     * Insert with a hash already computed by hash(), so bulk loaders can
+     * hash keys in parallel and insert serially
+     */
+    std::pair<V*, bool> try_emplace(StringView_T key, uint64_t h, const V& value) {
+	const char* p = key.data();
+	size_t n = key.size();
+	uint32_t e = _find(p, n, h);
+	if (e != NO_ENTRY) {
+	    return std::make_pair(&_entries[e].value, false);
+	}
+	if ((_entries.size() + 1) * 8 > (_group_mask + 1) * GROUP * 7) {
+	    _rehash((_group_mask + 1) * 2);
+	}
+	Entry entry;
+	entry.offset = _arena.size();
+	entry.length = (uint32_t)n;
+	entry.value = value;
+	_arena.insert(_arena.end(), p, p + n);
+	_entries.push_back(entry);
+	_place((uint32_t)(_entries.size() - 1), h);
+	return std::make_pair(&_entries.back().value, true);
+    }
+
+    V& operator[](StringView_T key) {
+	return *try_emplace(key).first;
+    }
+
+    StringView_T key_view_at(size_t i) const {
+	const Entry& e = _entries[i];
+	return e.length ? StringView_T(&_arena[e.offset], e.length) : StringView_T();
+    }
+    std::string key_at(size_t i) const {
+	StringView_T k = key_view_at(i);
+	return std::string(k.data(), k.size());
+    }
+    const V& value_at(size_t i) const { return _entries[i].value; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, _entries.size()); }
+    bool empty() const { return _entries.empty(); }
+    size_t size() const { return _entries.size(); }
+    size_t max_size() const { return (size_t)NO_ENTRY; }
+};
+
+#endif
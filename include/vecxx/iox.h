@@ -19,6 +19,7 @@
 #include <stdint.h>   /* UINT32_MAX uint32_t uint64_t */
 #include <string>
 #include <tuple>
+#include <thread>
 #include "vecxx/phf.h"
 #include "vecxx/utils.h"
 
@@ -32,6 +33,8 @@
 #  include <sys/stat.h>
 #  include <sys/mman.h>
 #  include <unistd.h>
+#  include <dirent.h>
+#  include <cstdlib>
    typedef int Handle_T;
 #endif
 
@@ -163,7 +166,7 @@ std::string join_path(std::string p1, std::string p2) {
     return p1 + std::string(path_delimiter()) + p2;
 }
 
-std::tuple<void*, Handle_T> mmap_read(std::string file, uint32_t file_size, bool shared=false)
+std::tuple<void*, Handle_T> mmap_read(std::string file, size_t file_size, bool shared=false)
 {
     
 #if defined(WIN32) || defined(_WIN32)
@@ -254,9 +257,286 @@ std::string file_in_dir(const std::string& dir, const std::string& basename) {
     return out.str();    
 }
 
-void save_phf(const phf& hash, const std::string& dir) {
+// The id of this process, which a forked child does not share
+inline long process_id() {
+#if defined(WIN32) || defined(_WIN32)
+    return (long)GetCurrentProcessId();
+#else
+    return (long)getpid();
+#endif
+}
+
+/*!
+ *  Make a new, empty directory for scratch files.  On Linux it goes in
+ *  shared memory (/dev/shm), so files mapped from it by several processes
+ *  share one copy and never touch the disk.  Elsewhere it goes in the
+ *  temporary directory
+ */
+std::string make_temp_dir(const std::string& prefix) {
+#if defined(WIN32) || defined(_WIN32)
+    char dir[MAX_PATH + 1];
+    char path[MAX_PATH + 1];
+    if (GetTempPathA(sizeof(dir), dir) == 0 || GetTempFileNameA(dir, prefix.c_str(), 0, path) == 0) {
+	throw std::runtime_error("Could not make a temporary directory");
+    }
+    // GetTempFileNameA creates a file to reserve the name
+    DeleteFileA(path);
+    if (!make_dir(path)) {
+	throw std::runtime_error(std::string("Could not make a temporary directory: ") + path);
+    }
+    return path;
+#else
+    std::string base = is_dir("/dev/shm") ? "/dev/shm" : "";
+    if (base.empty()) {
+	const char* tmp = getenv("TMPDIR");
+	base = (tmp != NULL && *tmp) ? tmp : "/tmp";
+    }
+    std::string path = file_in_dir(base, prefix + "XXXXXX");
+    if (mkdtemp(&path[0]) == NULL) {
+	throw std::runtime_error("Could not make a temporary directory in " + base);
+    }
+    return path;
+#endif
+}
+
+/*!
+ *  Remove a directory and everything in it.  Files still mapped stay
+ *  readable by whoever maps them (except on Windows, where they cannot be
+ *  removed until they are unmapped)
+ */
+void remove_dir(const std::string& path) {
+#if defined(WIN32) || defined(_WIN32)
+    WIN32_FIND_DATAA entry;
+    HANDLE h = FindFirstFileA(file_in_dir(path, "*").c_str(), &entry);
+    if (h != INVALID_HANDLE_VALUE) {
+	do {
+	    std::string name = entry.cFileName;
+	    if (name == "." || name == "..") {
+		continue;
+	    }
+	    auto child = file_in_dir(path, name);
+	    if (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+		remove_dir(child);
+	    }
+	    else {
+		DeleteFileA(child.c_str());
+	    }
+	} while (FindNextFileA(h, &entry));
+	FindClose(h);
+    }
+    RemoveDirectoryA(path.c_str());
+#else
+    DIR* d = opendir(path.c_str());
+    if (d != NULL) {
+	while (struct dirent* entry = readdir(d)) {
+	    std::string name = entry->d_name;
+	    if (name == "." || name == "..") {
+		continue;
+	    }
+	    auto child = file_in_dir(path, name);
+	    if (is_dir(child)) {
+		remove_dir(child);
+	    }
+	    else {
+		::unlink(child.c_str());
+	    }
+	}
+	closedir(d);
+    }
+    ::rmdir(path.c_str());
+#endif
+}
+
+
+/*!
+ *  A read-only memory mapping of a whole file
+ */
+class MappedFile
+{
+    void* _data;
+    size_t _size;
+    Handle_T _fd;
+public:
+    MappedFile(const std::string& file) : _data(NULL), _size(0), _fd(0) {
+	if (!file_exists(file) || is_dir(file)) {
+	    throw std::runtime_error(std::string("No file: ") + file);
+	}
+	_size = (size_t)file_size(file);
+	if (_size > 0) {
+	    std::tie(_data, _fd) = mmap_read(file, _size);
+	    if (_data == NULL || _data == (void*)-1) {
+		_data = NULL;
+		throw std::runtime_error(std::string("Could not map: ") + file);
+	    }
+	}
+    }
+    ~MappedFile() {
+	if (_data != NULL) {
+	    munmap(_data, _size);
+	    close_file(_fd);
+	}
+    }
+    const char* data() const { return _size ? (const char*)_data : ""; }
+    size_t size() const { return _size; }
+};
+
+/*!
+ *  Find the next newline in [p, end), or end if there is none
+ */
+inline const char* find_newline(const char* p, const char* end) {
+#ifdef VECXX_HAVE_SSE2
+    const __m128i nl = _mm_set1_epi8('\n');
+    while (p + 16 <= end) {
+	uint32_t m = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), nl));
+	if (m != 0) {
+	    return p + lowest_bit(m);
+	}
+	p += 16;
+    }
+#endif
+    const char* q = (const char*)memchr(p, '\n', end - p);
+    return q ? q : end;
+}
+
+inline size_t count_newlines(const char* p, const char* end) {
+    size_t n = 0;
+#ifdef VECXX_HAVE_SSE2
+    const __m128i nl = _mm_set1_epi8('\n');
+    while (p + 16 <= end) {
+	uint32_t m = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), nl));
+	for (; m != 0; m &= m - 1) {
+	    ++n;
+	}
+	p += 16;
+    }
+#endif
+    for (; p < end; ++p) {
+	n += (*p == '\n');
+    }
+    return n;
+}
+
+/*!
+ *  Split a line into up to max_fields space-separated fields, skipping
+ *  empty fields like split() does.  A trailing carriage return is ignored.
+ *  Returns the number of fields found
+ */
+inline size_t split_fields(const char* p, const char* end, StringView_T* fields, size_t max_fields) {
+    if (end > p && end[-1] == '\r') {
+	--end;
+    }
+    size_t n = 0;
+    while (p < end && n < max_fields) {
+	while (p < end && *p == ' ') {
+	    ++p;
+	}
+	if (p == end) {
+	    break;
+	}
+	const char* start = p;
+	while (p < end && *p != ' ') {
+	    ++p;
+	}
+	fields[n++] = StringView_T(start, p - start);
+    }
+    return n;
+}
+
+// Files smaller than this per thread are not worth splitting up
+const size_t MIN_PARALLEL_CHUNK = 1 << 20;
+
+size_t default_num_threads() {
+    size_t n = std::thread::hardware_concurrency();
+    return n ? n : 1;
+}
+
+/*!
+ *  Cut [p, p + n) into up to num_threads chunks that end on line
+ *  boundaries, and run fn(chunk_index, begin, end) on each, in parallel.
+ *  Returns the number of chunks.  Pass num_threads=0 to use all cores
+ */
+template<typename Fn>
+size_t parallel_line_chunks(const char* p, size_t n, size_t num_threads, Fn fn) {
+    if (num_threads == 0) {
+	num_threads = default_num_threads();
+    }
+    num_threads = std::max<size_t>(1, std::min<size_t>(num_threads, n / MIN_PARALLEL_CHUNK));
+    const char* end = p + n;
+    std::vector<const char*> bounds(1, p);
+    for (size_t i = 1; i < num_threads; ++i) {
+	const char* cut = std::max(bounds.back(), p + n * i / num_threads);
+	cut = find_newline(cut, end);
+	bounds.push_back(cut < end ? cut + 1 : end);
+    }
+    bounds.push_back(end);
+    size_t num_chunks = bounds.size() - 1;
+    if (num_chunks == 1) {
+	fn((size_t)0, bounds[0], bounds[1]);
+	return 1;
+    }
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < num_chunks; ++i) {
+	threads.push_back(std::thread(fn, i, bounds[i], bounds[i + 1]));
+    }
+    for (auto& t : threads) {
+	t.join();
+    }
+    return num_chunks;
+}
+
+/*
+ * Compiled string stores keep [start, end) offsets into a flat character
+ * file.  Tables whose character data fits in 4GB use 32-bit offsets; larger
+ * tables are written with 64-bit offsets.  The width (in bytes) is recorded
+ * as the last line of md.txt, and directories written before it was
+ * recorded are read as 32-bit
+ */
+const uint32_t OFFSET_WIDTH_32 = 4;
+const uint32_t OFFSET_WIDTH_64 = 8;
+
+uint32_t offset_width_for(size_t flat_size) {
+    return (flat_size > UINT32_MAX) ? OFFSET_WIDTH_64 : OFFSET_WIDTH_32;
+}
+
+/*
+ * The width to compile flat_size bytes of character data with.  A
+ * requested width of 0 picks it from the size, anything else is checked
+ * (64-bit offsets can be asked for on a small table, to test them)
+ */
+uint32_t check_offset_width(uint32_t offset_width, size_t flat_size) {
+    if (offset_width == 0) {
+	return offset_width_for(flat_size);
+    }
+    if (offset_width != OFFSET_WIDTH_32 && offset_width != OFFSET_WIDTH_64) {
+	throw std::invalid_argument("Unsupported offset width " + std::to_string(offset_width) + ", use 4 or 8");
+    }
+    if (offset_width < offset_width_for(flat_size)) {
+	throw std::invalid_argument("An offset width of 4 cannot address more than 4GB of keys");
+    }
+    return offset_width;
+}
+
+/*!
+ *  While one of these is alive, save_phf does not announce the directories
+ *  it creates on this thread.  For compiles nobody asked for by name, such
+ *  as the copies behind Vocab::shared_dir
+ */
+class QuietCompile {
+    bool _was_quiet;
+public:
+    static bool& quiet() {
+	static thread_local bool q = false;
+	return q;
+    }
+    QuietCompile() : _was_quiet(quiet()) { quiet() = true; }
+    ~QuietCompile() { quiet() = _was_quiet; }
+};
+
+void save_phf(const phf& hash, const std::string& dir, uint32_t offset_width=OFFSET_WIDTH_32) {
     if (!file_exists(dir)) {
-	std::cerr << "creating " << dir << std::endl;
+	if (!QuietCompile::quiet()) {
+	    std::cerr << "creating " << dir << std::endl;
+	}
 	make_dir(dir);
     }
     std::ofstream ofs(file_in_dir(dir, "md.txt"));
@@ -266,6 +546,7 @@ void save_phf(const phf& hash, const std::string& dir) {
     ofs << hash.m << std::endl;
     ofs << hash.d_max << std::endl;
     ofs << hash.g_op << std::endl;
+    ofs << offset_width << std::endl;
     std::ofstream bin(file_in_dir(dir, "hash.dat"), std::ios::out | std::ios::binary);
     bin.write((const char*)hash.g, hash.r*4);
     bin.close();
@@ -293,17 +574,46 @@ void load_phf(phf& hash, const std::string& dir) {
     
 }
 
+uint32_t load_offset_width(const std::string& dir) {
+    std::ifstream ifs(file_in_dir(dir, "md.txt"));
+    std::string line;
+    // Skip the PHF fields written by save_phf
+    for (int i = 0; i < 6 && getline(ifs, line); ++i);
+    uint32_t width = OFFSET_WIDTH_32;
+    if (!(ifs >> width)) {
+	return OFFSET_WIDTH_32;
+    }
+    if (width != OFFSET_WIDTH_32 && width != OFFSET_WIDTH_64) {
+	throw std::runtime_error("Unsupported offset width " + std::to_string(width) + " in " + dir);
+    }
+    return width;
+}
+
 // TODO: dont hardcode the hash
 uint32_t _hash_key(const std::string& k, uint32_t h=1337) {
   return phf_round32(k, h);
 }
 
-void compile_str_int(const UnorderedMapStrInt& c, std::string dir,size_t alpha=80, size_t lambda=4) {
-    size_t n = c.size();
+template<typename T>
+void _write_array(const std::string& fname, const std::vector<T>& v) {
+    std::ofstream bin(fname, std::ios::out | std::ios::binary);
+    bin.write((const char*)v.data(), v.size()*sizeof(T));
+    bin.close();
+}
+
+// Special tokens are not compiled, the vocab adds them back when it loads
+template<typename OffsetT>
+void _compile_str_int(const UnorderedMapStrInt& c, const std::string& dir, size_t alpha, size_t lambda) {
+    size_t n = 0;
+    for (auto p = c.begin(); p != c.end(); ++p) {
+	n += !is_special_id(p->second);
+    }
     std::string* k = new std::string[n];
     size_t i = 0;
-    for (auto p = c.begin(); p != c.end(); ++p, ++i) {
-	k[i] = p->first;
+    for (auto p = c.begin(); p != c.end(); ++p) {
+	if (!is_special_id(p->second)) {
+	    k[i++] = p->first;
+	}
     }
     phf phf;
     uint32_t seed = randomseed();
@@ -311,56 +621,45 @@ void compile_str_int(const UnorderedMapStrInt& c, std::string dir,size_t alpha=8
     //PHF::compact(&phf);
 
     auto m = phf.m;
-    save_phf(phf, dir);
+    save_phf(phf, dir, sizeof(OffsetT));
 
+    // Offsets are indexed by id, so there is one pair per id up to the
+    // largest, and their count gives the id bound when loaded.  Keep one
+    // so that an empty table still maps
+    size_t num_ids = 1;
+    for (auto p = c.begin(); p != c.end(); ++p) {
+	if (!is_special_id(p->second)) {
+	    num_ids = std::max<size_t>(num_ids, (size_t)p->second + 1);
+	}
+    }
     std::vector<char> flat;
-    uint32_t* h = new uint32_t[m];
-    memset(h, 0, m*4);
-    uint32_t* v = new uint32_t[m];
-    memset(v, 0, m*4);
-    uint32_t* offsets = new uint32_t[m*2];
-    memset(offsets, 0, m*4*2);
-
-    uint32_t prev_offset = -1;
+    std::vector<uint32_t> h(m, 0);
+    std::vector<uint32_t> v(m, 0);
+    std::vector<OffsetT> offsets(num_ids*2, 0);
+
     for (auto p = c.begin(); p != c.end(); ++p) {
+	if (is_special_id(p->second)) {
+	    continue;
+	}
 	phf_hash_t idx = PHF::hash(&phf, p->first);
 	h[idx] = _hash_key(p->first);
 	v[idx] = (uint32_t)p->second;
-        assert((uint32_t)p->second < m*2);
-        auto offset_start = (uint32_t)p->second * 2;
-        offsets[offset_start] = (uint32_t)flat.size();
-        for (const char& ch : p->first) {
-            flat.push_back(ch);
-        }
-        offsets[offset_start + 1] = (uint32_t)flat.size();
+        auto offset_start = (size_t)p->second * 2;
+        offsets[offset_start] = (OffsetT)flat.size();
+        flat.insert(flat.end(), p->first.begin(), p->first.end());
+        offsets[offset_start + 1] = (OffsetT)flat.size();
     }
-    std::ofstream bin(file_in_dir(dir, "v.dat"),
-		      std::ios::out | std::ios::binary);
-    bin.write((const char*)v, m*4);
-    bin.close();
-
-    std::ofstream obin(file_in_dir(dir, "offsets.dat"),
-		       std::ios::out | std::ios::binary);
-    obin.write((const char*)offsets, m*4*2);
-    obin.close();
-
-    std::ofstream hbin(file_in_dir(dir, "hkey.dat"),
-		       std::ios::out | std::ios::binary);
-    hbin.write((const char*)h, m*4);
-    hbin.close();
-
-    std::ofstream cbin(file_in_dir(dir, "flat.dat"),
-		       std::ios::out | std::ios::binary);
-    cbin.write((const char*)&flat[0], flat.size());
-    cbin.close();
+    _write_array(file_in_dir(dir, "v.dat"), v);
+    _write_array(file_in_dir(dir, "offsets.dat"), offsets);
+    _write_array(file_in_dir(dir, "hkey.dat"), h);
+    _write_array(file_in_dir(dir, "flat.dat"), flat);
 
     PHF::destroy(&phf);
     delete [] k;
-    delete [] h;
-    delete [] v;
 }
 
-void compile_str_str(const UnorderedMapStrStr& c, std::string dir, size_t alpha=80, size_t lambda=4) {
+template<typename OffsetT>
+void _compile_str_str(const UnorderedMapStrStr& c, const std::string& dir, size_t alpha, size_t lambda) {
     size_t n = c.size();
     std::string* k = new std::string[n];
     size_t i = 0;
@@ -373,62 +672,70 @@ void compile_str_str(const UnorderedMapStrStr& c, std::string dir, size_t alpha=
     //PHF::compact(&phf);
 
     auto m = phf.m;
-    save_phf(phf, dir);
-
+    save_phf(phf, dir, sizeof(OffsetT));
 
-    uint32_t* h = new uint32_t[m];
-    uint32_t* offsets = new uint32_t[m*2];
     std::vector<char> flat;
-    memset(h, 0, m*4);
-    memset(offsets, 0, m*4*2);
-    assert(flat.size() <= UINT32_MAX);
+    std::vector<uint32_t> h(m, 0);
+    std::vector<OffsetT> offsets(m*2, 0);
     for (auto p = c.begin(); p != c.end(); ++p) {
 	phf_hash_t idx = PHF::hash(&phf, p->first);
 	h[idx] = _hash_key(p->first);
-	// 4GB limit on values
-	auto offset_start = idx*2;
-	offsets[offset_start] = (uint32_t)flat.size();
-	for (char ch : p->second) {
-	    flat.push_back(ch);
-	}
-	offsets[offset_start+1] = (uint32_t)flat.size();
+	auto offset_start = (size_t)idx*2;
+	offsets[offset_start] = (OffsetT)flat.size();
+	flat.insert(flat.end(), p->second.begin(), p->second.end());
+	offsets[offset_start+1] = (OffsetT)flat.size();
     }
-    PHF::init<std::string, 0>(&phf, k, n, lambda, alpha, seed);
-    //PHF::compact(&phf);
-    save_phf(phf, dir);    
     PHF::destroy(&phf);
-    std::ofstream obin(file_in_dir(dir, "offsets.dat"),
-		       std::ios::out | std::ios::binary);
-    obin.write((const char*)offsets, m*4*2);
-    obin.close();
-    std::ofstream hbin(file_in_dir(dir, "hkey.dat"),
-		       std::ios::out | std::ios::binary);
-    hbin.write((const char*)h, m*4);
-    hbin.close();
+    _write_array(file_in_dir(dir, "offsets.dat"), offsets);
+    _write_array(file_in_dir(dir, "hkey.dat"), h);
+    _write_array(file_in_dir(dir, "flat.dat"), flat);
 
-    std::ofstream cbin(file_in_dir(dir, "flat.dat"),
-		       std::ios::out | std::ios::binary);
-    cbin.write((const char*)&flat[0], flat.size());
-    cbin.close();
+    delete [] k;
 
+}
 
-    delete [] k;
-    delete [] h;
-    delete [] offsets;
+void compile_str_int(const UnorderedMapStrInt& c, std::string dir,size_t alpha=80, size_t lambda=4, uint32_t offset_width=0) {
+    size_t flat_size = 0;
+    for (auto p = c.begin(); p != c.end(); ++p) {
+	if (!is_special_id(p->second)) {
+	    flat_size += p->first.size();
+	}
+    }
+    if (check_offset_width(offset_width, flat_size) == OFFSET_WIDTH_64) {
+	_compile_str_int<uint64_t>(c, dir, alpha, lambda);
+    }
+    else {
+	_compile_str_int<uint32_t>(c, dir, alpha, lambda);
+    }
+}
 
+void compile_str_str(const UnorderedMapStrStr& c, std::string dir, size_t alpha=80, size_t lambda=4, uint32_t offset_width=0) {
+    size_t flat_size = 0;
+    for (auto p = c.begin(); p != c.end(); ++p) {
+	flat_size += p->second.size();
+    }
+    if (check_offset_width(offset_width, flat_size) == OFFSET_WIDTH_64) {
+	_compile_str_str<uint64_t>(c, dir, alpha, lambda);
+    }
+    else {
+	_compile_str_str<uint32_t>(c, dir, alpha, lambda);
+    }
 }
 
 
-// TODO: return tuple of data, fd
-std::tuple<uint32_t*, Handle_T> _read_uint32s(std::string fname, int sz) {
+template<typename T>
+std::tuple<T*, Handle_T> _read_array(std::string fname, size_t sz) {
     void* data = NULL;
     Handle_T fd = 0;
-    std::tie(data, fd) = mmap_read(fname, sz*4);
-    uint32_t* d = reinterpret_cast<uint32_t*>(data);
-    return std::make_tuple(d, fd);;
+    std::tie(data, fd) = mmap_read(fname, sz*sizeof(T));
+    T* d = reinterpret_cast<T*>(data);
+    return std::make_tuple(d, fd);
 }
-std::tuple<char*, uint32_t, Handle_T> _read_chars(std::string fname) {
-    uint32_t n = (uint32_t)file_size(fname);
+std::tuple<uint32_t*, Handle_T> _read_uint32s(std::string fname, size_t sz) {
+    return _read_array<uint32_t>(fname, sz);
+}
+std::tuple<char*, size_t, Handle_T> _read_chars(std::string fname) {
+    size_t n = (size_t)file_size(fname);
     void* data = NULL;
     Handle_T fd = 0;
     std::tie(data, fd) = mmap_read(fname, n);
@@ -436,34 +743,35 @@ std::tuple<char*, uint32_t, Handle_T> _read_chars(std::string fname) {
     return std::make_tuple(d, n, fd);
 }
 
-class PerfectHashMapStrStr : public MapStrStr
+template<typename OffsetT>
+class PerfectHashMapStrStrT : public MapStrStr
 {
     phf _phf;
     uint32_t* _k;
     Handle_T _k_fd;
-    uint32_t* _offsets;
+    OffsetT* _offsets;
     Handle_T _offsets_fd;
     char* _data;
-    uint32_t _data_len;
+    size_t _data_len;
     Handle_T _data_fd;
     uint32_t _hash_key(const std::string& k) const {
 	return phf_round32(k, 1337);
     }
 public:
-    PerfectHashMapStrStr(const std::string& dir)
+    PerfectHashMapStrStrT(const std::string& dir)
 	: _k(NULL), _offsets(NULL), _data(NULL), _data_len(0) {
 	load_phf(_phf, dir);
-	std::tie(_offsets, _offsets_fd) = _read_uint32s(file_in_dir(dir, "offsets.dat"), _phf.m*2);
+	std::tie(_offsets, _offsets_fd) = _read_array<OffsetT>(file_in_dir(dir, "offsets.dat"), _phf.m*2);
 	std::tie(_k, _k_fd) = _read_uint32s(file_in_dir(dir, "hkey.dat"), _phf.m);
 	std::tie(_data, _data_len, _data_fd) = _read_chars(file_in_dir(dir, "flat.dat"));
     }
-    ~PerfectHashMapStrStr() {
+    ~PerfectHashMapStrStrT() {
 	if (_k != NULL) {
 	    munmap(_k, _phf.m*4);
 	    close_file(_k_fd);
 	}
 	if (_offsets != NULL) {
-	    munmap(_offsets, _phf.m*4*2);
+	    munmap(_offsets, _phf.m*sizeof(OffsetT)*2);
 	    close_file(_offsets_fd);
 	}
 	if (_data != NULL) {
@@ -507,30 +815,34 @@ public:
 };
 
 
-class PerfectHashMapStrInt : public MapStrInt
+template<typename OffsetT>
+class PerfectHashMapStrIntT : public MapStrInt
 {
     phf _phf;
     uint32_t* _k;
     uint32_t* _v;
     Handle_T _k_fd;
     Handle_T _v_fd;
-    uint32_t* _offsets;
+    OffsetT* _offsets;
     Handle_T _offsets_fd;
-    uint32_t _data_len;
+    size_t _num_ids;
+    size_t _data_len;
     Handle_T _data_fd;
     char* _data;
     uint32_t _hash_key(const std::string& k) const {
 	return phf_round32(k, 1337);
     }
 public:
-    PerfectHashMapStrInt(const std::string& dir) : _k(NULL), _v(NULL) {
+    PerfectHashMapStrIntT(const std::string& dir) : _k(NULL), _v(NULL), _offsets(NULL), _num_ids(0), _data_len(0), _data(NULL) {
 	load_phf(_phf, dir);
 	std::tie(_k, _k_fd) = _read_uint32s(file_in_dir(dir, "hkey.dat"), _phf.m);
 	std::tie(_v, _v_fd) = _read_uint32s(file_in_dir(dir, "v.dat"), _phf.m);
-	std::tie(_offsets, _offsets_fd) = _read_uint32s(file_in_dir(dir, "offsets.dat"), _phf.m*2);
+	auto offsets_file = file_in_dir(dir, "offsets.dat");
+	_num_ids = (size_t)file_size(offsets_file) / (sizeof(OffsetT)*2);
+	std::tie(_offsets, _offsets_fd) = _read_array<OffsetT>(offsets_file, _num_ids*2);
 	std::tie(_data, _data_len, _data_fd) = _read_chars(file_in_dir(dir, "flat.dat"));
     }
-    ~PerfectHashMapStrInt() {
+    ~PerfectHashMapStrIntT() {
 	if (_k != NULL) {
 	    munmap(_k, _phf.m*4);
 	    close_file(_k_fd);
@@ -539,6 +851,14 @@ public:
 	    munmap(_v, _phf.m*4);
 	    close_file(_v_fd);
 	}
+	if (_offsets != NULL) {
+	    munmap(_offsets, _num_ids*sizeof(OffsetT)*2);
+	    close_file(_offsets_fd);
+	}
+	if (_data != NULL) {
+	    munmap(_data, _data_len);
+	    close_file(_data_fd);
+	}
 	PHF::destroy(&_phf);
 
     }
@@ -551,19 +871,16 @@ public:
 	phf_hash_t idx = PHF::hash(&_phf, key);
         const uint32_t p = _v[idx];
 	if (_k[idx] == _hash_key(key)) {
-            auto offset_idx = p * 2;
-            auto offset_start = _offsets[offset_idx];
-            auto offset_end = _offsets[offset_idx + 1];
 	    return std::make_tuple(true, (Index_T)p);
 	}
 	return std::make_tuple(false, (Index_T)0);
     }
 
     std::tuple<bool, std::string> rfind(const Index_T idx) const {
-        if (idx >= this->size()) {
+        if (idx >= _num_ids) {
             throw std::runtime_error("PerfectHashMapStrInt::rfind index " + std::to_string(idx) + " out of range");
         }
-        uint32_t offset_idx = (uint32_t)idx * 2;
+        size_t offset_idx = (size_t)idx * 2;
         auto offset_start = _offsets[offset_idx];
         auto offset_end = _offsets[offset_idx + 1];
         if (offset_end > _data_len) {
@@ -571,9 +888,291 @@ public:
         }
         return std::make_tuple(true, std::string(&_data[offset_start], &_data[offset_end]));
     }
+    void for_each(const std::function<void(const std::string&, Index_T)>& fn) const {
+	for (size_t i = 0; i < _num_ids; ++i) {
+	    auto offset_start = _offsets[i*2];
+	    auto offset_end = _offsets[i*2 + 1];
+	    if (offset_end > offset_start && offset_end <= _data_len) {
+		fn(std::string(&_data[offset_start], &_data[offset_end]), (Index_T)i);
+	    }
+	}
+    }
+    // Without reading any keys.  Stores compiled before offsets were sized
+    // by id have one pair per slot, which is a bound too, just not a tight one
+    Index_T id_bound() const { return (Index_T)_num_ids; }
     size_t size() const { return _phf.m; }
     size_t max_size() const { return _phf.m; }
 };
 
+typedef PerfectHashMapStrStrT<uint32_t> PerfectHashMapStrStr;
+typedef PerfectHashMapStrStrT<uint64_t> PerfectHashMapStrStr64;
+typedef PerfectHashMapStrIntT<uint32_t> PerfectHashMapStrInt;
+typedef PerfectHashMapStrIntT<uint64_t> PerfectHashMapStrInt64;
+
+/*!
+ *  Open a compiled string-to-int store, picking the reader that matches
+ *  the offset width recorded at compile time
+ */
+MapStrInt* open_perfect_hash_str_int(const std::string& dir) {
+    if (load_offset_width(dir) == OFFSET_WIDTH_64) {
+	return new PerfectHashMapStrInt64(dir);
+    }
+    return new PerfectHashMapStrInt(dir);
+}
+
+MapStrStr* open_perfect_hash_str_str(const std::string& dir) {
+    if (load_offset_width(dir) == OFFSET_WIDTH_64) {
+	return new PerfectHashMapStrStr64(dir);
+    }
+    return new PerfectHashMapStrStr(dir);
+}
+
+/*!
+ *  Compile any str->int store.  In-memory tables are compiled directly,
+ *  anything else is first copied out through for_each
+ */
+void compile_str_int(const MapStrInt& c, std::string dir, size_t alpha=80, size_t lambda=4, uint32_t offset_width=0) {
+    auto um = dynamic_cast<const UnorderedMapStrInt*>(&c);
+    if (um != NULL) {
+	compile_str_int(*um, dir, alpha, lambda, offset_width);
+	return;
+    }
+    UnorderedMapStrInt copy;
+    c.for_each([&copy](const std::string& k, Index_T v) { copy[k] = v; });
+    compile_str_int(copy, dir, alpha, lambda, offset_width);
+}
+
+void copy_file(const std::string& src, const std::string& dst) {
+    std::ifstream in(src, std::ios::in | std::ios::binary);
+    if (!in.is_open()) {
+	throw std::runtime_error(std::string("No file: ") + src);
+    }
+    std::ofstream out(dst, std::ios::out | std::ios::binary);
+    out << in.rdbuf();
+}
+
+/*!
+ *  Copy a compiled store from one directory to another
+ */
+void copy_compiled(const std::string& src_dir, const std::string& dst_dir) {
+    if (!file_exists(dst_dir)) {
+	make_dir(dst_dir);
+    }
+    for (auto f : {"md.txt", "hash.dat", "v.dat", "offsets.dat", "hkey.dat", "flat.dat"}) {
+	auto src = file_in_dir(src_dir, f);
+	if (file_exists(src)) {
+	    copy_file(src, file_in_dir(dst_dir, f));
+	}
+    }
+}
+
+/*
+ * A hash-free prefilter for a small key set: one bit per key length
+ * (lengths of 63 and over share a bit) and one bit per leading byte.
+ * If either bit is clear, the key is definitely not in the set
+ */
+class KeyFilter
+{
+    uint64_t _lengths;
+    uint64_t _first[4];
+    static size_t _len_bit(size_t n) { return n < 63 ? n : 63; }
+public:
+    KeyFilter() : _lengths(0) {
+	memset(_first, 0, sizeof(_first));
+    }
+    void add(const std::string& key) {
+	_lengths |= (uint64_t)1 << _len_bit(key.size());
+	unsigned char c = key.empty() ? 0 : (unsigned char)key[0];
+	_first[c >> 6] |= (uint64_t)1 << (c & 63);
+    }
+    bool may_contain(const std::string& key) const {
+	if (!(_lengths & ((uint64_t)1 << _len_bit(key.size())))) {
+	    return false;
+	}
+	unsigned char c = key.empty() ? 0 : (unsigned char)key[0];
+	return (_first[c >> 6] & ((uint64_t)1 << (c & 63))) != 0;
+    }
+    bool empty() const { return _lengths == 0; }
+};
+
+/*!
+ *  An immutable base store (typically a memory-mapped PHF) with a small
+ *  in-memory delta of appended tokens.  New tokens get ids after the
+ *  largest id in the base, so existing ids never move.  The delta is only
+ *  probed when the KeyFilter says the key might be there.
+ *
+ *  The delta can be persisted next to a compiled base as a tiny PHF of its
+ *  own (see compile_delta), and folded into a new base with compact_vocab.
+ *  Adding tokens is not safe concurrently with lookups
+ */
+class OverlayMapStrInt : public MapStrInt
+{
+    MapStrInt* _base;
+    UnorderedMapStrInt _delta;
+    KeyFilter _filter;
+    Index_T _first_id;
+    Index_T _next_id;
+public:
+    OverlayMapStrInt(MapStrInt* base) : _base(base), _first_id(base->id_bound()), _next_id(_first_id) {
+    }
+    ~OverlayMapStrInt() {
+	delete _base;
+    }
+    const MapStrInt& base() const { return *_base; }
+    const UnorderedMapStrInt& delta() const { return _delta; }
+    /*!
+     * Start appended ids at min_id or later, so that they stay clear of ids
+     * the base does not hold (a vocab's special tokens).  Only has an
+     * effect while nothing has been appended
+     */
+    void reserve_ids(Index_T min_id) {
+	if (num_appended() == 0 && min_id > _first_id) {
+	    _first_id = _next_id = min_id;
+	}
+    }
+    Index_T first_delta_id() const { return _first_id; }
+    // The number of regular tokens appended to the base
+    size_t num_appended() const { return _next_id - _first_id; }
+
+    /*!
+     * Append a token, returning its id.  Tokens already present keep
+     * their existing id
+     */
+    Index_T add(const std::string& key) {
+	bool found;
+	Index_T x;
+	std::tie(found, x) = find(key);
+	if (found) {
+	    return x;
+	}
+	x = _next_id++;
+	_delta[key] = x;
+	_filter.add(key);
+	return x;
+    }
+    // Used when reading a persisted delta or adding special tokens, ids are taken as-is
+    void add(const std::string& key, Index_T id) {
+	_delta[key] = id;
+	_filter.add(key);
+	if (!is_special_id(id)) {
+	    _next_id = std::max<Index_T>(_next_id, id + 1);
+	}
+    }
+
+    // Look in the appended tokens only
+    bool find_delta(const std::string& key, Index_T& x) const {
+	if (!_filter.may_contain(key)) {
+	    return false;
+	}
+	bool found;
+	std::tie(found, x) = _delta.UnorderedMapStrInt::find(key);
+	return found;
+    }
+    std::tuple<bool, Index_T> find(const std::string& key) const {
+	Index_T x;
+	if (find_delta(key, x)) {
+	    return std::make_tuple(true, x);
+	}
+	return _base->find(key);
+    }
+    std::tuple<bool, std::string> rfind(const Index_T idx) const {
+	if (idx >= _first_id && idx < _next_id) {
+	    return _delta.rfind(idx);
+	}
+	return _base->rfind(idx);
+    }
+    bool exists(const std::string& key) const {
+	return (_filter.may_contain(key) && _delta.exists(key)) || _base->exists(key);
+    }
+    void for_each(const std::function<void(const std::string&, Index_T)>& fn) const {
+	_base->for_each(fn);
+	_delta.for_each(fn);
+    }
+    size_t size() const { return _base->size() + num_appended(); }
+    size_t max_size() const { return _base->max_size(); }
+    Index_T id_bound() const { return _next_id; }
+
+    /*!
+     * Write the delta as its own compiled store.  Ids are stored relative
+     * to the first delta id (kept in first_id.txt) so the side file stays
+     * as small as the delta
+     */
+    void compile_delta(const std::string& dir) const {
+	if (!file_exists(dir)) {
+	    make_dir(dir);
+	}
+	UnorderedMapStrInt rebased;
+	_delta.for_each([&](const std::string& k, Index_T v) { rebased[k] = v - _first_id; });
+	compile_str_int(rebased, dir);
+	std::ofstream ofs(file_in_dir(dir, "first_id.txt"));
+	ofs << _first_id << std::endl;
+    }
+    /*!
+     * Read a delta written by compile_delta into this overlay
+     */
+    void load_delta(const std::string& dir) {
+	std::ifstream ifs(file_in_dir(dir, "first_id.txt"));
+	Index_T first_id = 0;
+	if (!(ifs >> first_id)) {
+	    throw std::runtime_error("No delta id range in " + dir);
+	}
+	reserve_ids(first_id);
+	MapStrInt* d = open_perfect_hash_str_int(dir);
+	d->for_each([&](const std::string& k, Index_T v) { add(k, v + first_id); });
+	delete d;
+    }
+};
+
+/*!
+ *  A map whose concrete type is known at compile time, bound to one that
+ *  is held through its interface (MapStrInt or MapStrStr).  find() is
+ *  called by qualified name, so it skips the vtable and can be inlined.
+ *  It has the find() and size() the BPE and lookup templates use
+ */
+template<typename Map_T>
+class StaticMap
+{
+    const Map_T* _m;
+public:
+    StaticMap() : _m(NULL) {}
+
+    // False if the map is not a Map_T
+    template<typename Interface_T>
+    bool bind(const Interface_T* m) {
+	_m = dynamic_cast<const Map_T*>(m);
+	return _m != NULL;
+    }
+    auto find(const std::string& key) const -> decltype(_m->find(key)) {
+	return _m->Map_T::find(key);
+    }
+    size_t size() const { return _m->Map_T::size(); }
+};
+
+/*!
+ *  A StaticMap for an OverlayMapStrInt over a Base_T, which is how a
+ *  compiled vocab is held once its special tokens are added
+ */
+template<typename Base_T>
+class StaticOverlayMap
+{
+    const OverlayMapStrInt* _overlay;
+    const Base_T* _base;
+public:
+    StaticOverlayMap() : _overlay(NULL), _base(NULL) {}
+
+    bool bind(const MapStrInt* m) {
+	_overlay = dynamic_cast<const OverlayMapStrInt*>(m);
+	_base = _overlay != NULL ? dynamic_cast<const Base_T*>(&_overlay->base()) : NULL;
+	return _base != NULL;
+    }
+    std::tuple<bool, Index_T> find(const std::string& key) const {
+	Index_T x;
+	if (_overlay->find_delta(key, x)) {
+	    return std::make_tuple(true, x);
+	}
+	return _base->Base_T::find(key);
+    }
+    size_t size() const { return _overlay->size(); }
+};
 
 #endif
@@ -0,0 +1,302 @@
+#ifndef __VECXX_POOL_H__
+#define __VECXX_POOL_H__
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+#include <exception>
+#if !defined(WIN32) && !defined(_WIN32)
+#include <pthread.h>
+#endif
+#include "vecxx/iox.h"
+
+/*!
+ *  A fixed set of worker threads for splitting batches across cores.
+ *
+ *  Each worker has its own queue.  It takes its newest task first, and
+ *  when its queue is empty it steals the oldest task of another worker, so
+ *  uneven rows (long sentences, BPE-heavy words) even out without a
+ *  central queue everyone contends on.  The threads live as long as the
+ *  pool, so their thread_local scratch (the TransformPipeline buffers) is
+ *  allocated once per worker rather than once per batch.
+ *
+ *  The thread calling parallel_for works on the batch too, and helps with
+ *  queued tasks while it waits, so a pool of N threads runs N + 1 chunks
+ *  at a time and a nested parallel_for cannot deadlock.
+ *
+ *  The workers do not survive a fork.  In a forked child (a data loader
+ *  worker, say) a pool made before the fork runs batches on the calling
+ *  thread, and shared() starts a new one.  The lock behind shared() is
+ *  held across fork(), so the child never gets a copy another thread had
+ *  locked
+ */
+class ThreadPool
+{
+    typedef std::function<void()> Task_T;
+    struct Queue {
+	std::mutex lock;
+	std::deque<Task_T> tasks;
+    };
+    std::vector<std::unique_ptr<Queue> > _queues;
+    std::vector<std::thread> _threads;
+    std::mutex _lock;
+    std::condition_variable _wake;
+    // Tasks queued and not yet taken, across all the queues
+    std::atomic<size_t> _pending;
+    std::atomic<size_t> _next;
+    bool _stop;
+    // The process that started the workers
+    long _pid;
+
+    bool _take(Queue& q, Task_T& task, bool newest) {
+	std::lock_guard<std::mutex> guard(q.lock);
+	if (q.tasks.empty()) {
+	    return false;
+	}
+	if (newest) {
+	    task = std::move(q.tasks.back());
+	    q.tasks.pop_back();
+	}
+	else {
+	    task = std::move(q.tasks.front());
+	    q.tasks.pop_front();
+	}
+	--_pending;
+	return true;
+    }
+
+    // Own queue first, then steal, starting from the next worker along
+    bool _pop(size_t self, Task_T& task) {
+	const size_t n = _queues.size();
+	if (self < n && _take(*_queues[self], task, true)) {
+	    return true;
+	}
+	for (size_t i = 1; i <= n; ++i) {
+	    size_t victim = (self + i) % n;
+	    if (victim != self && _take(*_queues[victim], task, false)) {
+		return true;
+	    }
+	}
+	return false;
+    }
+
+    void _push(Task_T task) {
+	Queue& q = *_queues[_next++ % _queues.size()];
+	{
+	    std::lock_guard<std::mutex> guard(_lock);
+	    std::lock_guard<std::mutex> queue_guard(q.lock);
+	    q.tasks.push_back(std::move(task));
+	    ++_pending;
+	}
+	_wake.notify_one();
+    }
+
+    void _work(size_t self) {
+	Task_T task;
+	while (true) {
+	    if (_pop(self, task)) {
+		task();
+		task = Task_T();
+		continue;
+	    }
+	    std::unique_lock<std::mutex> guard(_lock);
+	    _wake.wait(guard, [this]() { return _stop || _pending > 0; });
+	    if (_stop && _pending == 0) {
+		return;
+	    }
+	}
+    }
+
+public:
+    /*!
+     * Start num_threads workers, or one per core (less the calling thread)
+     * for 0
+     */
+    ThreadPool(size_t num_threads=0) : _pending(0), _next(0), _stop(false), _pid(process_id()) {
+	if (num_threads == 0) {
+	    num_threads = default_num_threads() - 1;
+	}
+	for (size_t i = 0; i < num_threads; ++i) {
+	    _queues.emplace_back(new Queue());
+	}
+	for (size_t i = 0; i < num_threads; ++i) {
+	    _threads.push_back(std::thread(&ThreadPool::_work, this, i));
+	}
+    }
+    ~ThreadPool() {
+	if (forked()) {
+	    // None of it can be cleaned up as is: the threads are not ours to
+	    // join or detach (the child may have reused their descriptors),
+	    // the workers died waiting on _wake (destroying it would wait for
+	    // them), and they may have held the locks.  Construct fresh ones
+	    // over them, without a destructor, for the members' to run on
+	    for (auto& t : _threads) {
+		new (&t) std::thread();
+	    }
+	    new (&_wake) std::condition_variable();
+	    new (&_lock) std::mutex();
+	    for (auto& q : _queues) {
+		new (&q->lock) std::mutex();
+	    }
+	    return;
+	}
+	{
+	    std::lock_guard<std::mutex> guard(_lock);
+	    _stop = true;
+	}
+	_wake.notify_all();
+	for (auto& t : _threads) {
+	    t.join();
+	}
+    }
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // The number of worker threads, not counting callers
+    size_t size() const { return _threads.size(); }
+
+    // True in a child forked after the workers were started
+    bool forked() const { return _pid != process_id(); }
+
+    /*!
+     * Run fn(begin, end) over [0, n) in chunks of about grain items, and
+     * return when all of them are done.  Chunks run in any order and on
+     * any thread, so fn must only write to state owned by its range.  The
+     * first exception thrown by a chunk is rethrown here
+     */
+    template<typename Fn>
+    void parallel_for(size_t n, size_t grain, Fn fn) {
+	grain = std::max<size_t>(1, grain);
+	const size_t num_chunks = (n + grain - 1) / grain;
+	if (num_chunks <= 1 || _threads.empty() || forked()) {
+	    if (n > 0) {
+		fn((size_t)0, n);
+	    }
+	    return;
+	}
+	struct Batch {
+	    std::atomic<size_t> remaining;
+	    std::mutex lock;
+	    std::condition_variable done;
+	    std::exception_ptr error;
+	};
+	auto batch = std::make_shared<Batch>();
+	batch->remaining = num_chunks;
+	auto run = [batch, &fn](size_t begin, size_t end) {
+	    try {
+		fn(begin, end);
+	    }
+	    catch (...) {
+		std::lock_guard<std::mutex> guard(batch->lock);
+		if (!batch->error) {
+		    batch->error = std::current_exception();
+		}
+	    }
+	    if (--batch->remaining == 0) {
+		std::lock_guard<std::mutex> guard(batch->lock);
+		batch->done.notify_all();
+	    }
+	};
+	for (size_t c = 1; c < num_chunks; ++c) {
+	    size_t begin = c * grain;
+	    size_t end = std::min(n, begin + grain);
+	    _push([run, begin, end]() { run(begin, end); });
+	}
+	run(0, std::min(n, grain));
+	// Help out rather than sleep while there is queued work
+	Task_T task;
+	while (batch->remaining > 0 && _pop(_queues.size(), task)) {
+	    task();
+	    task = Task_T();
+	}
+	{
+	    std::unique_lock<std::mutex> guard(batch->lock);
+	    batch->done.wait(guard, [&batch]() { return batch->remaining == 0; });
+	}
+	if (batch->error) {
+	    std::rethrow_exception(batch->error);
+	}
+    }
+
+private:
+    static std::mutex& _shared_lock() {
+	static std::mutex lock;
+	return lock;
+    }
+    static std::shared_ptr<ThreadPool>& _shared_pool() {
+	static std::shared_ptr<ThreadPool> pool;
+	return pool;
+    }
+    // fork() handlers, see shared()
+    static void _before_fork() { _shared_lock().lock(); }
+    static void _after_fork_parent() { _shared_lock().unlock(); }
+    static void _after_fork_child() {
+	_shared_pool().reset();
+	_shared_lock().unlock();
+    }
+
+public:
+    /*!
+     * A pool with a thread per core, shared by everything in the process
+     * that does not ask for its own.  It is started on first use, and
+     * again in a forked child
+     */
+    static std::shared_ptr<ThreadPool> shared() {
+#if !defined(WIN32) && !defined(_WIN32)
+	static std::once_flag at_fork;
+	std::call_once(at_fork, []() {
+		pthread_atfork(&ThreadPool::_before_fork, &ThreadPool::_after_fork_parent, &ThreadPool::_after_fork_child);
+	    });
+#endif
+	std::lock_guard<std::mutex> guard(_shared_lock());
+	auto& pool = _shared_pool();
+	if (!pool || pool->forked()) {
+	    pool = std::make_shared<ThreadPool>();
+	}
+	return pool;
+    }
+};
+
+/*!
+ *  The threads a vectorizer splits the rows of a batch over: 0 (the
+ *  default) for the ThreadPool shared by the process, 1 to stay on the
+ *  calling thread, or more for a pool of its own of that size
+ */
+class RowThreads
+{
+    size_t _num_threads;
+    // The pool for _num_threads, NULL for the shared one
+    std::shared_ptr<ThreadPool> _pool;
+public:
+    RowThreads() : _num_threads(0) {}
+
+    void set_num_threads(size_t num_threads) {
+	_num_threads = num_threads;
+	_pool.reset(num_threads > 1 ? new ThreadPool(num_threads - 1) : NULL);
+    }
+    size_t num_threads() const { return _num_threads; }
+
+    /*!
+     * Run fn(begin, end) over n rows, in parallel chunks if parallel is
+     * set, and on the calling thread otherwise
+     */
+    template<typename Fn>
+    void for_rows(size_t n, bool parallel, Fn fn) const {
+	if (!parallel || _num_threads == 1 || n < 2) {
+	    fn((size_t)0, n);
+	    return;
+	}
+	auto pool = _pool ? _pool : ThreadPool::shared();
+	// A few chunks per thread, so that stealing can even out long rows
+	size_t num_chunks = 4 * (pool->size() + 1);
+	pool->parallel_for(n, (n + num_chunks - 1) / num_chunks, fn);
+    }
+};
+
+#endif
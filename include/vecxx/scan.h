@@ -0,0 +1,334 @@
+#ifndef __VECXX_SCAN_H__
+#define __VECXX_SCAN_H__
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <algorithm>
+#include "vecxx/utils.h"
+#include "vecxx/unicode.h"
+
+/*!
+ *  A span of raw text, [begin, end), which is either a special token or
+ *  ordinary text to be tokenized
+ */
+struct TextSpan {
+    size_t begin;
+    size_t end;
+    bool special;
+};
+typedef std::vector<TextSpan> TextSpanList_T;
+
+/*!
+ *  Find special tokens (<GO>, <EOS>, tags, placeholders) in raw text with
+ *  an Aho-Corasick automaton, so they survive tokenization without a regex
+ *  pass in the calling language.
+ *
+ *  The automaton is a full DFA over byte classes: only bytes that occur in
+ *  some special token get their own column, every other byte shares one,
+ *  so the table stays small even with many tokens.  Matches are leftmost,
+ *  and longest at the same start ("<EOS>" wins over "<E").  Text is
+ *  scanned once; after a match the scan resumes at its end, so at most
+ *  the longest token's length is ever rescanned.
+ *
+ *  Matching is on bytes, and special tokens match anywhere, including
+ *  inside a word ("foo<GO>bar" gives "foo", "<GO>", "bar")
+ */
+class SpecialTokenScanner
+{
+    // Transition table, _num_classes entries per state.  State 0 is the root
+    std::vector<int32_t> _delta;
+    // Length of the longest token that ends at each state, or 0
+    std::vector<uint32_t> _out;
+    uint16_t _class[256];
+    size_t _num_classes;
+    size_t _max_len;
+
+    void _build(const TokenList_T& tokens) {
+	memset(_class, 0, sizeof(_class));
+	_num_classes = 1;
+	_max_len = 0;
+	for (auto& token : tokens) {
+	    for (unsigned char c : token) {
+		if (_class[c] == 0) {
+		    _class[c] = (uint16_t)_num_classes++;
+		}
+	    }
+	}
+	// Class 0 is every byte that is in no token
+	_delta.assign(_num_classes, -1);
+	_out.assign(1, 0);
+	for (auto& token : tokens) {
+	    if (token.empty()) {
+		continue;
+	    }
+	    size_t s = 0;
+	    for (unsigned char c : token) {
+		int32_t& next = _delta[s * _num_classes + _class[c]];
+		if (next < 0) {
+		    next = (int32_t)_out.size();
+		    _out.push_back(0);
+		    _delta.resize(_delta.size() + _num_classes, -1);
+		}
+		s = (size_t)_delta[s * _num_classes + _class[c]];
+	    }
+	    _out[s] = (uint32_t)token.size();
+	    _max_len = std::max(_max_len, token.size());
+	}
+	// Breadth-first, point missing edges along failure links
+	std::vector<int32_t> fail(_out.size(), 0);
+	std::deque<size_t> queue;
+	for (size_t k = 0; k < _num_classes; ++k) {
+	    int32_t& next = _delta[k];
+	    if (next < 0) {
+		next = 0;
+	    }
+	    else {
+		queue.push_back((size_t)next);
+	    }
+	}
+	while (!queue.empty()) {
+	    size_t s = queue.front();
+	    queue.pop_front();
+	    if (_out[s] == 0) {
+		_out[s] = _out[fail[s]];
+	    }
+	    for (size_t k = 0; k < _num_classes; ++k) {
+		int32_t& next = _delta[s * _num_classes + k];
+		int32_t via_fail = _delta[fail[s] * _num_classes + k];
+		if (next < 0) {
+		    next = via_fail;
+		}
+		else {
+		    fail[next] = via_fail;
+		    queue.push_back((size_t)next);
+		}
+	    }
+	}
+    }
+
+public:
+    SpecialTokenScanner(const TokenList_T& tokens) {
+	_build(tokens);
+    }
+    SpecialTokenScanner(const SpecialVocab_T& special_tokens) {
+	TokenList_T tokens;
+	for (auto& kv : special_tokens) {
+	    tokens.push_back(kv.first);
+	}
+	_build(tokens);
+    }
+
+    bool empty() const { return _max_len == 0; }
+
+    /*!
+     * Call fn(begin, end, special) for each span of the text, in order.
+     * Ordinary spans are never empty
+     */
+    void scan(const char* p, size_t n, const std::function<void(size_t, size_t, bool)>& fn) const {
+	size_t emitted = 0;
+	size_t i = 0;
+	while (i < n && !empty()) {
+	    size_t s = 0;
+	    bool have = false;
+	    size_t best_begin = 0, best_end = 0;
+	    for (; i < n; ++i) {
+		s = (size_t)_delta[s * _num_classes + _class[(unsigned char)p[i]]];
+		if (_out[s]) {
+		    size_t begin = i + 1 - _out[s];
+		    // The longest token ending here starts earliest, and
+		    // beats the pending match if it starts no later
+		    if (!have || begin <= best_begin) {
+			best_begin = begin;
+			best_end = i + 1;
+			have = true;
+		    }
+		}
+		// Nothing that ends later can start at or before best_begin
+		if (have && i + 1 >= best_begin + _max_len) {
+		    break;
+		}
+	    }
+	    if (!have) {
+		break;
+	    }
+	    if (best_begin > emitted) {
+		fn(emitted, best_begin, false);
+	    }
+	    fn(best_begin, best_end, true);
+	    emitted = i = best_end;
+	}
+	if (n > emitted) {
+	    fn(emitted, n, false);
+	}
+    }
+
+    TextSpanList_T spans(const std::string& text) const {
+	TextSpanList_T spans;
+	scan(text.data(), text.size(), [&spans](size_t begin, size_t end, bool special) {
+		spans.push_back({begin, end, special});
+	    });
+	return spans;
+    }
+
+    /*!
+     * Split raw text into tokens ready for convert_to_ids: special tokens
+     * are kept whole, and everything else is split on whitespace
+     */
+    TokenList_T tokenize(const std::string& text) const {
+	TokenList_T tokens;
+	const char* p = text.data();
+	scan(p, text.size(), [&tokens, p](size_t begin, size_t end, bool special) {
+		if (special) {
+		    tokens.push_back(std::string(p + begin, end - begin));
+		    return;
+		}
+		size_t start = begin;
+		for (size_t i = begin; i <= end; ++i) {
+		    if (i == end || WHITESPACE.find(p[i]) != std::string::npos) {
+			if (i > start) {
+			    tokens.push_back(std::string(p + start, i - start));
+			}
+			start = i + 1;
+		    }
+		}
+	    });
+	return tokens;
+    }
+};
+
+/*!
+ *  Split raw text into tokens natively, so a whole sentence can be passed
+ *  in as one string.  Special tokens are found first (see
+ *  SpecialTokenScanner) and kept whole, then the rest of the text is split
+ *  on whitespace, and each punctuation character becomes a token of its
+ *  own.
+ *
+ *  Both sets are given as UTF-8 strings of characters.  ASCII ones are
+ *  looked up in a byte table, so text is only decoded if a set has
+ *  characters outside of ASCII
+ */
+class PreTokenizer
+{
+    enum { OTHER = 0, SPACE = 1, PUNCT = 2 };
+    SpecialTokenScanner _scanner;
+    TokenList_T _special_tokens;
+    std::string _whitespace;
+    std::string _punctuation;
+    uint8_t _ascii[128];
+    // Sorted code points of the non-ASCII characters in each set
+    std::vector<uint32_t> _space;
+    std::vector<uint32_t> _punct;
+
+    void _build() {
+	memset(_ascii, OTHER, sizeof(_ascii));
+	_space.clear();
+	_punct.clear();
+	_add(_punctuation, PUNCT, _punct);
+	// Whitespace wins if a character is in both
+	_add(_whitespace, SPACE, _space);
+	std::sort(_space.begin(), _space.end());
+	std::sort(_punct.begin(), _punct.end());
+    }
+    void _add(const std::string& chars, uint8_t kind, std::vector<uint32_t>& wide) {
+	for (size_t i = 0; i < chars.size(); ) {
+	    uint32_t cp;
+	    i += utf8_decode(chars.data() + i, chars.size() - i, cp);
+	    if (cp < 0x80) {
+		_ascii[cp] = kind;
+	    }
+	    else {
+		wide.push_back(cp);
+	    }
+	}
+    }
+    int _kind(const char* p, size_t n, size_t& len) const {
+	unsigned char c = (unsigned char)p[0];
+	len = 1;
+	if (c < 0x80) {
+	    return _ascii[c];
+	}
+	if (_space.empty() && _punct.empty()) {
+	    return OTHER;
+	}
+	uint32_t cp;
+	len = utf8_decode(p, n, cp);
+	if (std::binary_search(_space.begin(), _space.end(), cp)) {
+	    return SPACE;
+	}
+	if (std::binary_search(_punct.begin(), _punct.end(), cp)) {
+	    return PUNCT;
+	}
+	return OTHER;
+    }
+    void _split(const char* p, size_t begin, size_t end, TokenList_T& tokens) const {
+	size_t start = begin;
+	size_t len;
+	for (size_t i = begin; i < end; i += len) {
+	    int kind = _kind(p + i, end - i, len);
+	    if (kind == OTHER) {
+		continue;
+	    }
+	    if (i > start) {
+		tokens.push_back(std::string(p + start, i - start));
+	    }
+	    if (kind == PUNCT) {
+		tokens.push_back(std::string(p + i, len));
+	    }
+	    start = i + len;
+	}
+	if (end > start) {
+	    tokens.push_back(std::string(p + start, end - start));
+	}
+    }
+
+public:
+    PreTokenizer(const TokenList_T& special_tokens=TokenList_T(),
+		 const std::string& whitespace=WHITESPACE,
+		 const std::string& punctuation="") :
+	_scanner(special_tokens),
+	_special_tokens(special_tokens),
+	_whitespace(whitespace),
+	_punctuation(punctuation) {
+	_build();
+    }
+    PreTokenizer(const SpecialVocab_T& special_tokens,
+		 const std::string& whitespace=WHITESPACE,
+		 const std::string& punctuation="") :
+	_scanner(special_tokens),
+	_whitespace(whitespace),
+	_punctuation(punctuation) {
+	for (auto& kv : special_tokens) {
+	    _special_tokens.push_back(kv.first);
+	}
+	_build();
+    }
+
+    const TokenList_T& special_tokens() const { return _special_tokens; }
+    const std::string& whitespace() const { return _whitespace; }
+    const std::string& punctuation() const { return _punctuation; }
+
+    /*!
+     * Append the tokens of the text
+     */
+    void tokenize(const std::string& text, TokenList_T& tokens) const {
+	const char* p = text.data();
+	_scanner.scan(p, text.size(), [this, &tokens, p](size_t begin, size_t end, bool special) {
+		if (special) {
+		    tokens.push_back(std::string(p + begin, end - begin));
+		}
+		else {
+		    _split(p, begin, end, tokens);
+		}
+	    });
+    }
+    TokenList_T tokenize(const std::string& text) const {
+	TokenList_T tokens;
+	tokenize(text, tokens);
+	return tokens;
+    }
+};
+
+#endif
@@ -0,0 +1,436 @@
+#ifndef __VECXX_TRANSFORM_H__
+#define __VECXX_TRANSFORM_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <stdexcept>
+#include "vecxx/utils.h"
+#include "vecxx/unicode.h"
+
+/*!
+ *  A token transform made of a list of steps, such as "nfkc+casefold",
+ *  for vectorizers to hold instead of a Transform_T.
+ *
+ *  Native steps (see native_transform_names()) are compiled together: text
+ *  is decoded once, every step rewrites the same code point buffer, and the
+ *  result is encoded once into a buffer that is reused from call to call.
+ *  On ASCII text every native step is a byte mapping, so they are folded
+ *  into one 128-entry table at construction and run as a single byte loop,
+ *  or with SIMD when the mapping is just lowercasing.
+ *  An empty pipeline, or one that leaves ASCII alone (normalization, digits,
+ *  accents) given ASCII text, returns its input without copying.
+ *
+ *  Foreign steps wrap any other Transform_T, and run in order with the
+ *  native ones
+ */
+class TransformPipeline
+{
+    struct Step {
+	UnicodeStep_T native;
+	Transform_T foreign;
+    };
+    struct Buffers {
+	std::string out;
+	std::vector<uint32_t> cps;
+	std::vector<uint32_t> tmp;
+    };
+    std::vector<Step> _steps;
+    // True when there are no foreign steps
+    bool _native;
+    // True when ASCII text comes out unchanged
+    bool _ascii_identity;
+    // True when all the steps do to ASCII text is lowercase it
+    bool _ascii_lower;
+    // What all the steps together do to an ASCII character, -1 removes it
+    int16_t _ascii[128];
+
+    static Buffers& _buffers() {
+	static thread_local Buffers buffers;
+	return buffers;
+    }
+
+    void _compile() {
+	_native = true;
+	_ascii_identity = true;
+	_ascii_lower = true;
+	for (int c = 0; c < 128; ++c) {
+	    int r = c;
+	    for (auto& step : _steps) {
+		if (r >= 0) {
+		    r = unicode_step_ascii(step.native, r);
+		}
+	    }
+	    _ascii[c] = (int16_t)r;
+	    _ascii_identity = _ascii_identity && r == c;
+	    _ascii_lower = _ascii_lower && r == ((c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c);
+	}
+	for (auto& step : _steps) {
+	    _native = _native && !step.foreign;
+	}
+    }
+
+    void _add_native(UnicodeStep_T step) {
+	if (step != UNICODE_IDENTITY) {
+	    _steps.push_back({step, Transform_T()});
+	}
+    }
+    void _add(const Transform_T& fn) {
+	if (!fn) {
+	    return;
+	}
+	auto p = fn.target<NativeTransform_T>();
+	UnicodeStep_T step;
+	if (p != NULL && native_transform_step(*p, step)) {
+	    _add_native(step);
+	}
+	else {
+	    _steps.push_back({UNICODE_IDENTITY, fn});
+	}
+    }
+
+public:
+    TransformPipeline() {
+	_compile();
+    }
+    /*!
+     * Native steps by name, joined with '+', e.g. "nfkc+casefold"
+     */
+    explicit TransformPipeline(const std::string& spec) {
+	size_t start = 0;
+	for (size_t i = 0; i <= spec.size(); ++i) {
+	    if (i == spec.size() || spec[i] == '+') {
+		if (i == start) {
+		    throw std::runtime_error("Empty step in transform: " + spec);
+		}
+		_add_native(unicode_step(spec.substr(start, i - start)));
+		start = i + 1;
+	    }
+	}
+	_compile();
+    }
+    explicit TransformPipeline(const TokenList_T& names) {
+	for (auto& name : names) {
+	    _add_native(unicode_step(name));
+	}
+	_compile();
+    }
+    /*!
+     * Wrap a Transform_T.  If it holds one of the native transform
+     * functions, the step runs natively, otherwise it is called as is.
+     * An empty Transform_T is the identity
+     */
+    explicit TransformPipeline(const Transform_T& fn) {
+	_add(fn);
+	_compile();
+    }
+
+    TransformPipeline& then(const std::string& name) {
+	_add_native(unicode_step(name));
+	_compile();
+	return *this;
+    }
+    TransformPipeline& then(const Transform_T& fn) {
+	_add(fn);
+	_compile();
+	return *this;
+    }
+
+    bool is_identity() const { return _steps.empty(); }
+    bool is_native() const { return _native; }
+
+    /*!
+     * The step names, with "function" for a foreign step
+     */
+    TokenList_T names() const {
+	TokenList_T names;
+	auto all = native_transform_names();
+	for (auto& step : _steps) {
+	    names.push_back(step.foreign ? std::string("function") : all[step.native]);
+	}
+	return names;
+    }
+
+    /*!
+     * Transform s.  This returns either s itself, when nothing changes, or
+     * a buffer owned by the calling thread that stays valid until its next
+     * call, so callers that keep the result must copy it
+     */
+    const std::string& apply(const std::string& s) const {
+	if (_steps.empty()) {
+	    return s;
+	}
+	Buffers& b = _buffers();
+	size_t i = 0;
+	const size_t n = s.size();
+	if (_native && _ascii_identity) {
+	    if (is_ascii(s)) {
+		return s;
+	    }
+	}
+	else if (_native && _ascii_lower) {
+	    if (is_ascii(s)) {
+		b.out.assign(s);
+		ascii_lower(&b.out[0], n);
+		return b.out;
+	    }
+	}
+	else if (_native) {
+	    b.out.clear();
+	    for (; i < n; ++i) {
+		unsigned char c = (unsigned char)s[i];
+		if (c & 0x80) {
+		    break;
+		}
+		if (_ascii[c] >= 0) {
+		    b.out += (char)_ascii[c];
+		}
+	    }
+	    if (i == n) {
+		return b.out;
+	    }
+	}
+	// Decode once and run the native steps back to back, going through
+	// a string only to call a foreign step
+	const std::string* cur = &s;
+	bool decoded = false;
+	for (auto& step : _steps) {
+	    if (!step.foreign) {
+		if (!decoded) {
+		    utf8_to_cps(*cur, b.cps);
+		    decoded = true;
+		}
+		unicode_apply(step.native, b.cps, b.tmp);
+		continue;
+	    }
+	    if (decoded) {
+		cps_to_utf8(b.cps, b.out);
+		cur = &b.out;
+		decoded = false;
+	    }
+	    b.out = step.foreign(*cur);
+	    cur = &b.out;
+	}
+	if (decoded) {
+	    cps_to_utf8(b.cps, b.out);
+	    cur = &b.out;
+	}
+	return *cur;
+    }
+
+    // So that a pipeline can be passed anywhere a Transform_T is expected
+    std::string operator()(std::string s) const {
+	return apply(s);
+    }
+};
+
+struct TransformCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t size;
+    size_t capacity;
+    double hit_rate() const {
+	return (hits + misses) ? (double)hits / (double)(hits + misses) : 0.0;
+    }
+};
+
+/*!
+ *  A bounded, thread-safe cache of transformed tokens, so that a transform
+ *  written in Python or JS is called once per distinct token rather than
+ *  once per occurrence.
+ *
+ *  The cache is split into shards by hash, each with its own lock and
+ *  least-recently-used eviction, so concurrent callers rarely contend.  The
+ *  transform itself is called with no lock held: two threads missing on the
+ *  same token may both call it, and the second result wins
+ */
+class TransformCache
+{
+    typedef std::list<std::pair<std::string, std::string> > Order_T;
+    struct Shard {
+	std::mutex lock;
+	// Most recently used first
+	Order_T order;
+	std::unordered_map<std::string, Order_T::iterator> index;
+    };
+    std::vector<Shard> _shards;
+    size_t _capacity;
+    size_t _shard_capacity;
+    std::atomic<uint64_t> _hits;
+    std::atomic<uint64_t> _misses;
+    std::atomic<uint64_t> _evictions;
+
+    Shard& _shard(const std::string& key) {
+	return _shards[flat_hash(key.data(), key.size()) % _shards.size()];
+    }
+
+public:
+    static const size_t DEFAULT_CAPACITY = 1 << 16;
+
+    TransformCache(size_t capacity=DEFAULT_CAPACITY) :
+	_shards(std::max<size_t>(1, std::min<size_t>(16, capacity))),
+	_capacity(std::max<size_t>(1, capacity)),
+	_hits(0),
+	_misses(0),
+	_evictions(0) {
+	_shard_capacity = std::max<size_t>(1, _capacity / _shards.size());
+    }
+
+    bool find(const std::string& key, std::string& value) {
+	Shard& shard = _shard(key);
+	std::lock_guard<std::mutex> guard(shard.lock);
+	auto it = shard.index.find(key);
+	if (it == shard.index.end()) {
+	    ++_misses;
+	    return false;
+	}
+	shard.order.splice(shard.order.begin(), shard.order, it->second);
+	value = it->second->second;
+	++_hits;
+	return true;
+    }
+
+    void insert(const std::string& key, const std::string& value) {
+	Shard& shard = _shard(key);
+	std::lock_guard<std::mutex> guard(shard.lock);
+	auto it = shard.index.find(key);
+	if (it != shard.index.end()) {
+	    it->second->second = value;
+	    return;
+	}
+	shard.order.push_front(std::make_pair(key, value));
+	shard.index[key] = shard.order.begin();
+	if (shard.order.size() > _shard_capacity) {
+	    shard.index.erase(shard.order.back().first);
+	    shard.order.pop_back();
+	    ++_evictions;
+	}
+    }
+
+    /*!
+     * The cached transform of s, calling transform and remembering the
+     * result on a miss
+     */
+    std::string apply(const std::string& s, const Transform_T& transform) {
+	std::string value;
+	if (!find(s, value)) {
+	    value = transform(s);
+	    insert(s, value);
+	}
+	return value;
+    }
+
+    void clear() {
+	for (auto& shard : _shards) {
+	    std::lock_guard<std::mutex> guard(shard.lock);
+	    shard.order.clear();
+	    shard.index.clear();
+	}
+	_hits = 0;
+	_misses = 0;
+	_evictions = 0;
+    }
+
+    TransformCacheStats stats() {
+	TransformCacheStats stats;
+	stats.hits = _hits;
+	stats.misses = _misses;
+	stats.evictions = _evictions;
+	stats.size = 0;
+	for (auto& shard : _shards) {
+	    std::lock_guard<std::mutex> guard(shard.lock);
+	    stats.size += shard.order.size();
+	}
+	stats.capacity = _shard_capacity * _shards.size();
+	return stats;
+    }
+};
+
+/*!
+ *  A Transform_T that remembers its results in a TransformCache.  Copies
+ *  share the cache
+ */
+class MemoizedTransform
+{
+    Transform_T _transform;
+    std::shared_ptr<TransformCache> _cache;
+public:
+    MemoizedTransform(const Transform_T& transform,
+		      size_t capacity=TransformCache::DEFAULT_CAPACITY) :
+	_transform(transform),
+	_cache(std::make_shared<TransformCache>(capacity)) {
+    }
+    MemoizedTransform(const Transform_T& transform,
+		      const std::shared_ptr<TransformCache>& cache) :
+	_transform(transform),
+	_cache(cache) {
+    }
+
+    std::string operator()(std::string s) const {
+	return _cache->apply(s, _transform);
+    }
+
+    TransformCache& cache() const { return *_cache; }
+};
+
+inline const std::string& apply_transform(const TransformPipeline& transform, const std::string& s) {
+    return transform.apply(s);
+}
+
+/*
+ * Transforms fixed at compile time, for VocabVectorizerT.  Each has the
+ * apply() of a TransformPipeline, and matches() tells which pipelines it
+ * can stand in for
+ */
+struct IdentityTransform {
+    static bool matches(const TransformPipeline& transform) {
+	return transform.is_identity();
+    }
+    static TransformPipeline pipeline() {
+	return TransformPipeline();
+    }
+    const std::string& apply(const std::string& s) const {
+	return s;
+    }
+};
+
+/*!
+ *  The native "lower", with the ASCII check and SIMD lowercasing inlined.
+ *  Other text goes through the pipeline
+ */
+class LowerTransform {
+    TransformPipeline _lower;
+public:
+    LowerTransform() : _lower(pipeline()) {}
+
+    static bool matches(const TransformPipeline& transform) {
+	return transform.is_native() && transform.names() == TokenList_T{"lower"};
+    }
+    static TransformPipeline pipeline() {
+	return TransformPipeline("lower");
+    }
+    const std::string& apply(const std::string& s) const {
+	if (!is_ascii(s)) {
+	    return _lower.apply(s);
+	}
+	static thread_local std::string out;
+	out.assign(s);
+	ascii_lower(&out[0], out.size());
+	return out;
+    }
+};
+
+inline const std::string& apply_transform(const IdentityTransform&, const std::string& s) {
+    return s;
+}
+inline const std::string& apply_transform(const LowerTransform& transform, const std::string& s) {
+    return transform.apply(s);
+}
+
+#endif
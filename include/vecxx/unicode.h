@@ -0,0 +1,489 @@
+#ifndef __VECXX_UNICODE_H__
+#define __VECXX_UNICODE_H__
+
+/*
+ * Native Unicode transforms: lowercasing, case folding, normalization
+ * (NFC, NFD, NFKC, NFKD), accent stripping, control character removal and
+ * digit normalization, so the per-token transform never has to leave C++.
+ *
+ * They all have the signature of a plain Transform_T function, and can be
+ * picked by name with native_transform().  ASCII input, by far the common
+ * case, takes a byte loop and never decodes.
+ *
+ * Bytes that are not valid UTF-8 are passed through untouched.  The data
+ * tables in unicode_tables.h are generated by tools/gen_unicode_tables.py
+ */
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "vecxx/utils.h"
+#include "vecxx/unicode_tables.h"
+
+// Invalid UTF-8 bytes are decoded to this plus the byte, and re-encoded as-is
+const uint32_t UTF8_RAW_BYTE = 0x110000;
+
+const uint32_t HANGUL_S_BASE = 0xAC00;
+const uint32_t HANGUL_L_BASE = 0x1100;
+const uint32_t HANGUL_V_BASE = 0x1161;
+const uint32_t HANGUL_T_BASE = 0x11A7;
+const uint32_t HANGUL_L_COUNT = 19;
+const uint32_t HANGUL_V_COUNT = 21;
+const uint32_t HANGUL_T_COUNT = 28;
+const uint32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+const uint32_t HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+/*!
+ * Decode one code point, returning the number of bytes used
+ */
+inline size_t utf8_decode(const char* s, size_t n, uint32_t& cp) {
+    const unsigned char* p = (const unsigned char*)s;
+    unsigned char c = p[0];
+    size_t len = 0;
+    uint32_t min = 0;
+    if (c < 0x80) {
+	cp = c;
+	return 1;
+    }
+    else if ((c & 0xE0) == 0xC0) {
+	len = 2; cp = c & 0x1F; min = 0x80;
+    }
+    else if ((c & 0xF0) == 0xE0) {
+	len = 3; cp = c & 0x0F; min = 0x800;
+    }
+    else if ((c & 0xF8) == 0xF0) {
+	len = 4; cp = c & 0x07; min = 0x10000;
+    }
+    if (len == 0 || len > n) {
+	cp = UTF8_RAW_BYTE + c;
+	return 1;
+    }
+    for (size_t i = 1; i < len; ++i) {
+	if ((p[i] & 0xC0) != 0x80) {
+	    cp = UTF8_RAW_BYTE + c;
+	    return 1;
+	}
+	cp = (cp << 6) | (p[i] & 0x3F);
+    }
+    // Overlong forms, surrogates and out of range values are not valid
+    if (cp < min || cp >= 0x110000 || (cp >= 0xD800 && cp < 0xE000)) {
+	cp = UTF8_RAW_BYTE + c;
+	return 1;
+    }
+    return len;
+}
+
+inline void utf8_append(std::string& out, uint32_t cp) {
+    if (cp < 0x80) {
+	out += (char)cp;
+    }
+    else if (cp < 0x800) {
+	out += (char)(0xC0 | (cp >> 6));
+	out += (char)(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x10000) {
+	out += (char)(0xE0 | (cp >> 12));
+	out += (char)(0x80 | ((cp >> 6) & 0x3F));
+	out += (char)(0x80 | (cp & 0x3F));
+    }
+    else if (cp < UTF8_RAW_BYTE) {
+	out += (char)(0xF0 | (cp >> 18));
+	out += (char)(0x80 | ((cp >> 12) & 0x3F));
+	out += (char)(0x80 | ((cp >> 6) & 0x3F));
+	out += (char)(0x80 | (cp & 0x3F));
+    }
+    else {
+	out += (char)(cp - UTF8_RAW_BYTE);
+    }
+}
+
+void utf8_to_cps(const std::string& s, std::vector<uint32_t>& cps) {
+    cps.clear();
+    for (size_t i = 0; i < s.size(); ) {
+	uint32_t cp;
+	i += utf8_decode(s.data() + i, s.size() - i, cp);
+	cps.push_back(cp);
+    }
+}
+
+void cps_to_utf8(const std::vector<uint32_t>& cps, std::string& out) {
+    out.clear();
+    out.reserve(cps.size());
+    for (auto cp : cps) {
+	utf8_append(out, cp);
+    }
+}
+
+std::string cps_to_utf8(const std::vector<uint32_t>& cps) {
+    std::string out;
+    cps_to_utf8(cps, out);
+    return out;
+}
+
+// Index of cp in a sorted key table, or -1
+inline long _uni_find(const uint32_t* keys, size_t n, uint32_t cp) {
+    const uint32_t* it = std::lower_bound(keys, keys + n, cp);
+    return (it != keys + n && *it == cp) ? (long)(it - keys) : -1;
+}
+
+// Index of the range holding cp in a table of (first, last, ...) rows, or -1
+inline long _uni_find_range(const uint32_t* rows, size_t n, size_t stride, uint32_t cp) {
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+	size_t mid = (lo + hi) / 2;
+	if (rows[mid * stride + 1] < cp) {
+	    lo = mid + 1;
+	}
+	else {
+	    hi = mid;
+	}
+    }
+    return (lo < n && rows[lo * stride] <= cp) ? (long)lo : -1;
+}
+
+// Append the mapping of cp from a generated map table, or cp itself
+inline void _uni_map(const uint32_t* keys, const uint32_t* vals, const uint32_t* pool, size_t n,
+		     uint32_t cp, std::vector<uint32_t>& out) {
+    long i = _uni_find(keys, n, cp);
+    if (i < 0) {
+	out.push_back(cp);
+	return;
+    }
+    const uint32_t* p = pool + (vals[i] >> 8);
+    out.insert(out.end(), p, p + (vals[i] & 0xFF));
+}
+
+inline uint32_t unicode_ccc(uint32_t cp) {
+    if (cp < 0x300) {
+	return 0;
+    }
+    long i = _uni_find_range(UNI_CCC, UNI_CCC_SIZE, 3, cp);
+    return i < 0 ? 0 : UNI_CCC[i * 3 + 2];
+}
+
+inline bool unicode_is_mark(uint32_t cp) {
+    return cp >= 0x300 && _uni_find_range(UNI_MN, UNI_MN_SIZE, 2, cp) >= 0;
+}
+
+inline bool unicode_is_control(uint32_t cp) {
+    return _uni_find_range(UNI_CONTROL, UNI_CONTROL_SIZE, 2, cp) >= 0;
+}
+
+// The value of a decimal digit, or -1
+inline int unicode_digit(uint32_t cp) {
+    long i = _uni_find_range(UNI_DIGIT, UNI_DIGIT_SIZE, 3, cp);
+    return i < 0 ? -1 : (int)(cp - UNI_DIGIT[i * 3 + 2]);
+}
+
+// The primary composite of a pair, or 0
+inline uint32_t unicode_compose(uint32_t a, uint32_t b) {
+    if (a >= HANGUL_L_BASE && a < HANGUL_L_BASE + HANGUL_L_COUNT &&
+	b >= HANGUL_V_BASE && b < HANGUL_V_BASE + HANGUL_V_COUNT) {
+	return HANGUL_S_BASE + ((a - HANGUL_L_BASE) * HANGUL_V_COUNT + (b - HANGUL_V_BASE)) * HANGUL_T_COUNT;
+    }
+    if (a >= HANGUL_S_BASE && a < HANGUL_S_BASE + HANGUL_S_COUNT && (a - HANGUL_S_BASE) % HANGUL_T_COUNT == 0 &&
+	b > HANGUL_T_BASE && b < HANGUL_T_BASE + HANGUL_T_COUNT) {
+	return a + (b - HANGUL_T_BASE);
+    }
+    if (a >= UTF8_RAW_BYTE || b >= UTF8_RAW_BYTE) {
+	return 0;
+    }
+    uint64_t key = ((uint64_t)a << 21) | b;
+    const uint64_t* it = std::lower_bound(UNI_COMPOSE_KEYS, UNI_COMPOSE_KEYS + UNI_COMPOSE_SIZE, key);
+    if (it == UNI_COMPOSE_KEYS + UNI_COMPOSE_SIZE || *it != key) {
+	return 0;
+    }
+    return UNI_COMPOSE_VALS[it - UNI_COMPOSE_KEYS];
+}
+
+/*!
+ * Fully decompose the code points, canonically or for compatibility, and
+ * put combining marks in canonical order
+ */
+void unicode_decompose(const std::vector<uint32_t>& in, std::vector<uint32_t>& out, bool compat) {
+    out.clear();
+    out.reserve(in.size());
+    for (auto cp : in) {
+	if (cp < 0xC0) {
+	    if (compat && cp >= 0xA0) {
+		_uni_map(UNI_NFKD_KEYS, UNI_NFKD_VALS, UNI_NFKD_POOL, UNI_NFKD_SIZE, cp, out);
+	    }
+	    else {
+		out.push_back(cp);
+	    }
+	}
+	else if (cp >= HANGUL_S_BASE && cp < HANGUL_S_BASE + HANGUL_S_COUNT) {
+	    uint32_t s = cp - HANGUL_S_BASE;
+	    out.push_back(HANGUL_L_BASE + s / HANGUL_N_COUNT);
+	    out.push_back(HANGUL_V_BASE + (s % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+	    if (s % HANGUL_T_COUNT) {
+		out.push_back(HANGUL_T_BASE + s % HANGUL_T_COUNT);
+	    }
+	}
+	else if (compat && _uni_find(UNI_NFKD_KEYS, UNI_NFKD_SIZE, cp) >= 0) {
+	    _uni_map(UNI_NFKD_KEYS, UNI_NFKD_VALS, UNI_NFKD_POOL, UNI_NFKD_SIZE, cp, out);
+	}
+	else {
+	    _uni_map(UNI_NFD_KEYS, UNI_NFD_VALS, UNI_NFD_POOL, UNI_NFD_SIZE, cp, out);
+	}
+    }
+    // Canonical ordering: a stable sort of each run of non-starters
+    for (size_t i = 1; i < out.size(); ++i) {
+	uint32_t ccc = unicode_ccc(out[i]);
+	if (ccc == 0) {
+	    continue;
+	}
+	for (size_t j = i; j > 0 && unicode_ccc(out[j - 1]) > ccc; --j) {
+	    std::swap(out[j - 1], out[j]);
+	}
+    }
+}
+
+/*!
+ * Canonical composition of decomposed, ordered code points, in place
+ */
+void unicode_compose(std::vector<uint32_t>& cps) {
+    if (cps.empty()) {
+	return;
+    }
+    size_t starter = 0;
+    size_t n = 1;
+    uint32_t last_ccc = unicode_ccc(cps[0]) ? 256 : 0;
+    for (size_t i = 1; i < cps.size(); ++i) {
+	uint32_t cp = cps[i];
+	uint32_t ccc = unicode_ccc(cp);
+	// Composes with the starter unless a mark of the same or higher
+	// class is in between.  A last class of 0 means it is the starter
+	if (last_ccc == 0 || last_ccc < ccc) {
+	    uint32_t composite = unicode_compose(cps[starter], cp);
+	    if (composite) {
+		cps[starter] = composite;
+		continue;
+	    }
+	}
+	if (ccc == 0) {
+	    starter = n;
+	}
+	last_ccc = ccc;
+	cps[n++] = cp;
+    }
+    cps.resize(n);
+}
+
+/*!
+ * The native transforms as steps, so that several can be run over one
+ * decoded buffer (see TransformPipeline)
+ */
+enum UnicodeStep_T {
+    UNICODE_IDENTITY,
+    UNICODE_LOWER,
+    UNICODE_CASEFOLD,
+    UNICODE_NFC,
+    UNICODE_NFD,
+    UNICODE_NFKC,
+    UNICODE_NFKD,
+    UNICODE_STRIP_ACCENTS,
+    UNICODE_REMOVE_CONTROL,
+    UNICODE_ASCII_DIGITS
+};
+
+/*!
+ * The names that native_transform() accepts, in UnicodeStep_T order
+ */
+TokenList_T native_transform_names() {
+    return {"identity", "lower", "casefold", "nfc", "nfd", "nfkc", "nfkd",
+	    "strip_accents", "remove_control", "ascii_digits"};
+}
+
+UnicodeStep_T unicode_step(const std::string& name) {
+    auto names = native_transform_names();
+    for (size_t i = 0; i < names.size(); ++i) {
+	if (names[i] == name) {
+	    return (UnicodeStep_T)i;
+	}
+    }
+    throw std::runtime_error("Unknown transform: " + name);
+}
+
+/*!
+ * What a step does to an ASCII character: the new character, or -1 if it
+ * is removed.  No step maps ASCII outside of ASCII
+ */
+inline int unicode_step_ascii(UnicodeStep_T step, int c) {
+    switch (step) {
+    case UNICODE_LOWER:
+    case UNICODE_CASEFOLD:
+	return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+    case UNICODE_REMOVE_CONTROL:
+	return unicode_is_control((uint32_t)c) ? -1 : c;
+    default:
+	return c;
+    }
+}
+
+/*!
+ * Run a step over decoded code points in place.  tmp is scratch space,
+ * passed in so that callers can reuse it
+ */
+void unicode_apply(UnicodeStep_T step, std::vector<uint32_t>& cps, std::vector<uint32_t>& tmp) {
+    switch (step) {
+    case UNICODE_LOWER:
+	tmp.clear();
+	tmp.reserve(cps.size());
+	for (auto cp : cps) {
+	    _uni_map(UNI_LOWER_KEYS, UNI_LOWER_VALS, UNI_LOWER_POOL, UNI_LOWER_SIZE, cp, tmp);
+	}
+	cps.swap(tmp);
+	break;
+    case UNICODE_CASEFOLD:
+	tmp.clear();
+	tmp.reserve(cps.size());
+	for (auto cp : cps) {
+	    _uni_map(UNI_CASEFOLD_KEYS, UNI_CASEFOLD_VALS, UNI_CASEFOLD_POOL, UNI_CASEFOLD_SIZE, cp, tmp);
+	}
+	cps.swap(tmp);
+	break;
+    case UNICODE_NFD:
+    case UNICODE_NFKD:
+	unicode_decompose(cps, tmp, step == UNICODE_NFKD);
+	cps.swap(tmp);
+	break;
+    case UNICODE_NFC:
+    case UNICODE_NFKC:
+	unicode_decompose(cps, tmp, step == UNICODE_NFKC);
+	cps.swap(tmp);
+	unicode_compose(cps);
+	break;
+    case UNICODE_STRIP_ACCENTS:
+	unicode_decompose(cps, tmp, false);
+	cps.swap(tmp);
+	cps.erase(std::remove_if(cps.begin(), cps.end(), unicode_is_mark), cps.end());
+	unicode_compose(cps);
+	break;
+    case UNICODE_REMOVE_CONTROL:
+	cps.erase(std::remove_if(cps.begin(), cps.end(), unicode_is_control), cps.end());
+	break;
+    case UNICODE_ASCII_DIGITS:
+	for (auto& cp : cps) {
+	    int d = cp >= 0x80 ? unicode_digit(cp) : -1;
+	    if (d >= 0) {
+		cp = '0' + d;
+	    }
+	}
+	break;
+    default:
+	break;
+    }
+}
+
+std::string _unicode_run(UnicodeStep_T step, std::string s) {
+    if (is_ascii(s)) {
+	size_t n = 0;
+	for (char c : s) {
+	    int r = unicode_step_ascii(step, c);
+	    if (r >= 0) {
+		s[n++] = (char)r;
+	    }
+	}
+	s.resize(n);
+	return s;
+    }
+    std::vector<uint32_t> cps, tmp;
+    utf8_to_cps(s, cps);
+    unicode_apply(step, cps, tmp);
+    return cps_to_utf8(cps);
+}
+
+std::string unicode_nfd(std::string s) {
+    return _unicode_run(UNICODE_NFD, std::move(s));
+}
+
+std::string unicode_nfkd(std::string s) {
+    return _unicode_run(UNICODE_NFKD, std::move(s));
+}
+
+std::string unicode_nfc(std::string s) {
+    return _unicode_run(UNICODE_NFC, std::move(s));
+}
+
+std::string unicode_nfkc(std::string s) {
+    return _unicode_run(UNICODE_NFKC, std::move(s));
+}
+
+/*!
+ * Full Unicode lowercasing, as str.lower() in Python, except that a
+ * final capital sigma becomes the ordinary small sigma
+ */
+std::string unicode_lower(std::string s) {
+    return _unicode_run(UNICODE_LOWER, std::move(s));
+}
+
+/*!
+ * Full case folding, as str.casefold() in Python ("Straße" -> "strasse")
+ */
+std::string unicode_casefold(std::string s) {
+    return _unicode_run(UNICODE_CASEFOLD, std::move(s));
+}
+
+/*!
+ * Remove accents: decompose, drop the nonspacing marks and recompose
+ * what is left ("café" -> "cafe")
+ */
+std::string unicode_strip_accents(std::string s) {
+    return _unicode_run(UNICODE_STRIP_ACCENTS, std::move(s));
+}
+
+/*!
+ * Remove control and format characters (Cc and Cf), except tab, LF and CR
+ */
+std::string unicode_remove_control(std::string s) {
+    return _unicode_run(UNICODE_REMOVE_CONTROL, std::move(s));
+}
+
+/*!
+ * Replace every decimal digit ("٣", "３") with its ASCII digit
+ */
+std::string unicode_ascii_digits(std::string s) {
+    return _unicode_run(UNICODE_ASCII_DIGITS, std::move(s));
+}
+
+typedef std::string (*NativeTransform_T)(std::string);
+
+std::string identity_transform(std::string s) {
+    return s;
+}
+
+NativeTransform_T native_transform(UnicodeStep_T step) {
+    static const NativeTransform_T transforms[] = {
+	identity_transform, unicode_lower, unicode_casefold, unicode_nfc, unicode_nfd,
+	unicode_nfkc, unicode_nfkd, unicode_strip_accents, unicode_remove_control,
+	unicode_ascii_digits
+    };
+    return transforms[step];
+}
+
+/*!
+ * Look up a native transform by name.  The result is a plain function,
+ * so the bindings can hand it back to C++ without wrapping it
+ */
+NativeTransform_T native_transform(const std::string& name) {
+    return native_transform(unicode_step(name));
+}
+
+/*!
+ * The step a native transform function runs, if it is one.  This is how
+ * a TransformPipeline built from a plain Transform_T finds out that it
+ * can run natively
+ */
+bool native_transform_step(NativeTransform_T fn, UnicodeStep_T& step) {
+    for (int i = UNICODE_IDENTITY; i <= UNICODE_ASCII_DIGITS; ++i) {
+	if (native_transform((UnicodeStep_T)i) == fn) {
+	    step = (UnicodeStep_T)i;
+	    return true;
+	}
+    }
+    return false;
+}
+
+#endif
@@ -0,0 +1,2889 @@
+#ifndef __VECXX_UNICODE_TABLES_H__
+#define __VECXX_UNICODE_TABLES_H__
+
+/*
+ * Generated by tools/gen_unicode_tables.py from the Unicode 14.0.0 data
+ * in Python 3.11 unicodedata.  Do not edit
+ */
+#include <cstdint>
+#include <cstddef>
+
+#define VECXX_UNICODE_VERSION "14.0.0"
+
+// Full lowercase mappings (str.lower), without final sigma
+static const size_t UNI_LOWER_SIZE = 1433;
+static const uint32_t UNI_LOWER_KEYS[] = {
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+    77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+    89, 90, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201,
+    202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213,
+    214, 216, 217, 218, 219, 220, 221, 222, 256, 258, 260, 262,
+    264, 266, 268, 270, 272, 274, 276, 278, 280, 282, 284, 286,
+    288, 290, 292, 294, 296, 298, 300, 302, 304, 306, 308, 310,
+    313, 315, 317, 319, 321, 323, 325, 327, 330, 332, 334, 336,
+    338, 340, 342, 344, 346, 348, 350, 352, 354, 356, 358, 360,
+    362, 364, 366, 368, 370, 372, 374, 376, 377, 379, 381, 385,
+    386, 388, 390, 391, 393, 394, 395, 398, 399, 400, 401, 403,
+    404, 406, 407, 408, 412, 413, 415, 416, 418, 420, 422, 423,
+    425, 428, 430, 431, 433, 434, 435, 437, 439, 440, 444, 452,
+    453, 455, 456, 458, 459, 461, 463, 465, 467, 469, 471, 473,
+    475, 478, 480, 482, 484, 486, 488, 490, 492, 494, 497, 498,
+    500, 502, 503, 504, 506, 508, 510, 512, 514, 516, 518, 520,
+    522, 524, 526, 528, 530, 532, 534, 536, 538, 540, 542, 544,
+    546, 548, 550, 552, 554, 556, 558, 560, 562, 570, 571, 573,
+    574, 577, 579, 580, 581, 582, 584, 586, 588, 590, 880, 882,
+    886, 895, 902, 904, 905, 906, 908, 910, 911, 913, 914, 915,
+    916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 931, 932, 933, 934, 935, 936, 937, 938, 939, 975,
+    984, 986, 988, 990, 992, 994, 996, 998, 1000, 1002, 1004, 1006,
+    1012, 1015, 1017, 1018, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+    1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
+    1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
+    1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+    1065, 1066, 1067, 1068, 1069, 1070, 1071, 1120, 1122, 1124, 1126, 1128,
+    1130, 1132, 1134, 1136, 1138, 1140, 1142, 1144, 1146, 1148, 1150, 1152,
+    1162, 1164, 1166, 1168, 1170, 1172, 1174, 1176, 1178, 1180, 1182, 1184,
+    1186, 1188, 1190, 1192, 1194, 1196, 1198, 1200, 1202, 1204, 1206, 1208,
+    1210, 1212, 1214, 1216, 1217, 1219, 1221, 1223, 1225, 1227, 1229, 1232,
+    1234, 1236, 1238, 1240, 1242, 1244, 1246, 1248, 1250, 1252, 1254, 1256,
+    1258, 1260, 1262, 1264, 1266, 1268, 1270, 1272, 1274, 1276, 1278, 1280,
+    1282, 1284, 1286, 1288, 1290, 1292, 1294, 1296, 1298, 1300, 1302, 1304,
+    1306, 1308, 1310, 1312, 1314, 1316, 1318, 1320, 1322, 1324, 1326, 1329,
+    1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341,
+    1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
+    1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365,
+    1366, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266,
+    4267, 4268, 4269, 4270, 4271, 4272, 4273, 4274, 4275, 4276, 4277, 4278,
+    4279, 4280, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288, 4289, 4290,
+    4291, 4292, 4293, 4295, 4301, 5024, 5025, 5026, 5027, 5028, 5029, 5030,
+    5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041, 5042,
+    5043, 5044, 5045, 5046, 5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054,
+    5055, 5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066,
+    5067, 5068, 5069, 5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078,
+    5079, 5080, 5081, 5082, 5083, 5084, 5085, 5086, 5087, 5088, 5089, 5090,
+    5091, 5092, 5093, 5094, 5095, 5096, 5097, 5098, 5099, 5100, 5101, 5102,
+    5103, 5104, 5105, 5106, 5107, 5108, 5109, 7312, 7313, 7314, 7315, 7316,
+    7317, 7318, 7319, 7320, 7321, 7322, 7323, 7324, 7325, 7326, 7327, 7328,
+    7329, 7330, 7331, 7332, 7333, 7334, 7335, 7336, 7337, 7338, 7339, 7340,
+    7341, 7342, 7343, 7344, 7345, 7346, 7347, 7348, 7349, 7350, 7351, 7352,
+    7353, 7354, 7357, 7358, 7359, 7680, 7682, 7684, 7686, 7688, 7690, 7692,
+    7694, 7696, 7698, 7700, 7702, 7704, 7706, 7708, 7710, 7712, 7714, 7716,
+    7718, 7720, 7722, 7724, 7726, 7728, 7730, 7732, 7734, 7736, 7738, 7740,
+    7742, 7744, 7746, 7748, 7750, 7752, 7754, 7756, 7758, 7760, 7762, 7764,
+    7766, 7768, 7770, 7772, 7774, 7776, 7778, 7780, 7782, 7784, 7786, 7788,
+    7790, 7792, 7794, 7796, 7798, 7800, 7802, 7804, 7806, 7808, 7810, 7812,
+    7814, 7816, 7818, 7820, 7822, 7824, 7826, 7828, 7838, 7840, 7842, 7844,
+    7846, 7848, 7850, 7852, 7854, 7856, 7858, 7860, 7862, 7864, 7866, 7868,
+    7870, 7872, 7874, 7876, 7878, 7880, 7882, 7884, 7886, 7888, 7890, 7892,
+    7894, 7896, 7898, 7900, 7902, 7904, 7906, 7908, 7910, 7912, 7914, 7916,
+    7918, 7920, 7922, 7924, 7926, 7928, 7930, 7932, 7934, 7944, 7945, 7946,
+    7947, 7948, 7949, 7950, 7951, 7960, 7961, 7962, 7963, 7964, 7965, 7976,
+    7977, 7978, 7979, 7980, 7981, 7982, 7983, 7992, 7993, 7994, 7995, 7996,
+    7997, 7998, 7999, 8008, 8009, 8010, 8011, 8012, 8013, 8025, 8027, 8029,
+    8031, 8040, 8041, 8042, 8043, 8044, 8045, 8046, 8047, 8072, 8073, 8074,
+    8075, 8076, 8077, 8078, 8079, 8088, 8089, 8090, 8091, 8092, 8093, 8094,
+    8095, 8104, 8105, 8106, 8107, 8108, 8109, 8110, 8111, 8120, 8121, 8122,
+    8123, 8124, 8136, 8137, 8138, 8139, 8140, 8152, 8153, 8154, 8155, 8168,
+    8169, 8170, 8171, 8172, 8184, 8185, 8186, 8187, 8188, 8486, 8490, 8491,
+    8498, 8544, 8545, 8546, 8547, 8548, 8549, 8550, 8551, 8552, 8553, 8554,
+    8555, 8556, 8557, 8558, 8559, 8579, 9398, 9399, 9400, 9401, 9402, 9403,
+    9404, 9405, 9406, 9407, 9408, 9409, 9410, 9411, 9412, 9413, 9414, 9415,
+    9416, 9417, 9418, 9419, 9420, 9421, 9422, 9423, 11264, 11265, 11266, 11267,
+    11268, 11269, 11270, 11271, 11272, 11273, 11274, 11275, 11276, 11277, 11278, 11279,
+    11280, 11281, 11282, 11283, 11284, 11285, 11286, 11287, 11288, 11289, 11290, 11291,
+    11292, 11293, 11294, 11295, 11296, 11297, 11298, 11299, 11300, 11301, 11302, 11303,
+    11304, 11305, 11306, 11307, 11308, 11309, 11310, 11311, 11360, 11362, 11363, 11364,
+    11367, 11369, 11371, 11373, 11374, 11375, 11376, 11378, 11381, 11390, 11391, 11392,
+    11394, 11396, 11398, 11400, 11402, 11404, 11406, 11408, 11410, 11412, 11414, 11416,
+    11418, 11420, 11422, 11424, 11426, 11428, 11430, 11432, 11434, 11436, 11438, 11440,
+    11442, 11444, 11446, 11448, 11450, 11452, 11454, 11456, 11458, 11460, 11462, 11464,
+    11466, 11468, 11470, 11472, 11474, 11476, 11478, 11480, 11482, 11484, 11486, 11488,
+    11490, 11499, 11501, 11506, 42560, 42562, 42564, 42566, 42568, 42570, 42572, 42574,
+    42576, 42578, 42580, 42582, 42584, 42586, 42588, 42590, 42592, 42594, 42596, 42598,
+    42600, 42602, 42604, 42624, 42626, 42628, 42630, 42632, 42634, 42636, 42638, 42640,
+    42642, 42644, 42646, 42648, 42650, 42786, 42788, 42790, 42792, 42794, 42796, 42798,
+    42802, 42804, 42806, 42808, 42810, 42812, 42814, 42816, 42818, 42820, 42822, 42824,
+    42826, 42828, 42830, 42832, 42834, 42836, 42838, 42840, 42842, 42844, 42846, 42848,
+    42850, 42852, 42854, 42856, 42858, 42860, 42862, 42873, 42875, 42877, 42878, 42880,
+    42882, 42884, 42886, 42891, 42893, 42896, 42898, 42902, 42904, 42906, 42908, 42910,
+    42912, 42914, 42916, 42918, 42920, 42922, 42923, 42924, 42925, 42926, 42928, 42929,
+    42930, 42931, 42932, 42934, 42936, 42938, 42940, 42942, 42944, 42946, 42948, 42949,
+    42950, 42951, 42953, 42960, 42966, 42968, 42997, 65313, 65314, 65315, 65316, 65317,
+    65318, 65319, 65320, 65321, 65322, 65323, 65324, 65325, 65326, 65327, 65328, 65329,
+    65330, 65331, 65332, 65333, 65334, 65335, 65336, 65337, 65338, 66560, 66561, 66562,
+    66563, 66564, 66565, 66566, 66567, 66568, 66569, 66570, 66571, 66572, 66573, 66574,
+    66575, 66576, 66577, 66578, 66579, 66580, 66581, 66582, 66583, 66584, 66585, 66586,
+    66587, 66588, 66589, 66590, 66591, 66592, 66593, 66594, 66595, 66596, 66597, 66598,
+    66599, 66736, 66737, 66738, 66739, 66740, 66741, 66742, 66743, 66744, 66745, 66746,
+    66747, 66748, 66749, 66750, 66751, 66752, 66753, 66754, 66755, 66756, 66757, 66758,
+    66759, 66760, 66761, 66762, 66763, 66764, 66765, 66766, 66767, 66768, 66769, 66770,
+    66771, 66928, 66929, 66930, 66931, 66932, 66933, 66934, 66935, 66936, 66937, 66938,
+    66940, 66941, 66942, 66943, 66944, 66945, 66946, 66947, 66948, 66949, 66950, 66951,
+    66952, 66953, 66954, 66956, 66957, 66958, 66959, 66960, 66961, 66962, 66964, 66965,
+    68736, 68737, 68738, 68739, 68740, 68741, 68742, 68743, 68744, 68745, 68746, 68747,
+    68748, 68749, 68750, 68751, 68752, 68753, 68754, 68755, 68756, 68757, 68758, 68759,
+    68760, 68761, 68762, 68763, 68764, 68765, 68766, 68767, 68768, 68769, 68770, 68771,
+    68772, 68773, 68774, 68775, 68776, 68777, 68778, 68779, 68780, 68781, 68782, 68783,
+    68784, 68785, 68786, 71840, 71841, 71842, 71843, 71844, 71845, 71846, 71847, 71848,
+    71849, 71850, 71851, 71852, 71853, 71854, 71855, 71856, 71857, 71858, 71859, 71860,
+    71861, 71862, 71863, 71864, 71865, 71866, 71867, 71868, 71869, 71870, 71871, 93760,
+    93761, 93762, 93763, 93764, 93765, 93766, 93767, 93768, 93769, 93770, 93771, 93772,
+    93773, 93774, 93775, 93776, 93777, 93778, 93779, 93780, 93781, 93782, 93783, 93784,
+    93785, 93786, 93787, 93788, 93789, 93790, 93791, 125184, 125185, 125186, 125187, 125188,
+    125189, 125190, 125191, 125192, 125193, 125194, 125195, 125196, 125197, 125198, 125199, 125200,
+    125201, 125202, 125203, 125204, 125205, 125206, 125207, 125208, 125209, 125210, 125211, 125212,
+    125213, 125214, 125215, 125216, 125217,
+};
+static const uint32_t UNI_LOWER_VALS[] = {
+    1, 257, 513, 769, 1025, 1281, 1537, 1793, 2049, 2305, 2561, 2817,
+    3073, 3329, 3585, 3841, 4097, 4353, 4609, 4865, 5121, 5377, 5633, 5889,
+    6145, 6401, 6657, 6913, 7169, 7425, 7681, 7937, 8193, 8449, 8705, 8961,
+    9217, 9473, 9729, 9985, 10241, 10497, 10753, 11009, 11265, 11521, 11777, 12033,
+    12289, 12545, 12801, 13057, 13313, 13569, 13825, 14081, 14337, 14593, 14849, 15105,
+    15361, 15617, 15873, 16129, 16385, 16641, 16897, 17153, 17409, 17665, 17921, 18177,
+    18433, 18689, 18945, 19201, 19457, 19713, 19969, 20225, 20482, 20993, 21249, 21505,
+    21761, 22017, 22273, 22529, 22785, 23041, 23297, 23553, 23809, 24065, 24321, 24577,
+    24833, 25089, 25345, 25601, 25857, 26113, 26369, 26625, 26881, 27137, 27393, 27649,
+    27905, 28161, 28417, 28673, 28929, 29185, 29441, 29697, 29953, 30209, 30465, 30721,
+    30977, 31233, 31489, 31745, 32001, 32257, 32513, 32769, 33025, 33281, 33537, 33793,
+    34049, 34305, 34561, 34817, 35073, 35329, 35585, 35841, 36097, 36353, 36609, 36865,
+    37121, 37377, 37633, 37889, 38145, 38401, 38657, 38913, 39169, 39425, 39681, 39937,
+    40193, 40449, 40705, 40961, 41217, 41473, 41729, 41985, 42241, 42497, 42753, 43009,
+    43265, 43521, 43777, 44033, 44289, 44545, 44801, 45057, 45313, 45569, 45825, 46081,
+    46337, 46593, 46849, 47105, 47361, 47617, 47873, 48129, 48385, 48641, 48897, 49153,
+    49409, 49665, 49921, 50177, 50433, 50689, 50945, 51201, 51457, 51713, 51969, 52225,
+    52481, 52737, 52993, 53249, 53505, 53761, 54017, 54273, 54529, 54785, 55041, 55297,
+    55553, 55809, 56065, 56321, 56577, 56833, 57089, 57345, 57601, 57857, 58113, 58369,
+    58625, 58881, 59137, 59393, 59649, 59905, 60161, 60417, 60673, 60929, 61185, 61441,
+    61697, 61953, 62209, 62465, 62721, 62977, 63233, 63489, 63745, 64001, 64257, 64513,
+    64769, 65025, 65281, 65537, 65793, 66049, 66305, 66561, 66817, 67073, 67329, 67585,
+    67841, 68097, 68353, 68609, 68865, 69121, 69377, 69633, 69889, 70145, 70401, 70657,
+    70913, 71169, 71425, 71681, 71937, 72193, 72449, 72705, 72961, 73217, 73473, 73729,
+    73985, 74241, 74497, 74753, 75009, 75265, 75521, 75777, 76033, 76289, 76545, 76801,
+    77057, 77313, 77569, 77825, 78081, 78337, 78593, 78849, 79105, 79361, 79617, 79873,
+    80129, 80385, 80641, 80897, 81153, 81409, 81665, 81921, 82177, 82433, 82689, 82945,
+    83201, 83457, 83713, 83969, 84225, 84481, 84737, 84993, 85249, 85505, 85761, 86017,
+    86273, 86529, 86785, 87041, 87297, 87553, 87809, 88065, 88321, 88577, 88833, 89089,
+    89345, 89601, 89857, 90113, 90369, 90625, 90881, 91137, 91393, 91649, 91905, 92161,
+    92417, 92673, 92929, 93185, 93441, 93697, 93953, 94209, 94465, 94721, 94977, 95233,
+    95489, 95745, 96001, 96257, 96513, 96769, 97025, 97281, 97537, 97793, 98049, 98305,
+    98561, 98817, 99073, 99329, 99585, 99841, 100097, 100353, 100609, 100865, 101121, 101377,
+    101633, 101889, 102145, 102401, 102657, 102913, 103169, 103425, 103681, 103937, 104193, 104449,
+    104705, 104961, 105217, 105473, 105729, 105985, 106241, 106497, 106753, 107009, 107265, 107521,
+    107777, 108033, 108289, 108545, 108801, 109057, 109313, 109569, 109825, 110081, 110337, 110593,
+    110849, 111105, 111361, 111617, 111873, 112129, 112385, 112641, 112897, 113153, 113409, 113665,
+    113921, 114177, 114433, 114689, 114945, 115201, 115457, 115713, 115969, 116225, 116481, 116737,
+    116993, 117249, 117505, 117761, 118017, 118273, 118529, 118785, 119041, 119297, 119553, 119809,
+    120065, 120321, 120577, 120833, 121089, 121345, 121601, 121857, 122113, 122369, 122625, 122881,
+    123137, 123393, 123649, 123905, 124161, 124417, 124673, 124929, 125185, 125441, 125697, 125953,
+    126209, 126465, 126721, 126977, 127233, 127489, 127745, 128001, 128257, 128513, 128769, 129025,
+    129281, 129537, 129793, 130049, 130305, 130561, 130817, 131073, 131329, 131585, 131841, 132097,
+    132353, 132609, 132865, 133121, 133377, 133633, 133889, 134145, 134401, 134657, 134913, 135169,
+    135425, 135681, 135937, 136193, 136449, 136705, 136961, 137217, 137473, 137729, 137985, 138241,
+    138497, 138753, 139009, 139265, 139521, 139777, 140033, 140289, 140545, 140801, 141057, 141313,
+    141569, 141825, 142081, 142337, 142593, 142849, 143105, 143361, 143617, 143873, 144129, 144385,
+    144641, 144897, 145153, 145409, 145665, 145921, 146177, 146433, 146689, 146945, 147201, 147457,
+    147713, 147969, 148225, 148481, 148737, 148993, 149249, 149505, 149761, 150017, 150273, 150529,
+    150785, 151041, 151297, 151553, 151809, 152065, 152321, 152577, 152833, 153089, 153345, 153601,
+    153857, 154113, 154369, 154625, 154881, 155137, 155393, 155649, 155905, 156161, 156417, 156673,
+    156929, 157185, 157441, 157697, 157953, 158209, 158465, 158721, 158977, 159233, 159489, 159745,
+    160001, 160257, 160513, 160769, 161025, 161281, 161537, 161793, 162049, 162305, 162561, 162817,
+    163073, 163329, 163585, 163841, 164097, 164353, 164609, 164865, 165121, 165377, 165633, 165889,
+    166145, 166401, 166657, 166913, 167169, 167425, 167681, 167937, 168193, 168449, 168705, 168961,
+    169217, 169473, 169729, 169985, 170241, 170497, 170753, 171009, 171265, 171521, 171777, 172033,
+    172289, 172545, 172801, 173057, 173313, 173569, 173825, 174081, 174337, 174593, 174849, 175105,
+    175361, 175617, 175873, 176129, 176385, 176641, 176897, 177153, 177409, 177665, 177921, 178177,
+    178433, 178689, 178945, 179201, 179457, 179713, 179969, 180225, 180481, 180737, 180993, 181249,
+    181505, 181761, 182017, 182273, 182529, 182785, 183041, 183297, 183553, 183809, 184065, 184321,
+    184577, 184833, 185089, 185345, 185601, 185857, 186113, 186369, 186625, 186881, 187137, 187393,
+    187649, 187905, 188161, 188417, 188673, 188929, 189185, 189441, 189697, 189953, 190209, 190465,
+    190721, 190977, 191233, 191489, 191745, 192001, 192257, 192513, 192769, 193025, 193281, 193537,
+    193793, 194049, 194305, 194561, 194817, 195073, 195329, 195585, 195841, 196097, 196353, 196609,
+    196865, 197121, 197377, 197633, 197889, 198145, 198401, 198657, 198913, 199169, 199425, 199681,
+    199937, 200193, 200449, 200705, 200961, 201217, 201473, 201729, 201985, 202241, 202497, 202753,
+    203009, 203265, 203521, 203777, 204033, 204289, 204545, 204801, 205057, 205313, 205569, 205825,
+    206081, 206337, 206593, 206849, 207105, 207361, 207617, 207873, 208129, 208385, 208641, 208897,
+    209153, 209409, 209665, 209921, 210177, 210433, 210689, 210945, 211201, 211457, 211713, 211969,
+    212225, 212481, 212737, 212993, 213249, 213505, 213761, 214017, 214273, 214529, 214785, 215041,
+    215297, 215553, 215809, 216065, 216321, 216577, 216833, 217089, 217345, 217601, 217857, 218113,
+    218369, 218625, 218881, 219137, 219393, 219649, 219905, 220161, 220417, 220673, 220929, 221185,
+    221441, 221697, 221953, 222209, 222465, 222721, 222977, 223233, 223489, 223745, 224001, 224257,
+    224513, 224769, 225025, 225281, 225537, 225793, 226049, 226305, 226561, 226817, 227073, 227329,
+    227585, 227841, 228097, 228353, 228609, 228865, 229121, 229377, 229633, 229889, 230145, 230401,
+    230657, 230913, 231169, 231425, 231681, 231937, 232193, 232449, 232705, 232961, 233217, 233473,
+    233729, 233985, 234241, 234497, 234753, 235009, 235265, 235521, 235777, 236033, 236289, 236545,
+    236801, 237057, 237313, 237569, 237825, 238081, 238337, 238593, 238849, 239105, 239361, 239617,
+    239873, 240129, 240385, 240641, 240897, 241153, 241409, 241665, 241921, 242177, 242433, 242689,
+    242945, 243201, 243457, 243713, 243969, 244225, 244481, 244737, 244993, 245249, 245505, 245761,
+    246017, 246273, 246529, 246785, 247041, 247297, 247553, 247809, 248065, 248321, 248577, 248833,
+    249089, 249345, 249601, 249857, 250113, 250369, 250625, 250881, 251137, 251393, 251649, 251905,
+    252161, 252417, 252673, 252929, 253185, 253441, 253697, 253953, 254209, 254465, 254721, 254977,
+    255233, 255489, 255745, 256001, 256257, 256513, 256769, 257025, 257281, 257537, 257793, 258049,
+    258305, 258561, 258817, 259073, 259329, 259585, 259841, 260097, 260353, 260609, 260865, 261121,
+    261377, 261633, 261889, 262145, 262401, 262657, 262913, 263169, 263425, 263681, 263937, 264193,
+    264449, 264705, 264961, 265217, 265473, 265729, 265985, 266241, 266497, 266753, 267009, 267265,
+    267521, 267777, 268033, 268289, 268545, 268801, 269057, 269313, 269569, 269825, 270081, 270337,
+    270593, 270849, 271105, 271361, 271617, 271873, 272129, 272385, 272641, 272897, 273153, 273409,
+    273665, 273921, 274177, 274433, 274689, 274945, 275201, 275457, 275713, 275969, 276225, 276481,
+    276737, 276993, 277249, 277505, 277761, 278017, 278273, 278529, 278785, 279041, 279297, 279553,
+    279809, 280065, 280321, 280577, 280833, 281089, 281345, 281601, 281857, 282113, 282369, 282625,
+    282881, 283137, 283393, 283649, 283905, 284161, 284417, 284673, 284929, 285185, 285441, 285697,
+    285953, 286209, 286465, 286721, 286977, 287233, 287489, 287745, 288001, 288257, 288513, 288769,
+    289025, 289281, 289537, 289793, 290049, 290305, 290561, 290817, 291073, 291329, 291585, 291841,
+    292097, 292353, 292609, 292865, 293121, 293377, 293633, 293889, 294145, 294401, 294657, 294913,
+    295169, 295425, 295681, 295937, 296193, 296449, 296705, 296961, 297217, 297473, 297729, 297985,
+    298241, 298497, 298753, 299009, 299265, 299521, 299777, 300033, 300289, 300545, 300801, 301057,
+    301313, 301569, 301825, 302081, 302337, 302593, 302849, 303105, 303361, 303617, 303873, 304129,
+    304385, 304641, 304897, 305153, 305409, 305665, 305921, 306177, 306433, 306689, 306945, 307201,
+    307457, 307713, 307969, 308225, 308481, 308737, 308993, 309249, 309505, 309761, 310017, 310273,
+    310529, 310785, 311041, 311297, 311553, 311809, 312065, 312321, 312577, 312833, 313089, 313345,
+    313601, 313857, 314113, 314369, 314625, 314881, 315137, 315393, 315649, 315905, 316161, 316417,
+    316673, 316929, 317185, 317441, 317697, 317953, 318209, 318465, 318721, 318977, 319233, 319489,
+    319745, 320001, 320257, 320513, 320769, 321025, 321281, 321537, 321793, 322049, 322305, 322561,
+    322817, 323073, 323329, 323585, 323841, 324097, 324353, 324609, 324865, 325121, 325377, 325633,
+    325889, 326145, 326401, 326657, 326913, 327169, 327425, 327681, 327937, 328193, 328449, 328705,
+    328961, 329217, 329473, 329729, 329985, 330241, 330497, 330753, 331009, 331265, 331521, 331777,
+    332033, 332289, 332545, 332801, 333057, 333313, 333569, 333825, 334081, 334337, 334593, 334849,
+    335105, 335361, 335617, 335873, 336129, 336385, 336641, 336897, 337153, 337409, 337665, 337921,
+    338177, 338433, 338689, 338945, 339201, 339457, 339713, 339969, 340225, 340481, 340737, 340993,
+    341249, 341505, 341761, 342017, 342273, 342529, 342785, 343041, 343297, 343553, 343809, 344065,
+    344321, 344577, 344833, 345089, 345345, 345601, 345857, 346113, 346369, 346625, 346881, 347137,
+    347393, 347649, 347905, 348161, 348417, 348673, 348929, 349185, 349441, 349697, 349953, 350209,
+    350465, 350721, 350977, 351233, 351489, 351745, 352001, 352257, 352513, 352769, 353025, 353281,
+    353537, 353793, 354049, 354305, 354561, 354817, 355073, 355329, 355585, 355841, 356097, 356353,
+    356609, 356865, 357121, 357377, 357633, 357889, 358145, 358401, 358657, 358913, 359169, 359425,
+    359681, 359937, 360193, 360449, 360705, 360961, 361217, 361473, 361729, 361985, 362241, 362497,
+    362753, 363009, 363265, 363521, 363777, 364033, 364289, 364545, 364801, 365057, 365313, 365569,
+    365825, 366081, 366337, 366593, 366849,
+};
+static const uint32_t UNI_LOWER_POOL[] = {
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233,
+    234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245,
+    246, 248, 249, 250, 251, 252, 253, 254, 257, 259, 261, 263,
+    265, 267, 269, 271, 273, 275, 277, 279, 281, 283, 285, 287,
+    289, 291, 293, 295, 297, 299, 301, 303, 105, 775, 307, 309,
+    311, 314, 316, 318, 320, 322, 324, 326, 328, 331, 333, 335,
+    337, 339, 341, 343, 345, 347, 349, 351, 353, 355, 357, 359,
+    361, 363, 365, 367, 369, 371, 373, 375, 255, 378, 380, 382,
+    595, 387, 389, 596, 392, 598, 599, 396, 477, 601, 603, 402,
+    608, 611, 617, 616, 409, 623, 626, 629, 417, 419, 421, 640,
+    424, 643, 429, 648, 432, 650, 651, 436, 438, 658, 441, 445,
+    454, 454, 457, 457, 460, 460, 462, 464, 466, 468, 470, 472,
+    474, 476, 479, 481, 483, 485, 487, 489, 491, 493, 495, 499,
+    499, 501, 405, 447, 505, 507, 509, 511, 513, 515, 517, 519,
+    521, 523, 525, 527, 529, 531, 533, 535, 537, 539, 541, 543,
+    414, 547, 549, 551, 553, 555, 557, 559, 561, 563, 11365, 572,
+    410, 11366, 578, 384, 649, 652, 583, 585, 587, 589, 591, 881,
+    883, 887, 1011, 940, 941, 942, 943, 972, 973, 974, 945, 946,
+    947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958,
+    959, 960, 961, 963, 964, 965, 966, 967, 968, 969, 970, 971,
+    983, 985, 987, 989, 991, 993, 995, 997, 999, 1001, 1003, 1005,
+    1007, 952, 1016, 1010, 1019, 891, 892, 893, 1104, 1105, 1106, 1107,
+    1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+    1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083,
+    1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+    1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1121, 1123, 1125, 1127,
+    1129, 1131, 1133, 1135, 1137, 1139, 1141, 1143, 1145, 1147, 1149, 1151,
+    1153, 1163, 1165, 1167, 1169, 1171, 1173, 1175, 1177, 1179, 1181, 1183,
+    1185, 1187, 1189, 1191, 1193, 1195, 1197, 1199, 1201, 1203, 1205, 1207,
+    1209, 1211, 1213, 1215, 1231, 1218, 1220, 1222, 1224, 1226, 1228, 1230,
+    1233, 1235, 1237, 1239, 1241, 1243, 1245, 1247, 1249, 1251, 1253, 1255,
+    1257, 1259, 1261, 1263, 1265, 1267, 1269, 1271, 1273, 1275, 1277, 1279,
+    1281, 1283, 1285, 1287, 1289, 1291, 1293, 1295, 1297, 1299, 1301, 1303,
+    1305, 1307, 1309, 1311, 1313, 1315, 1317, 1319, 1321, 1323, 1325, 1327,
+    1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388,
+    1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
+    1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412,
+    1413, 1414, 11520, 11521, 11522, 11523, 11524, 11525, 11526, 11527, 11528, 11529,
+    11530, 11531, 11532, 11533, 11534, 11535, 11536, 11537, 11538, 11539, 11540, 11541,
+    11542, 11543, 11544, 11545, 11546, 11547, 11548, 11549, 11550, 11551, 11552, 11553,
+    11554, 11555, 11556, 11557, 11559, 11565, 43888, 43889, 43890, 43891, 43892, 43893,
+    43894, 43895, 43896, 43897, 43898, 43899, 43900, 43901, 43902, 43903, 43904, 43905,
+    43906, 43907, 43908, 43909, 43910, 43911, 43912, 43913, 43914, 43915, 43916, 43917,
+    43918, 43919, 43920, 43921, 43922, 43923, 43924, 43925, 43926, 43927, 43928, 43929,
+    43930, 43931, 43932, 43933, 43934, 43935, 43936, 43937, 43938, 43939, 43940, 43941,
+    43942, 43943, 43944, 43945, 43946, 43947, 43948, 43949, 43950, 43951, 43952, 43953,
+    43954, 43955, 43956, 43957, 43958, 43959, 43960, 43961, 43962, 43963, 43964, 43965,
+    43966, 43967, 5112, 5113, 5114, 5115, 5116, 5117, 4304, 4305, 4306, 4307,
+    4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319,
+    4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331,
+    4332, 4333, 4334, 4335, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343,
+    4344, 4345, 4346, 4349, 4350, 4351, 7681, 7683, 7685, 7687, 7689, 7691,
+    7693, 7695, 7697, 7699, 7701, 7703, 7705, 7707, 7709, 7711, 7713, 7715,
+    7717, 7719, 7721, 7723, 7725, 7727, 7729, 7731, 7733, 7735, 7737, 7739,
+    7741, 7743, 7745, 7747, 7749, 7751, 7753, 7755, 7757, 7759, 7761, 7763,
+    7765, 7767, 7769, 7771, 7773, 7775, 7777, 7779, 7781, 7783, 7785, 7787,
+    7789, 7791, 7793, 7795, 7797, 7799, 7801, 7803, 7805, 7807, 7809, 7811,
+    7813, 7815, 7817, 7819, 7821, 7823, 7825, 7827, 7829, 223, 7841, 7843,
+    7845, 7847, 7849, 7851, 7853, 7855, 7857, 7859, 7861, 7863, 7865, 7867,
+    7869, 7871, 7873, 7875, 7877, 7879, 7881, 7883, 7885, 7887, 7889, 7891,
+    7893, 7895, 7897, 7899, 7901, 7903, 7905, 7907, 7909, 7911, 7913, 7915,
+    7917, 7919, 7921, 7923, 7925, 7927, 7929, 7931, 7933, 7935, 7936, 7937,
+    7938, 7939, 7940, 7941, 7942, 7943, 7952, 7953, 7954, 7955, 7956, 7957,
+    7968, 7969, 7970, 7971, 7972, 7973, 7974, 7975, 7984, 7985, 7986, 7987,
+    7988, 7989, 7990, 7991, 8000, 8001, 8002, 8003, 8004, 8005, 8017, 8019,
+    8021, 8023, 8032, 8033, 8034, 8035, 8036, 8037, 8038, 8039, 8064, 8065,
+    8066, 8067, 8068, 8069, 8070, 8071, 8080, 8081, 8082, 8083, 8084, 8085,
+    8086, 8087, 8096, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8112, 8113,
+    8048, 8049, 8115, 8050, 8051, 8052, 8053, 8131, 8144, 8145, 8054, 8055,
+    8160, 8161, 8058, 8059, 8165, 8056, 8057, 8060, 8061, 8179, 969, 107,
+    229, 8526, 8560, 8561, 8562, 8563, 8564, 8565, 8566, 8567, 8568, 8569,
+    8570, 8571, 8572, 8573, 8574, 8575, 8580, 9424, 9425, 9426, 9427, 9428,
+    9429, 9430, 9431, 9432, 9433, 9434, 9435, 9436, 9437, 9438, 9439, 9440,
+    9441, 9442, 9443, 9444, 9445, 9446, 9447, 9448, 9449, 11312, 11313, 11314,
+    11315, 11316, 11317, 11318, 11319, 11320, 11321, 11322, 11323, 11324, 11325, 11326,
+    11327, 11328, 11329, 11330, 11331, 11332, 11333, 11334, 11335, 11336, 11337, 11338,
+    11339, 11340, 11341, 11342, 11343, 11344, 11345, 11346, 11347, 11348, 11349, 11350,
+    11351, 11352, 11353, 11354, 11355, 11356, 11357, 11358, 11359, 11361, 619, 7549,
+    637, 11368, 11370, 11372, 593, 625, 592, 594, 11379, 11382, 575, 576,
+    11393, 11395, 11397, 11399, 11401, 11403, 11405, 11407, 11409, 11411, 11413, 11415,
+    11417, 11419, 11421, 11423, 11425, 11427, 11429, 11431, 11433, 11435, 11437, 11439,
+    11441, 11443, 11445, 11447, 11449, 11451, 11453, 11455, 11457, 11459, 11461, 11463,
+    11465, 11467, 11469, 11471, 11473, 11475, 11477, 11479, 11481, 11483, 11485, 11487,
+    11489, 11491, 11500, 11502, 11507, 42561, 42563, 42565, 42567, 42569, 42571, 42573,
+    42575, 42577, 42579, 42581, 42583, 42585, 42587, 42589, 42591, 42593, 42595, 42597,
+    42599, 42601, 42603, 42605, 42625, 42627, 42629, 42631, 42633, 42635, 42637, 42639,
+    42641, 42643, 42645, 42647, 42649, 42651, 42787, 42789, 42791, 42793, 42795, 42797,
+    42799, 42803, 42805, 42807, 42809, 42811, 42813, 42815, 42817, 42819, 42821, 42823,
+    42825, 42827, 42829, 42831, 42833, 42835, 42837, 42839, 42841, 42843, 42845, 42847,
+    42849, 42851, 42853, 42855, 42857, 42859, 42861, 42863, 42874, 42876, 7545, 42879,
+    42881, 42883, 42885, 42887, 42892, 613, 42897, 42899, 42903, 42905, 42907, 42909,
+    42911, 42913, 42915, 42917, 42919, 42921, 614, 604, 609, 620, 618, 670,
+    647, 669, 43859, 42933, 42935, 42937, 42939, 42941, 42943, 42945, 42947, 42900,
+    642, 7566, 42952, 42954, 42961, 42967, 42969, 42998, 65345, 65346, 65347, 65348,
+    65349, 65350, 65351, 65352, 65353, 65354, 65355, 65356, 65357, 65358, 65359, 65360,
+    65361, 65362, 65363, 65364, 65365, 65366, 65367, 65368, 65369, 65370, 66600, 66601,
+    66602, 66603, 66604, 66605, 66606, 66607, 66608, 66609, 66610, 66611, 66612, 66613,
+    66614, 66615, 66616, 66617, 66618, 66619, 66620, 66621, 66622, 66623, 66624, 66625,
+    66626, 66627, 66628, 66629, 66630, 66631, 66632, 66633, 66634, 66635, 66636, 66637,
+    66638, 66639, 66776, 66777, 66778, 66779, 66780, 66781, 66782, 66783, 66784, 66785,
+    66786, 66787, 66788, 66789, 66790, 66791, 66792, 66793, 66794, 66795, 66796, 66797,
+    66798, 66799, 66800, 66801, 66802, 66803, 66804, 66805, 66806, 66807, 66808, 66809,
+    66810, 66811, 66967, 66968, 66969, 66970, 66971, 66972, 66973, 66974, 66975, 66976,
+    66977, 66979, 66980, 66981, 66982, 66983, 66984, 66985, 66986, 66987, 66988, 66989,
+    66990, 66991, 66992, 66993, 66995, 66996, 66997, 66998, 66999, 67000, 67001, 67003,
+    67004, 68800, 68801, 68802, 68803, 68804, 68805, 68806, 68807, 68808, 68809, 68810,
+    68811, 68812, 68813, 68814, 68815, 68816, 68817, 68818, 68819, 68820, 68821, 68822,
+    68823, 68824, 68825, 68826, 68827, 68828, 68829, 68830, 68831, 68832, 68833, 68834,
+    68835, 68836, 68837, 68838, 68839, 68840, 68841, 68842, 68843, 68844, 68845, 68846,
+    68847, 68848, 68849, 68850, 71872, 71873, 71874, 71875, 71876, 71877, 71878, 71879,
+    71880, 71881, 71882, 71883, 71884, 71885, 71886, 71887, 71888, 71889, 71890, 71891,
+    71892, 71893, 71894, 71895, 71896, 71897, 71898, 71899, 71900, 71901, 71902, 71903,
+    93792, 93793, 93794, 93795, 93796, 93797, 93798, 93799, 93800, 93801, 93802, 93803,
+    93804, 93805, 93806, 93807, 93808, 93809, 93810, 93811, 93812, 93813, 93814, 93815,
+    93816, 93817, 93818, 93819, 93820, 93821, 93822, 93823, 125218, 125219, 125220, 125221,
+    125222, 125223, 125224, 125225, 125226, 125227, 125228, 125229, 125230, 125231, 125232, 125233,
+    125234, 125235, 125236, 125237, 125238, 125239, 125240, 125241, 125242, 125243, 125244, 125245,
+    125246, 125247, 125248, 125249, 125250, 125251,
+};
+
+// Full case folding (str.casefold)
+static const size_t UNI_CASEFOLD_SIZE = 1530;
+static const uint32_t UNI_CASEFOLD_KEYS[] = {
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+    77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+    89, 90, 181, 192, 193, 194, 195, 196, 197, 198, 199, 200,
+    201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 216, 217, 218, 219, 220, 221, 222, 223, 256, 258,
+    260, 262, 264, 266, 268, 270, 272, 274, 276, 278, 280, 282,
+    284, 286, 288, 290, 292, 294, 296, 298, 300, 302, 304, 306,
+    308, 310, 313, 315, 317, 319, 321, 323, 325, 327, 329, 330,
+    332, 334, 336, 338, 340, 342, 344, 346, 348, 350, 352, 354,
+    356, 358, 360, 362, 364, 366, 368, 370, 372, 374, 376, 377,
+    379, 381, 383, 385, 386, 388, 390, 391, 393, 394, 395, 398,
+    399, 400, 401, 403, 404, 406, 407, 408, 412, 413, 415, 416,
+    418, 420, 422, 423, 425, 428, 430, 431, 433, 434, 435, 437,
+    439, 440, 444, 452, 453, 455, 456, 458, 459, 461, 463, 465,
+    467, 469, 471, 473, 475, 478, 480, 482, 484, 486, 488, 490,
+    492, 494, 496, 497, 498, 500, 502, 503, 504, 506, 508, 510,
+    512, 514, 516, 518, 520, 522, 524, 526, 528, 530, 532, 534,
+    536, 538, 540, 542, 544, 546, 548, 550, 552, 554, 556, 558,
+    560, 562, 570, 571, 573, 574, 577, 579, 580, 581, 582, 584,
+    586, 588, 590, 837, 880, 882, 886, 895, 902, 904, 905, 906,
+    908, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920,
+    921, 922, 923, 924, 925, 926, 927, 928, 929, 931, 932, 933,
+    934, 935, 936, 937, 938, 939, 944, 962, 975, 976, 977, 981,
+    982, 984, 986, 988, 990, 992, 994, 996, 998, 1000, 1002, 1004,
+    1006, 1008, 1009, 1012, 1013, 1015, 1017, 1018, 1021, 1022, 1023, 1024,
+    1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
+    1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
+    1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
+    1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1120,
+    1122, 1124, 1126, 1128, 1130, 1132, 1134, 1136, 1138, 1140, 1142, 1144,
+    1146, 1148, 1150, 1152, 1162, 1164, 1166, 1168, 1170, 1172, 1174, 1176,
+    1178, 1180, 1182, 1184, 1186, 1188, 1190, 1192, 1194, 1196, 1198, 1200,
+    1202, 1204, 1206, 1208, 1210, 1212, 1214, 1216, 1217, 1219, 1221, 1223,
+    1225, 1227, 1229, 1232, 1234, 1236, 1238, 1240, 1242, 1244, 1246, 1248,
+    1250, 1252, 1254, 1256, 1258, 1260, 1262, 1264, 1266, 1268, 1270, 1272,
+    1274, 1276, 1278, 1280, 1282, 1284, 1286, 1288, 1290, 1292, 1294, 1296,
+    1298, 1300, 1302, 1304, 1306, 1308, 1310, 1312, 1314, 1316, 1318, 1320,
+    1322, 1324, 1326, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337,
+    1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
+    1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,
+    1362, 1363, 1364, 1365, 1366, 1415, 4256, 4257, 4258, 4259, 4260, 4261,
+    4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273,
+    4274, 4275, 4276, 4277, 4278, 4279, 4280, 4281, 4282, 4283, 4284, 4285,
+    4286, 4287, 4288, 4289, 4290, 4291, 4292, 4293, 4295, 4301, 5112, 5113,
+    5114, 5115, 5116, 5117, 7296, 7297, 7298, 7299, 7300, 7301, 7302, 7303,
+    7304, 7312, 7313, 7314, 7315, 7316, 7317, 7318, 7319, 7320, 7321, 7322,
+    7323, 7324, 7325, 7326, 7327, 7328, 7329, 7330, 7331, 7332, 7333, 7334,
+    7335, 7336, 7337, 7338, 7339, 7340, 7341, 7342, 7343, 7344, 7345, 7346,
+    7347, 7348, 7349, 7350, 7351, 7352, 7353, 7354, 7357, 7358, 7359, 7680,
+    7682, 7684, 7686, 7688, 7690, 7692, 7694, 7696, 7698, 7700, 7702, 7704,
+    7706, 7708, 7710, 7712, 7714, 7716, 7718, 7720, 7722, 7724, 7726, 7728,
+    7730, 7732, 7734, 7736, 7738, 7740, 7742, 7744, 7746, 7748, 7750, 7752,
+    7754, 7756, 7758, 7760, 7762, 7764, 7766, 7768, 7770, 7772, 7774, 7776,
+    7778, 7780, 7782, 7784, 7786, 7788, 7790, 7792, 7794, 7796, 7798, 7800,
+    7802, 7804, 7806, 7808, 7810, 7812, 7814, 7816, 7818, 7820, 7822, 7824,
+    7826, 7828, 7830, 7831, 7832, 7833, 7834, 7835, 7838, 7840, 7842, 7844,
+    7846, 7848, 7850, 7852, 7854, 7856, 7858, 7860, 7862, 7864, 7866, 7868,
+    7870, 7872, 7874, 7876, 7878, 7880, 7882, 7884, 7886, 7888, 7890, 7892,
+    7894, 7896, 7898, 7900, 7902, 7904, 7906, 7908, 7910, 7912, 7914, 7916,
+    7918, 7920, 7922, 7924, 7926, 7928, 7930, 7932, 7934, 7944, 7945, 7946,
+    7947, 7948, 7949, 7950, 7951, 7960, 7961, 7962, 7963, 7964, 7965, 7976,
+    7977, 7978, 7979, 7980, 7981, 7982, 7983, 7992, 7993, 7994, 7995, 7996,
+    7997, 7998, 7999, 8008, 8009, 8010, 8011, 8012, 8013, 8016, 8018, 8020,
+    8022, 8025, 8027, 8029, 8031, 8040, 8041, 8042, 8043, 8044, 8045, 8046,
+    8047, 8064, 8065, 8066, 8067, 8068, 8069, 8070, 8071, 8072, 8073, 8074,
+    8075, 8076, 8077, 8078, 8079, 8080, 8081, 8082, 8083, 8084, 8085, 8086,
+    8087, 8088, 8089, 8090, 8091, 8092, 8093, 8094, 8095, 8096, 8097, 8098,
+    8099, 8100, 8101, 8102, 8103, 8104, 8105, 8106, 8107, 8108, 8109, 8110,
+    8111, 8114, 8115, 8116, 8118, 8119, 8120, 8121, 8122, 8123, 8124, 8126,
+    8130, 8131, 8132, 8134, 8135, 8136, 8137, 8138, 8139, 8140, 8146, 8147,
+    8150, 8151, 8152, 8153, 8154, 8155, 8162, 8163, 8164, 8166, 8167, 8168,
+    8169, 8170, 8171, 8172, 8178, 8179, 8180, 8182, 8183, 8184, 8185, 8186,
+    8187, 8188, 8486, 8490, 8491, 8498, 8544, 8545, 8546, 8547, 8548, 8549,
+    8550, 8551, 8552, 8553, 8554, 8555, 8556, 8557, 8558, 8559, 8579, 9398,
+    9399, 9400, 9401, 9402, 9403, 9404, 9405, 9406, 9407, 9408, 9409, 9410,
+    9411, 9412, 9413, 9414, 9415, 9416, 9417, 9418, 9419, 9420, 9421, 9422,
+    9423, 11264, 11265, 11266, 11267, 11268, 11269, 11270, 11271, 11272, 11273, 11274,
+    11275, 11276, 11277, 11278, 11279, 11280, 11281, 11282, 11283, 11284, 11285, 11286,
+    11287, 11288, 11289, 11290, 11291, 11292, 11293, 11294, 11295, 11296, 11297, 11298,
+    11299, 11300, 11301, 11302, 11303, 11304, 11305, 11306, 11307, 11308, 11309, 11310,
+    11311, 11360, 11362, 11363, 11364, 11367, 11369, 11371, 11373, 11374, 11375, 11376,
+    11378, 11381, 11390, 11391, 11392, 11394, 11396, 11398, 11400, 11402, 11404, 11406,
+    11408, 11410, 11412, 11414, 11416, 11418, 11420, 11422, 11424, 11426, 11428, 11430,
+    11432, 11434, 11436, 11438, 11440, 11442, 11444, 11446, 11448, 11450, 11452, 11454,
+    11456, 11458, 11460, 11462, 11464, 11466, 11468, 11470, 11472, 11474, 11476, 11478,
+    11480, 11482, 11484, 11486, 11488, 11490, 11499, 11501, 11506, 42560, 42562, 42564,
+    42566, 42568, 42570, 42572, 42574, 42576, 42578, 42580, 42582, 42584, 42586, 42588,
+    42590, 42592, 42594, 42596, 42598, 42600, 42602, 42604, 42624, 42626, 42628, 42630,
+    42632, 42634, 42636, 42638, 42640, 42642, 42644, 42646, 42648, 42650, 42786, 42788,
+    42790, 42792, 42794, 42796, 42798, 42802, 42804, 42806, 42808, 42810, 42812, 42814,
+    42816, 42818, 42820, 42822, 42824, 42826, 42828, 42830, 42832, 42834, 42836, 42838,
+    42840, 42842, 42844, 42846, 42848, 42850, 42852, 42854, 42856, 42858, 42860, 42862,
+    42873, 42875, 42877, 42878, 42880, 42882, 42884, 42886, 42891, 42893, 42896, 42898,
+    42902, 42904, 42906, 42908, 42910, 42912, 42914, 42916, 42918, 42920, 42922, 42923,
+    42924, 42925, 42926, 42928, 42929, 42930, 42931, 42932, 42934, 42936, 42938, 42940,
+    42942, 42944, 42946, 42948, 42949, 42950, 42951, 42953, 42960, 42966, 42968, 42997,
+    43888, 43889, 43890, 43891, 43892, 43893, 43894, 43895, 43896, 43897, 43898, 43899,
+    43900, 43901, 43902, 43903, 43904, 43905, 43906, 43907, 43908, 43909, 43910, 43911,
+    43912, 43913, 43914, 43915, 43916, 43917, 43918, 43919, 43920, 43921, 43922, 43923,
+    43924, 43925, 43926, 43927, 43928, 43929, 43930, 43931, 43932, 43933, 43934, 43935,
+    43936, 43937, 43938, 43939, 43940, 43941, 43942, 43943, 43944, 43945, 43946, 43947,
+    43948, 43949, 43950, 43951, 43952, 43953, 43954, 43955, 43956, 43957, 43958, 43959,
+    43960, 43961, 43962, 43963, 43964, 43965, 43966, 43967, 64256, 64257, 64258, 64259,
+    64260, 64261, 64262, 64275, 64276, 64277, 64278, 64279, 65313, 65314, 65315, 65316,
+    65317, 65318, 65319, 65320, 65321, 65322, 65323, 65324, 65325, 65326, 65327, 65328,
+    65329, 65330, 65331, 65332, 65333, 65334, 65335, 65336, 65337, 65338, 66560, 66561,
+    66562, 66563, 66564, 66565, 66566, 66567, 66568, 66569, 66570, 66571, 66572, 66573,
+    66574, 66575, 66576, 66577, 66578, 66579, 66580, 66581, 66582, 66583, 66584, 66585,
+    66586, 66587, 66588, 66589, 66590, 66591, 66592, 66593, 66594, 66595, 66596, 66597,
+    66598, 66599, 66736, 66737, 66738, 66739, 66740, 66741, 66742, 66743, 66744, 66745,
+    66746, 66747, 66748, 66749, 66750, 66751, 66752, 66753, 66754, 66755, 66756, 66757,
+    66758, 66759, 66760, 66761, 66762, 66763, 66764, 66765, 66766, 66767, 66768, 66769,
+    66770, 66771, 66928, 66929, 66930, 66931, 66932, 66933, 66934, 66935, 66936, 66937,
+    66938, 66940, 66941, 66942, 66943, 66944, 66945, 66946, 66947, 66948, 66949, 66950,
+    66951, 66952, 66953, 66954, 66956, 66957, 66958, 66959, 66960, 66961, 66962, 66964,
+    66965, 68736, 68737, 68738, 68739, 68740, 68741, 68742, 68743, 68744, 68745, 68746,
+    68747, 68748, 68749, 68750, 68751, 68752, 68753, 68754, 68755, 68756, 68757, 68758,
+    68759, 68760, 68761, 68762, 68763, 68764, 68765, 68766, 68767, 68768, 68769, 68770,
+    68771, 68772, 68773, 68774, 68775, 68776, 68777, 68778, 68779, 68780, 68781, 68782,
+    68783, 68784, 68785, 68786, 71840, 71841, 71842, 71843, 71844, 71845, 71846, 71847,
+    71848, 71849, 71850, 71851, 71852, 71853, 71854, 71855, 71856, 71857, 71858, 71859,
+    71860, 71861, 71862, 71863, 71864, 71865, 71866, 71867, 71868, 71869, 71870, 71871,
+    93760, 93761, 93762, 93763, 93764, 93765, 93766, 93767, 93768, 93769, 93770, 93771,
+    93772, 93773, 93774, 93775, 93776, 93777, 93778, 93779, 93780, 93781, 93782, 93783,
+    93784, 93785, 93786, 93787, 93788, 93789, 93790, 93791, 125184, 125185, 125186, 125187,
+    125188, 125189, 125190, 125191, 125192, 125193, 125194, 125195, 125196, 125197, 125198, 125199,
+    125200, 125201, 125202, 125203, 125204, 125205, 125206, 125207, 125208, 125209, 125210, 125211,
+    125212, 125213, 125214, 125215, 125216, 125217,
+};
+static const uint32_t UNI_CASEFOLD_VALS[] = {
+    1, 257, 513, 769, 1025, 1281, 1537, 1793, 2049, 2305, 2561, 2817,
+    3073, 3329, 3585, 3841, 4097, 4353, 4609, 4865, 5121, 5377, 5633, 5889,
+    6145, 6401, 6657, 6913, 7169, 7425, 7681, 7937, 8193, 8449, 8705, 8961,
+    9217, 9473, 9729, 9985, 10241, 10497, 10753, 11009, 11265, 11521, 11777, 12033,
+    12289, 12545, 12801, 13057, 13313, 13569, 13825, 14081, 14337, 14594, 15105, 15361,
+    15617, 15873, 16129, 16385, 16641, 16897, 17153, 17409, 17665, 17921, 18177, 18433,
+    18689, 18945, 19201, 19457, 19713, 19969, 20225, 20481, 20737, 20993, 21250, 21761,
+    22017, 22273, 22529, 22785, 23041, 23297, 23553, 23809, 24065, 24321, 24578, 25089,
+    25345, 25601, 25857, 26113, 26369, 26625, 26881, 27137, 27393, 27649, 27905, 28161,
+    28417, 28673, 28929, 29185, 29441, 29697, 29953, 30209, 30465, 30721, 30977, 31233,
+    31489, 31745, 32001, 32257, 32513, 32769, 33025, 33281, 33537, 33793, 34049, 34305,
+    34561, 34817, 35073, 35329, 35585, 35841, 36097, 36353, 36609, 36865, 37121, 37377,
+    37633, 37889, 38145, 38401, 38657, 38913, 39169, 39425, 39681, 39937, 40193, 40449,
+    40705, 40961, 41217, 41473, 41729, 41985, 42241, 42497, 42753, 43009, 43265, 43521,
+    43777, 44033, 44289, 44545, 44801, 45057, 45313, 45569, 45825, 46081, 46337, 46593,
+    46849, 47105, 47362, 47873, 48129, 48385, 48641, 48897, 49153, 49409, 49665, 49921,
+    50177, 50433, 50689, 50945, 51201, 51457, 51713, 51969, 52225, 52481, 52737, 52993,
+    53249, 53505, 53761, 54017, 54273, 54529, 54785, 55041, 55297, 55553, 55809, 56065,
+    56321, 56577, 56833, 57089, 57345, 57601, 57857, 58113, 58369, 58625, 58881, 59137,
+    59393, 59649, 59905, 60161, 60417, 60673, 60929, 61185, 61441, 61697, 61953, 62209,
+    62465, 62721, 62977, 63235, 64001, 64257, 64513, 64769, 65025, 65281, 65537, 65793,
+    66049, 66305, 66561, 66817, 67073, 67329, 67585, 67841, 68097, 68353, 68609, 68865,
+    69121, 69377, 69633, 69889, 70145, 70401, 70659, 71425, 71681, 71937, 72193, 72449,
+    72705, 72961, 73217, 73473, 73729, 73985, 74241, 74497, 74753, 75009, 75265, 75521,
+    75777, 76033, 76289, 76545, 76801, 77057, 77313, 77569, 77825, 78081, 78337, 78593,
+    78849, 79105, 79361, 79617, 79873, 80129, 80385, 80641, 80897, 81153, 81409, 81665,
+    81921, 82177, 82433, 82689, 82945, 83201, 83457, 83713, 83969, 84225, 84481, 84737,
+    84993, 85249, 85505, 85761, 86017, 86273, 86529, 86785, 87041, 87297, 87553, 87809,
+    88065, 88321, 88577, 88833, 89089, 89345, 89601, 89857, 90113, 90369, 90625, 90881,
+    91137, 91393, 91649, 91905, 92161, 92417, 92673, 92929, 93185, 93441, 93697, 93953,
+    94209, 94465, 94721, 94977, 95233, 95489, 95745, 96001, 96257, 96513, 96769, 97025,
+    97281, 97537, 97793, 98049, 98305, 98561, 98817, 99073, 99329, 99585, 99841, 100097,
+    100353, 100609, 100865, 101121, 101377, 101633, 101889, 102145, 102401, 102657, 102913, 103169,
+    103425, 103681, 103937, 104193, 104449, 104705, 104961, 105217, 105473, 105729, 105985, 106241,
+    106497, 106753, 107009, 107265, 107521, 107777, 108033, 108289, 108545, 108801, 109057, 109313,
+    109569, 109825, 110081, 110337, 110593, 110849, 111105, 111361, 111617, 111873, 112129, 112385,
+    112641, 112897, 113153, 113409, 113665, 113921, 114177, 114433, 114689, 114945, 115201, 115457,
+    115713, 115969, 116225, 116481, 116737, 116993, 117249, 117505, 117761, 118017, 118273, 118529,
+    118785, 119041, 119297, 119553, 119809, 120065, 120321, 120577, 120833, 121089, 121345, 121601,
+    121857, 122113, 122369, 122625, 122881, 123137, 123393, 123649, 123905, 124161, 124417, 124673,
+    124929, 125185, 125441, 125697, 125953, 126210, 126721, 126977, 127233, 127489, 127745, 128001,
+    128257, 128513, 128769, 129025, 129281, 129537, 129793, 130049, 130305, 130561, 130817, 131073,
+    131329, 131585, 131841, 132097, 132353, 132609, 132865, 133121, 133377, 133633, 133889, 134145,
+    134401, 134657, 134913, 135169, 135425, 135681, 135937, 136193, 136449, 136705, 136961, 137217,
+    137473, 137729, 137985, 138241, 138497, 138753, 139009, 139265, 139521, 139777, 140033, 140289,
+    140545, 140801, 141057, 141313, 141569, 141825, 142081, 142337, 142593, 142849, 143105, 143361,
+    143617, 143873, 144129, 144385, 144641, 144897, 145153, 145409, 145665, 145921, 146177, 146433,
+    146689, 146945, 147201, 147457, 147713, 147969, 148225, 148481, 148737, 148993, 149249, 149505,
+    149761, 150017, 150273, 150529, 150785, 151041, 151297, 151553, 151809, 152065, 152321, 152577,
+    152833, 153089, 153345, 153601, 153857, 154113, 154369, 154625, 154881, 155137, 155393, 155649,
+    155905, 156161, 156417, 156673, 156929, 157185, 157441, 157697, 157953, 158209, 158465, 158721,
+    158977, 159233, 159489, 159745, 160001, 160257, 160513, 160769, 161025, 161281, 161537, 161793,
+    162049, 162305, 162561, 162817, 163073, 163329, 163585, 163841, 164097, 164353, 164609, 164865,
+    165121, 165377, 165633, 165889, 166145, 166401, 166657, 166913, 167169, 167425, 167681, 167937,
+    168193, 168449, 168705, 168961, 169217, 169473, 169729, 169985, 170241, 170497, 170753, 171009,
+    171265, 171521, 171778, 172290, 172802, 173314, 173826, 174337, 174594, 175105, 175361, 175617,
+    175873, 176129, 176385, 176641, 176897, 177153, 177409, 177665, 177921, 178177, 178433, 178689,
+    178945, 179201, 179457, 179713, 179969, 180225, 180481, 180737, 180993, 181249, 181505, 181761,
+    182017, 182273, 182529, 182785, 183041, 183297, 183553, 183809, 184065, 184321, 184577, 184833,
+    185089, 185345, 185601, 185857, 186113, 186369, 186625, 186881, 187137, 187393, 187649, 187905,
+    188161, 188417, 188673, 188929, 189185, 189441, 189697, 189953, 190209, 190465, 190721, 190977,
+    191233, 191489, 191745, 192001, 192257, 192513, 192769, 193025, 193281, 193537, 193793, 194049,
+    194305, 194561, 194817, 195073, 195329, 195585, 195841, 196097, 196353, 196610, 197123, 197891,
+    198659, 199425, 199681, 199937, 200193, 200449, 200705, 200961, 201217, 201473, 201729, 201985,
+    202241, 202498, 203010, 203522, 204034, 204546, 205058, 205570, 206082, 206594, 207106, 207618,
+    208130, 208642, 209154, 209666, 210178, 210690, 211202, 211714, 212226, 212738, 213250, 213762,
+    214274, 214786, 215298, 215810, 216322, 216834, 217346, 217858, 218370, 218882, 219394, 219906,
+    220418, 220930, 221442, 221954, 222466, 222978, 223490, 224002, 224514, 225026, 225538, 226050,
+    226562, 227074, 227586, 228098, 228610, 229123, 229889, 230145, 230401, 230657, 230914, 231425,
+    231682, 232194, 232706, 233218, 233731, 234497, 234753, 235009, 235265, 235522, 236035, 236803,
+    237570, 238083, 238849, 239105, 239361, 239617, 239875, 240643, 241410, 241922, 242435, 243201,
+    243457, 243713, 243969, 244225, 244482, 244994, 245506, 246018, 246531, 247297, 247553, 247809,
+    248065, 248322, 248833, 249089, 249345, 249601, 249857, 250113, 250369, 250625, 250881, 251137,
+    251393, 251649, 251905, 252161, 252417, 252673, 252929, 253185, 253441, 253697, 253953, 254209,
+    254465, 254721, 254977, 255233, 255489, 255745, 256001, 256257, 256513, 256769, 257025, 257281,
+    257537, 257793, 258049, 258305, 258561, 258817, 259073, 259329, 259585, 259841, 260097, 260353,
+    260609, 260865, 261121, 261377, 261633, 261889, 262145, 262401, 262657, 262913, 263169, 263425,
+    263681, 263937, 264193, 264449, 264705, 264961, 265217, 265473, 265729, 265985, 266241, 266497,
+    266753, 267009, 267265, 267521, 267777, 268033, 268289, 268545, 268801, 269057, 269313, 269569,
+    269825, 270081, 270337, 270593, 270849, 271105, 271361, 271617, 271873, 272129, 272385, 272641,
+    272897, 273153, 273409, 273665, 273921, 274177, 274433, 274689, 274945, 275201, 275457, 275713,
+    275969, 276225, 276481, 276737, 276993, 277249, 277505, 277761, 278017, 278273, 278529, 278785,
+    279041, 279297, 279553, 279809, 280065, 280321, 280577, 280833, 281089, 281345, 281601, 281857,
+    282113, 282369, 282625, 282881, 283137, 283393, 283649, 283905, 284161, 284417, 284673, 284929,
+    285185, 285441, 285697, 285953, 286209, 286465, 286721, 286977, 287233, 287489, 287745, 288001,
+    288257, 288513, 288769, 289025, 289281, 289537, 289793, 290049, 290305, 290561, 290817, 291073,
+    291329, 291585, 291841, 292097, 292353, 292609, 292865, 293121, 293377, 293633, 293889, 294145,
+    294401, 294657, 294913, 295169, 295425, 295681, 295937, 296193, 296449, 296705, 296961, 297217,
+    297473, 297729, 297985, 298241, 298497, 298753, 299009, 299265, 299521, 299777, 300033, 300289,
+    300545, 300801, 301057, 301313, 301569, 301825, 302081, 302337, 302593, 302849, 303105, 303361,
+    303617, 303873, 304129, 304385, 304641, 304897, 305153, 305409, 305665, 305921, 306177, 306433,
+    306689, 306945, 307201, 307457, 307713, 307969, 308225, 308481, 308737, 308993, 309249, 309505,
+    309761, 310017, 310273, 310529, 310785, 311041, 311297, 311553, 311809, 312065, 312321, 312577,
+    312833, 313089, 313345, 313601, 313857, 314113, 314369, 314625, 314881, 315137, 315393, 315649,
+    315905, 316161, 316417, 316673, 316929, 317185, 317441, 317697, 317953, 318209, 318465, 318721,
+    318977, 319233, 319489, 319745, 320001, 320257, 320513, 320769, 321025, 321281, 321537, 321793,
+    322049, 322305, 322561, 322817, 323073, 323329, 323585, 323841, 324097, 324353, 324609, 324865,
+    325121, 325377, 325633, 325889, 326145, 326401, 326657, 326913, 327169, 327425, 327681, 327937,
+    328193, 328449, 328705, 328961, 329217, 329473, 329729, 329985, 330241, 330497, 330753, 331009,
+    331265, 331521, 331777, 332033, 332289, 332545, 332801, 333057, 333313, 333569, 333825, 334081,
+    334337, 334593, 334849, 335105, 335361, 335617, 335873, 336129, 336385, 336641, 336897, 337153,
+    337409, 337665, 337921, 338177, 338433, 338689, 338945, 339201, 339457, 339713, 339969, 340225,
+    340481, 340737, 340993, 341249, 341505, 341761, 342017, 342273, 342530, 343042, 343554, 344067,
+    344835, 345602, 346114, 346626, 347138, 347650, 348162, 348674, 349185, 349441, 349697, 349953,
+    350209, 350465, 350721, 350977, 351233, 351489, 351745, 352001, 352257, 352513, 352769, 353025,
+    353281, 353537, 353793, 354049, 354305, 354561, 354817, 355073, 355329, 355585, 355841, 356097,
+    356353, 356609, 356865, 357121, 357377, 357633, 357889, 358145, 358401, 358657, 358913, 359169,
+    359425, 359681, 359937, 360193, 360449, 360705, 360961, 361217, 361473, 361729, 361985, 362241,
+    362497, 362753, 363009, 363265, 363521, 363777, 364033, 364289, 364545, 364801, 365057, 365313,
+    365569, 365825, 366081, 366337, 366593, 366849, 367105, 367361, 367617, 367873, 368129, 368385,
+    368641, 368897, 369153, 369409, 369665, 369921, 370177, 370433, 370689, 370945, 371201, 371457,
+    371713, 371969, 372225, 372481, 372737, 372993, 373249, 373505, 373761, 374017, 374273, 374529,
+    374785, 375041, 375297, 375553, 375809, 376065, 376321, 376577, 376833, 377089, 377345, 377601,
+    377857, 378113, 378369, 378625, 378881, 379137, 379393, 379649, 379905, 380161, 380417, 380673,
+    380929, 381185, 381441, 381697, 381953, 382209, 382465, 382721, 382977, 383233, 383489, 383745,
+    384001, 384257, 384513, 384769, 385025, 385281, 385537, 385793, 386049, 386305, 386561, 386817,
+    387073, 387329, 387585, 387841, 388097, 388353, 388609, 388865, 389121, 389377, 389633, 389889,
+    390145, 390401, 390657, 390913, 391169, 391425, 391681, 391937, 392193, 392449, 392705, 392961,
+    393217, 393473, 393729, 393985, 394241, 394497, 394753, 395009, 395265, 395521, 395777, 396033,
+    396289, 396545, 396801, 397057, 397313, 397569, 397825, 398081, 398337, 398593, 398849, 399105,
+    399361, 399617, 399873, 400129, 400385, 400641, 400897, 401153, 401409, 401665, 401921, 402177,
+    402433, 402689, 402945, 403201, 403457, 403713, 403969, 404225, 404481, 404737, 404993, 405249,
+    405505, 405761, 406017, 406273, 406529, 406785, 407041, 407297, 407553, 407809, 408065, 408321,
+    408577, 408833, 409089, 409345, 409601, 409857, 410113, 410369, 410625, 410881, 411137, 411393,
+    411649, 411905, 412161, 412417, 412673, 412929, 413185, 413441, 413697, 413953, 414209, 414465,
+    414721, 414977, 415233, 415489, 415745, 416001, 416257, 416513, 416769, 417025, 417281, 417537,
+    417793, 418049, 418305, 418561, 418817, 419073, 419329, 419585, 419841, 420097, 420353, 420609,
+    420865, 421121, 421377, 421633, 421889, 422145,
+};
+static const uint32_t UNI_CASEFOLD_POOL[] = {
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 956, 224, 225, 226, 227, 228, 229, 230, 231, 232,
+    233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 248, 249, 250, 251, 252, 253, 254, 115, 115, 257,
+    259, 261, 263, 265, 267, 269, 271, 273, 275, 277, 279, 281,
+    283, 285, 287, 289, 291, 293, 295, 297, 299, 301, 303, 105,
+    775, 307, 309, 311, 314, 316, 318, 320, 322, 324, 326, 328,
+    700, 110, 331, 333, 335, 337, 339, 341, 343, 345, 347, 349,
+    351, 353, 355, 357, 359, 361, 363, 365, 367, 369, 371, 373,
+    375, 255, 378, 380, 382, 115, 595, 387, 389, 596, 392, 598,
+    599, 396, 477, 601, 603, 402, 608, 611, 617, 616, 409, 623,
+    626, 629, 417, 419, 421, 640, 424, 643, 429, 648, 432, 650,
+    651, 436, 438, 658, 441, 445, 454, 454, 457, 457, 460, 460,
+    462, 464, 466, 468, 470, 472, 474, 476, 479, 481, 483, 485,
+    487, 489, 491, 493, 495, 106, 780, 499, 499, 501, 405, 447,
+    505, 507, 509, 511, 513, 515, 517, 519, 521, 523, 525, 527,
+    529, 531, 533, 535, 537, 539, 541, 543, 414, 547, 549, 551,
+    553, 555, 557, 559, 561, 563, 11365, 572, 410, 11366, 578, 384,
+    649, 652, 583, 585, 587, 589, 591, 953, 881, 883, 887, 1011,
+    940, 941, 942, 943, 972, 973, 974, 953, 776, 769, 945, 946,
+    947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958,
+    959, 960, 961, 963, 964, 965, 966, 967, 968, 969, 970, 971,
+    965, 776, 769, 963, 983, 946, 952, 966, 960, 985, 987, 989,
+    991, 993, 995, 997, 999, 1001, 1003, 1005, 1007, 954, 961, 952,
+    949, 1016, 1010, 1019, 891, 892, 893, 1104, 1105, 1106, 1107, 1108,
+    1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1072,
+    1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084,
+    1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+    1097, 1098, 1099, 1100, 1101, 1102, 1103, 1121, 1123, 1125, 1127, 1129,
+    1131, 1133, 1135, 1137, 1139, 1141, 1143, 1145, 1147, 1149, 1151, 1153,
+    1163, 1165, 1167, 1169, 1171, 1173, 1175, 1177, 1179, 1181, 1183, 1185,
+    1187, 1189, 1191, 1193, 1195, 1197, 1199, 1201, 1203, 1205, 1207, 1209,
+    1211, 1213, 1215, 1231, 1218, 1220, 1222, 1224, 1226, 1228, 1230, 1233,
+    1235, 1237, 1239, 1241, 1243, 1245, 1247, 1249, 1251, 1253, 1255, 1257,
+    1259, 1261, 1263, 1265, 1267, 1269, 1271, 1273, 1275, 1277, 1279, 1281,
+    1283, 1285, 1287, 1289, 1291, 1293, 1295, 1297, 1299, 1301, 1303, 1305,
+    1307, 1309, 1311, 1313, 1315, 1317, 1319, 1321, 1323, 1325, 1327, 1377,
+    1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+    1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
+    1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413,
+    1414, 1381, 1410, 11520, 11521, 11522, 11523, 11524, 11525, 11526, 11527, 11528,
+    11529, 11530, 11531, 11532, 11533, 11534, 11535, 11536, 11537, 11538, 11539, 11540,
+    11541, 11542, 11543, 11544, 11545, 11546, 11547, 11548, 11549, 11550, 11551, 11552,
+    11553, 11554, 11555, 11556, 11557, 11559, 11565, 5104, 5105, 5106, 5107, 5108,
+    5109, 1074, 1076, 1086, 1089, 1090, 1090, 1098, 1123, 42571, 4304, 4305,
+    4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317,
+    4318, 4319, 4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329,
+    4330, 4331, 4332, 4333, 4334, 4335, 4336, 4337, 4338, 4339, 4340, 4341,
+    4342, 4343, 4344, 4345, 4346, 4349, 4350, 4351, 7681, 7683, 7685, 7687,
+    7689, 7691, 7693, 7695, 7697, 7699, 7701, 7703, 7705, 7707, 7709, 7711,
+    7713, 7715, 7717, 7719, 7721, 7723, 7725, 7727, 7729, 7731, 7733, 7735,
+    7737, 7739, 7741, 7743, 7745, 7747, 7749, 7751, 7753, 7755, 7757, 7759,
+    7761, 7763, 7765, 7767, 7769, 7771, 7773, 7775, 7777, 7779, 7781, 7783,
+    7785, 7787, 7789, 7791, 7793, 7795, 7797, 7799, 7801, 7803, 7805, 7807,
+    7809, 7811, 7813, 7815, 7817, 7819, 7821, 7823, 7825, 7827, 7829, 104,
+    817, 116, 776, 119, 778, 121, 778, 97, 702, 7777, 115, 115,
+    7841, 7843, 7845, 7847, 7849, 7851, 7853, 7855, 7857, 7859, 7861, 7863,
+    7865, 7867, 7869, 7871, 7873, 7875, 7877, 7879, 7881, 7883, 7885, 7887,
+    7889, 7891, 7893, 7895, 7897, 7899, 7901, 7903, 7905, 7907, 7909, 7911,
+    7913, 7915, 7917, 7919, 7921, 7923, 7925, 7927, 7929, 7931, 7933, 7935,
+    7936, 7937, 7938, 7939, 7940, 7941, 7942, 7943, 7952, 7953, 7954, 7955,
+    7956, 7957, 7968, 7969, 7970, 7971, 7972, 7973, 7974, 7975, 7984, 7985,
+    7986, 7987, 7988, 7989, 7990, 7991, 8000, 8001, 8002, 8003, 8004, 8005,
+    965, 787, 965, 787, 768, 965, 787, 769, 965, 787, 834, 8017,
+    8019, 8021, 8023, 8032, 8033, 8034, 8035, 8036, 8037, 8038, 8039, 7936,
+    953, 7937, 953, 7938, 953, 7939, 953, 7940, 953, 7941, 953, 7942,
+    953, 7943, 953, 7936, 953, 7937, 953, 7938, 953, 7939, 953, 7940,
+    953, 7941, 953, 7942, 953, 7943, 953, 7968, 953, 7969, 953, 7970,
+    953, 7971, 953, 7972, 953, 7973, 953, 7974, 953, 7975, 953, 7968,
+    953, 7969, 953, 7970, 953, 7971, 953, 7972, 953, 7973, 953, 7974,
+    953, 7975, 953, 8032, 953, 8033, 953, 8034, 953, 8035, 953, 8036,
+    953, 8037, 953, 8038, 953, 8039, 953, 8032, 953, 8033, 953, 8034,
+    953, 8035, 953, 8036, 953, 8037, 953, 8038, 953, 8039, 953, 8048,
+    953, 945, 953, 940, 953, 945, 834, 945, 834, 953, 8112, 8113,
+    8048, 8049, 945, 953, 953, 8052, 953, 951, 953, 942, 953, 951,
+    834, 951, 834, 953, 8050, 8051, 8052, 8053, 951, 953, 953, 776,
+    768, 953, 776, 769, 953, 834, 953, 776, 834, 8144, 8145, 8054,
+    8055, 965, 776, 768, 965, 776, 769, 961, 787, 965, 834, 965,
+    776, 834, 8160, 8161, 8058, 8059, 8165, 8060, 953, 969, 953, 974,
+    953, 969, 834, 969, 834, 953, 8056, 8057, 8060, 8061, 969, 953,
+    969, 107, 229, 8526, 8560, 8561, 8562, 8563, 8564, 8565, 8566, 8567,
+    8568, 8569, 8570, 8571, 8572, 8573, 8574, 8575, 8580, 9424, 9425, 9426,
+    9427, 9428, 9429, 9430, 9431, 9432, 9433, 9434, 9435, 9436, 9437, 9438,
+    9439, 9440, 9441, 9442, 9443, 9444, 9445, 9446, 9447, 9448, 9449, 11312,
+    11313, 11314, 11315, 11316, 11317, 11318, 11319, 11320, 11321, 11322, 11323, 11324,
+    11325, 11326, 11327, 11328, 11329, 11330, 11331, 11332, 11333, 11334, 11335, 11336,
+    11337, 11338, 11339, 11340, 11341, 11342, 11343, 11344, 11345, 11346, 11347, 11348,
+    11349, 11350, 11351, 11352, 11353, 11354, 11355, 11356, 11357, 11358, 11359, 11361,
+    619, 7549, 637, 11368, 11370, 11372, 593, 625, 592, 594, 11379, 11382,
+    575, 576, 11393, 11395, 11397, 11399, 11401, 11403, 11405, 11407, 11409, 11411,
+    11413, 11415, 11417, 11419, 11421, 11423, 11425, 11427, 11429, 11431, 11433, 11435,
+    11437, 11439, 11441, 11443, 11445, 11447, 11449, 11451, 11453, 11455, 11457, 11459,
+    11461, 11463, 11465, 11467, 11469, 11471, 11473, 11475, 11477, 11479, 11481, 11483,
+    11485, 11487, 11489, 11491, 11500, 11502, 11507, 42561, 42563, 42565, 42567, 42569,
+    42571, 42573, 42575, 42577, 42579, 42581, 42583, 42585, 42587, 42589, 42591, 42593,
+    42595, 42597, 42599, 42601, 42603, 42605, 42625, 42627, 42629, 42631, 42633, 42635,
+    42637, 42639, 42641, 42643, 42645, 42647, 42649, 42651, 42787, 42789, 42791, 42793,
+    42795, 42797, 42799, 42803, 42805, 42807, 42809, 42811, 42813, 42815, 42817, 42819,
+    42821, 42823, 42825, 42827, 42829, 42831, 42833, 42835, 42837, 42839, 42841, 42843,
+    42845, 42847, 42849, 42851, 42853, 42855, 42857, 42859, 42861, 42863, 42874, 42876,
+    7545, 42879, 42881, 42883, 42885, 42887, 42892, 613, 42897, 42899, 42903, 42905,
+    42907, 42909, 42911, 42913, 42915, 42917, 42919, 42921, 614, 604, 609, 620,
+    618, 670, 647, 669, 43859, 42933, 42935, 42937, 42939, 42941, 42943, 42945,
+    42947, 42900, 642, 7566, 42952, 42954, 42961, 42967, 42969, 42998, 5024, 5025,
+    5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036, 5037,
+    5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045, 5046, 5047, 5048, 5049,
+    5050, 5051, 5052, 5053, 5054, 5055, 5056, 5057, 5058, 5059, 5060, 5061,
+    5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070, 5071, 5072, 5073,
+    5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 5083, 5084, 5085,
+    5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093, 5094, 5095, 5096, 5097,
+    5098, 5099, 5100, 5101, 5102, 5103, 102, 102, 102, 105, 102, 108,
+    102, 102, 105, 102, 102, 108, 115, 116, 115, 116, 1396, 1398,
+    1396, 1381, 1396, 1387, 1406, 1398, 1396, 1389, 65345, 65346, 65347, 65348,
+    65349, 65350, 65351, 65352, 65353, 65354, 65355, 65356, 65357, 65358, 65359, 65360,
+    65361, 65362, 65363, 65364, 65365, 65366, 65367, 65368, 65369, 65370, 66600, 66601,
+    66602, 66603, 66604, 66605, 66606, 66607, 66608, 66609, 66610, 66611, 66612, 66613,
+    66614, 66615, 66616, 66617, 66618, 66619, 66620, 66621, 66622, 66623, 66624, 66625,
+    66626, 66627, 66628, 66629, 66630, 66631, 66632, 66633, 66634, 66635, 66636, 66637,
+    66638, 66639, 66776, 66777, 66778, 66779, 66780, 66781, 66782, 66783, 66784, 66785,
+    66786, 66787, 66788, 66789, 66790, 66791, 66792, 66793, 66794, 66795, 66796, 66797,
+    66798, 66799, 66800, 66801, 66802, 66803, 66804, 66805, 66806, 66807, 66808, 66809,
+    66810, 66811, 66967, 66968, 66969, 66970, 66971, 66972, 66973, 66974, 66975, 66976,
+    66977, 66979, 66980, 66981, 66982, 66983, 66984, 66985, 66986, 66987, 66988, 66989,
+    66990, 66991, 66992, 66993, 66995, 66996, 66997, 66998, 66999, 67000, 67001, 67003,
+    67004, 68800, 68801, 68802, 68803, 68804, 68805, 68806, 68807, 68808, 68809, 68810,
+    68811, 68812, 68813, 68814, 68815, 68816, 68817, 68818, 68819, 68820, 68821, 68822,
+    68823, 68824, 68825, 68826, 68827, 68828, 68829, 68830, 68831, 68832, 68833, 68834,
+    68835, 68836, 68837, 68838, 68839, 68840, 68841, 68842, 68843, 68844, 68845, 68846,
+    68847, 68848, 68849, 68850, 71872, 71873, 71874, 71875, 71876, 71877, 71878, 71879,
+    71880, 71881, 71882, 71883, 71884, 71885, 71886, 71887, 71888, 71889, 71890, 71891,
+    71892, 71893, 71894, 71895, 71896, 71897, 71898, 71899, 71900, 71901, 71902, 71903,
+    93792, 93793, 93794, 93795, 93796, 93797, 93798, 93799, 93800, 93801, 93802, 93803,
+    93804, 93805, 93806, 93807, 93808, 93809, 93810, 93811, 93812, 93813, 93814, 93815,
+    93816, 93817, 93818, 93819, 93820, 93821, 93822, 93823, 125218, 125219, 125220, 125221,
+    125222, 125223, 125224, 125225, 125226, 125227, 125228, 125229, 125230, 125231, 125232, 125233,
+    125234, 125235, 125236, 125237, 125238, 125239, 125240, 125241, 125242, 125243, 125244, 125245,
+    125246, 125247, 125248, 125249, 125250, 125251,
+};
+
+// Full canonical decompositions, Hangul syllables are algorithmic
+static const size_t UNI_NFD_SIZE = 2061;
+static const uint32_t UNI_NFD_KEYS[] = {
+    192, 193, 194, 195, 196, 197, 199, 200, 201, 202, 203, 204,
+    205, 206, 207, 209, 210, 211, 212, 213, 214, 217, 218, 219,
+    220, 221, 224, 225, 226, 227, 228, 229, 231, 232, 233, 234,
+    235, 236, 237, 238, 239, 241, 242, 243, 244, 245, 246, 249,
+    250, 251, 252, 253, 255, 256, 257, 258, 259, 260, 261, 262,
+    263, 264, 265, 266, 267, 268, 269, 270, 271, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288,
+    289, 290, 291, 292, 293, 296, 297, 298, 299, 300, 301, 302,
+    303, 304, 308, 309, 310, 311, 313, 314, 315, 316, 317, 318,
+    323, 324, 325, 326, 327, 328, 332, 333, 334, 335, 336, 337,
+    340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 360, 361, 362, 363, 364, 365,
+    366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+    378, 379, 380, 381, 382, 416, 417, 431, 432, 461, 462, 463,
+    464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+    476, 478, 479, 480, 481, 482, 483, 486, 487, 488, 489, 490,
+    491, 492, 493, 494, 495, 496, 500, 501, 504, 505, 506, 507,
+    508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+    520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 542, 543, 550, 551,
+    552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    832, 833, 835, 836, 884, 894, 901, 902, 903, 904, 905, 906,
+    908, 910, 911, 912, 938, 939, 940, 941, 942, 943, 944, 970,
+    971, 972, 973, 974, 979, 980, 1024, 1025, 1027, 1031, 1036, 1037,
+    1038, 1049, 1081, 1104, 1105, 1107, 1111, 1116, 1117, 1118, 1142, 1143,
+    1217, 1218, 1232, 1233, 1234, 1235, 1238, 1239, 1242, 1243, 1244, 1245,
+    1246, 1247, 1250, 1251, 1252, 1253, 1254, 1255, 1258, 1259, 1260, 1261,
+    1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1272, 1273, 1570, 1571,
+    1572, 1573, 1574, 1728, 1730, 1747, 2345, 2353, 2356, 2392, 2393, 2394,
+    2395, 2396, 2397, 2398, 2399, 2507, 2508, 2524, 2525, 2527, 2611, 2614,
+    2649, 2650, 2651, 2654, 2888, 2891, 2892, 2908, 2909, 2964, 3018, 3019,
+    3020, 3144, 3264, 3271, 3272, 3274, 3275, 3402, 3403, 3404, 3546, 3548,
+    3549, 3550, 3907, 3917, 3922, 3927, 3932, 3945, 3955, 3957, 3958, 3960,
+    3969, 3987, 3997, 4002, 4007, 4012, 4025, 4134, 6918, 6920, 6922, 6924,
+    6926, 6930, 6971, 6973, 6976, 6977, 6979, 7680, 7681, 7682, 7683, 7684,
+    7685, 7686, 7687, 7688, 7689, 7690, 7691, 7692, 7693, 7694, 7695, 7696,
+    7697, 7698, 7699, 7700, 7701, 7702, 7703, 7704, 7705, 7706, 7707, 7708,
+    7709, 7710, 7711, 7712, 7713, 7714, 7715, 7716, 7717, 7718, 7719, 7720,
+    7721, 7722, 7723, 7724, 7725, 7726, 7727, 7728, 7729, 7730, 7731, 7732,
+    7733, 7734, 7735, 7736, 7737, 7738, 7739, 7740, 7741, 7742, 7743, 7744,
+    7745, 7746, 7747, 7748, 7749, 7750, 7751, 7752, 7753, 7754, 7755, 7756,
+    7757, 7758, 7759, 7760, 7761, 7762, 7763, 7764, 7765, 7766, 7767, 7768,
+    7769, 7770, 7771, 7772, 7773, 7774, 7775, 7776, 7777, 7778, 7779, 7780,
+    7781, 7782, 7783, 7784, 7785, 7786, 7787, 7788, 7789, 7790, 7791, 7792,
+    7793, 7794, 7795, 7796, 7797, 7798, 7799, 7800, 7801, 7802, 7803, 7804,
+    7805, 7806, 7807, 7808, 7809, 7810, 7811, 7812, 7813, 7814, 7815, 7816,
+    7817, 7818, 7819, 7820, 7821, 7822, 7823, 7824, 7825, 7826, 7827, 7828,
+    7829, 7830, 7831, 7832, 7833, 7835, 7840, 7841, 7842, 7843, 7844, 7845,
+    7846, 7847, 7848, 7849, 7850, 7851, 7852, 7853, 7854, 7855, 7856, 7857,
+    7858, 7859, 7860, 7861, 7862, 7863, 7864, 7865, 7866, 7867, 7868, 7869,
+    7870, 7871, 7872, 7873, 7874, 7875, 7876, 7877, 7878, 7879, 7880, 7881,
+    7882, 7883, 7884, 7885, 7886, 7887, 7888, 7889, 7890, 7891, 7892, 7893,
+    7894, 7895, 7896, 7897, 7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905,
+    7906, 7907, 7908, 7909, 7910, 7911, 7912, 7913, 7914, 7915, 7916, 7917,
+    7918, 7919, 7920, 7921, 7922, 7923, 7924, 7925, 7926, 7927, 7928, 7929,
+    7936, 7937, 7938, 7939, 7940, 7941, 7942, 7943, 7944, 7945, 7946, 7947,
+    7948, 7949, 7950, 7951, 7952, 7953, 7954, 7955, 7956, 7957, 7960, 7961,
+    7962, 7963, 7964, 7965, 7968, 7969, 7970, 7971, 7972, 7973, 7974, 7975,
+    7976, 7977, 7978, 7979, 7980, 7981, 7982, 7983, 7984, 7985, 7986, 7987,
+    7988, 7989, 7990, 7991, 7992, 7993, 7994, 7995, 7996, 7997, 7998, 7999,
+    8000, 8001, 8002, 8003, 8004, 8005, 8008, 8009, 8010, 8011, 8012, 8013,
+    8016, 8017, 8018, 8019, 8020, 8021, 8022, 8023, 8025, 8027, 8029, 8031,
+    8032, 8033, 8034, 8035, 8036, 8037, 8038, 8039, 8040, 8041, 8042, 8043,
+    8044, 8045, 8046, 8047, 8048, 8049, 8050, 8051, 8052, 8053, 8054, 8055,
+    8056, 8057, 8058, 8059, 8060, 8061, 8064, 8065, 8066, 8067, 8068, 8069,
+    8070, 8071, 8072, 8073, 8074, 8075, 8076, 8077, 8078, 8079, 8080, 8081,
+    8082, 8083, 8084, 8085, 8086, 8087, 8088, 8089, 8090, 8091, 8092, 8093,
+    8094, 8095, 8096, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8104, 8105,
+    8106, 8107, 8108, 8109, 8110, 8111, 8112, 8113, 8114, 8115, 8116, 8118,
+    8119, 8120, 8121, 8122, 8123, 8124, 8126, 8129, 8130, 8131, 8132, 8134,
+    8135, 8136, 8137, 8138, 8139, 8140, 8141, 8142, 8143, 8144, 8145, 8146,
+    8147, 8150, 8151, 8152, 8153, 8154, 8155, 8157, 8158, 8159, 8160, 8161,
+    8162, 8163, 8164, 8165, 8166, 8167, 8168, 8169, 8170, 8171, 8172, 8173,
+    8174, 8175, 8178, 8179, 8180, 8182, 8183, 8184, 8185, 8186, 8187, 8188,
+    8189, 8192, 8193, 8486, 8490, 8491, 8602, 8603, 8622, 8653, 8654, 8655,
+    8708, 8713, 8716, 8740, 8742, 8769, 8772, 8775, 8777, 8800, 8802, 8813,
+    8814, 8815, 8816, 8817, 8820, 8821, 8824, 8825, 8832, 8833, 8836, 8837,
+    8840, 8841, 8876, 8877, 8878, 8879, 8928, 8929, 8930, 8931, 8938, 8939,
+    8940, 8941, 9001, 9002, 10972, 12364, 12366, 12368, 12370, 12372, 12374, 12376,
+    12378, 12380, 12382, 12384, 12386, 12389, 12391, 12393, 12400, 12401, 12403, 12404,
+    12406, 12407, 12409, 12410, 12412, 12413, 12436, 12446, 12460, 12462, 12464, 12466,
+    12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12485, 12487, 12489, 12496,
+    12497, 12499, 12500, 12502, 12503, 12505, 12506, 12508, 12509, 12532, 12535, 12536,
+    12537, 12538, 12542, 63744, 63745, 63746, 63747, 63748, 63749, 63750, 63751, 63752,
+    63753, 63754, 63755, 63756, 63757, 63758, 63759, 63760, 63761, 63762, 63763, 63764,
+    63765, 63766, 63767, 63768, 63769, 63770, 63771, 63772, 63773, 63774, 63775, 63776,
+    63777, 63778, 63779, 63780, 63781, 63782, 63783, 63784, 63785, 63786, 63787, 63788,
+    63789, 63790, 63791, 63792, 63793, 63794, 63795, 63796, 63797, 63798, 63799, 63800,
+    63801, 63802, 63803, 63804, 63805, 63806, 63807, 63808, 63809, 63810, 63811, 63812,
+    63813, 63814, 63815, 63816, 63817, 63818, 63819, 63820, 63821, 63822, 63823, 63824,
+    63825, 63826, 63827, 63828, 63829, 63830, 63831, 63832, 63833, 63834, 63835, 63836,
+    63837, 63838, 63839, 63840, 63841, 63842, 63843, 63844, 63845, 63846, 63847, 63848,
+    63849, 63850, 63851, 63852, 63853, 63854, 63855, 63856, 63857, 63858, 63859, 63860,
+    63861, 63862, 63863, 63864, 63865, 63866, 63867, 63868, 63869, 63870, 63871, 63872,
+    63873, 63874, 63875, 63876, 63877, 63878, 63879, 63880, 63881, 63882, 63883, 63884,
+    63885, 63886, 63887, 63888, 63889, 63890, 63891, 63892, 63893, 63894, 63895, 63896,
+    63897, 63898, 63899, 63900, 63901, 63902, 63903, 63904, 63905, 63906, 63907, 63908,
+    63909, 63910, 63911, 63912, 63913, 63914, 63915, 63916, 63917, 63918, 63919, 63920,
+    63921, 63922, 63923, 63924, 63925, 63926, 63927, 63928, 63929, 63930, 63931, 63932,
+    63933, 63934, 63935, 63936, 63937, 63938, 63939, 63940, 63941, 63942, 63943, 63944,
+    63945, 63946, 63947, 63948, 63949, 63950, 63951, 63952, 63953, 63954, 63955, 63956,
+    63957, 63958, 63959, 63960, 63961, 63962, 63963, 63964, 63965, 63966, 63967, 63968,
+    63969, 63970, 63971, 63972, 63973, 63974, 63975, 63976, 63977, 63978, 63979, 63980,
+    63981, 63982, 63983, 63984, 63985, 63986, 63987, 63988, 63989, 63990, 63991, 63992,
+    63993, 63994, 63995, 63996, 63997, 63998, 63999, 64000, 64001, 64002, 64003, 64004,
+    64005, 64006, 64007, 64008, 64009, 64010, 64011, 64012, 64013, 64016, 64018, 64021,
+    64022, 64023, 64024, 64025, 64026, 64027, 64028, 64029, 64030, 64032, 64034, 64037,
+    64038, 64042, 64043, 64044, 64045, 64046, 64047, 64048, 64049, 64050, 64051, 64052,
+    64053, 64054, 64055, 64056, 64057, 64058, 64059, 64060, 64061, 64062, 64063, 64064,
+    64065, 64066, 64067, 64068, 64069, 64070, 64071, 64072, 64073, 64074, 64075, 64076,
+    64077, 64078, 64079, 64080, 64081, 64082, 64083, 64084, 64085, 64086, 64087, 64088,
+    64089, 64090, 64091, 64092, 64093, 64094, 64095, 64096, 64097, 64098, 64099, 64100,
+    64101, 64102, 64103, 64104, 64105, 64106, 64107, 64108, 64109, 64112, 64113, 64114,
+    64115, 64116, 64117, 64118, 64119, 64120, 64121, 64122, 64123, 64124, 64125, 64126,
+    64127, 64128, 64129, 64130, 64131, 64132, 64133, 64134, 64135, 64136, 64137, 64138,
+    64139, 64140, 64141, 64142, 64143, 64144, 64145, 64146, 64147, 64148, 64149, 64150,
+    64151, 64152, 64153, 64154, 64155, 64156, 64157, 64158, 64159, 64160, 64161, 64162,
+    64163, 64164, 64165, 64166, 64167, 64168, 64169, 64170, 64171, 64172, 64173, 64174,
+    64175, 64176, 64177, 64178, 64179, 64180, 64181, 64182, 64183, 64184, 64185, 64186,
+    64187, 64188, 64189, 64190, 64191, 64192, 64193, 64194, 64195, 64196, 64197, 64198,
+    64199, 64200, 64201, 64202, 64203, 64204, 64205, 64206, 64207, 64208, 64209, 64210,
+    64211, 64212, 64213, 64214, 64215, 64216, 64217, 64285, 64287, 64298, 64299, 64300,
+    64301, 64302, 64303, 64304, 64305, 64306, 64307, 64308, 64309, 64310, 64312, 64313,
+    64314, 64315, 64316, 64318, 64320, 64321, 64323, 64324, 64326, 64327, 64328, 64329,
+    64330, 64331, 64332, 64333, 64334, 69786, 69788, 69803, 69934, 69935, 70475, 70476,
+    70843, 70844, 70846, 71098, 71099, 71992, 119134, 119135, 119136, 119137, 119138, 119139,
+    119140, 119227, 119228, 119229, 119230, 119231, 119232, 194560, 194561, 194562, 194563, 194564,
+    194565, 194566, 194567, 194568, 194569, 194570, 194571, 194572, 194573, 194574, 194575, 194576,
+    194577, 194578, 194579, 194580, 194581, 194582, 194583, 194584, 194585, 194586, 194587, 194588,
+    194589, 194590, 194591, 194592, 194593, 194594, 194595, 194596, 194597, 194598, 194599, 194600,
+    194601, 194602, 194603, 194604, 194605, 194606, 194607, 194608, 194609, 194610, 194611, 194612,
+    194613, 194614, 194615, 194616, 194617, 194618, 194619, 194620, 194621, 194622, 194623, 194624,
+    194625, 194626, 194627, 194628, 194629, 194630, 194631, 194632, 194633, 194634, 194635, 194636,
+    194637, 194638, 194639, 194640, 194641, 194642, 194643, 194644, 194645, 194646, 194647, 194648,
+    194649, 194650, 194651, 194652, 194653, 194654, 194655, 194656, 194657, 194658, 194659, 194660,
+    194661, 194662, 194663, 194664, 194665, 194666, 194667, 194668, 194669, 194670, 194671, 194672,
+    194673, 194674, 194675, 194676, 194677, 194678, 194679, 194680, 194681, 194682, 194683, 194684,
+    194685, 194686, 194687, 194688, 194689, 194690, 194691, 194692, 194693, 194694, 194695, 194696,
+    194697, 194698, 194699, 194700, 194701, 194702, 194703, 194704, 194705, 194706, 194707, 194708,
+    194709, 194710, 194711, 194712, 194713, 194714, 194715, 194716, 194717, 194718, 194719, 194720,
+    194721, 194722, 194723, 194724, 194725, 194726, 194727, 194728, 194729, 194730, 194731, 194732,
+    194733, 194734, 194735, 194736, 194737, 194738, 194739, 194740, 194741, 194742, 194743, 194744,
+    194745, 194746, 194747, 194748, 194749, 194750, 194751, 194752, 194753, 194754, 194755, 194756,
+    194757, 194758, 194759, 194760, 194761, 194762, 194763, 194764, 194765, 194766, 194767, 194768,
+    194769, 194770, 194771, 194772, 194773, 194774, 194775, 194776, 194777, 194778, 194779, 194780,
+    194781, 194782, 194783, 194784, 194785, 194786, 194787, 194788, 194789, 194790, 194791, 194792,
+    194793, 194794, 194795, 194796, 194797, 194798, 194799, 194800, 194801, 194802, 194803, 194804,
+    194805, 194806, 194807, 194808, 194809, 194810, 194811, 194812, 194813, 194814, 194815, 194816,
+    194817, 194818, 194819, 194820, 194821, 194822, 194823, 194824, 194825, 194826, 194827, 194828,
+    194829, 194830, 194831, 194832, 194833, 194834, 194835, 194836, 194837, 194838, 194839, 194840,
+    194841, 194842, 194843, 194844, 194845, 194846, 194847, 194848, 194849, 194850, 194851, 194852,
+    194853, 194854, 194855, 194856, 194857, 194858, 194859, 194860, 194861, 194862, 194863, 194864,
+    194865, 194866, 194867, 194868, 194869, 194870, 194871, 194872, 194873, 194874, 194875, 194876,
+    194877, 194878, 194879, 194880, 194881, 194882, 194883, 194884, 194885, 194886, 194887, 194888,
+    194889, 194890, 194891, 194892, 194893, 194894, 194895, 194896, 194897, 194898, 194899, 194900,
+    194901, 194902, 194903, 194904, 194905, 194906, 194907, 194908, 194909, 194910, 194911, 194912,
+    194913, 194914, 194915, 194916, 194917, 194918, 194919, 194920, 194921, 194922, 194923, 194924,
+    194925, 194926, 194927, 194928, 194929, 194930, 194931, 194932, 194933, 194934, 194935, 194936,
+    194937, 194938, 194939, 194940, 194941, 194942, 194943, 194944, 194945, 194946, 194947, 194948,
+    194949, 194950, 194951, 194952, 194953, 194954, 194955, 194956, 194957, 194958, 194959, 194960,
+    194961, 194962, 194963, 194964, 194965, 194966, 194967, 194968, 194969, 194970, 194971, 194972,
+    194973, 194974, 194975, 194976, 194977, 194978, 194979, 194980, 194981, 194982, 194983, 194984,
+    194985, 194986, 194987, 194988, 194989, 194990, 194991, 194992, 194993, 194994, 194995, 194996,
+    194997, 194998, 194999, 195000, 195001, 195002, 195003, 195004, 195005, 195006, 195007, 195008,
+    195009, 195010, 195011, 195012, 195013, 195014, 195015, 195016, 195017, 195018, 195019, 195020,
+    195021, 195022, 195023, 195024, 195025, 195026, 195027, 195028, 195029, 195030, 195031, 195032,
+    195033, 195034, 195035, 195036, 195037, 195038, 195039, 195040, 195041, 195042, 195043, 195044,
+    195045, 195046, 195047, 195048, 195049, 195050, 195051, 195052, 195053, 195054, 195055, 195056,
+    195057, 195058, 195059, 195060, 195061, 195062, 195063, 195064, 195065, 195066, 195067, 195068,
+    195069, 195070, 195071, 195072, 195073, 195074, 195075, 195076, 195077, 195078, 195079, 195080,
+    195081, 195082, 195083, 195084, 195085, 195086, 195087, 195088, 195089, 195090, 195091, 195092,
+    195093, 195094, 195095, 195096, 195097, 195098, 195099, 195100, 195101,
+};
+static const uint32_t UNI_NFD_VALS[] = {
+    2, 514, 1026, 1538, 2050, 2562, 3074, 3586, 4098, 4610, 5122, 5634,
+    6146, 6658, 7170, 7682, 8194, 8706, 9218, 9730, 10242, 10754, 11266, 11778,
+    12290, 12802, 13314, 13826, 14338, 14850, 15362, 15874, 16386, 16898, 17410, 17922,
+    18434, 18946, 19458, 19970, 20482, 20994, 21506, 22018, 22530, 23042, 23554, 24066,
+    24578, 25090, 25602, 26114, 26626, 27138, 27650, 28162, 28674, 29186, 29698, 30210,
+    30722, 31234, 31746, 32258, 32770, 33282, 33794, 34306, 34818, 35330, 35842, 36354,
+    36866, 37378, 37890, 38402, 38914, 39426, 39938, 40450, 40962, 41474, 41986, 42498,
+    43010, 43522, 44034, 44546, 45058, 45570, 46082, 46594, 47106, 47618, 48130, 48642,
+    49154, 49666, 50178, 50690, 51202, 51714, 52226, 52738, 53250, 53762, 54274, 54786,
+    55298, 55810, 56322, 56834, 57346, 57858, 58370, 58882, 59394, 59906, 60418, 60930,
+    61442, 61954, 62466, 62978, 63490, 64002, 64514, 65026, 65538, 66050, 66562, 67074,
+    67586, 68098, 68610, 69122, 69634, 70146, 70658, 71170, 71682, 72194, 72706, 73218,
+    73730, 74242, 74754, 75266, 75778, 76290, 76802, 77314, 77826, 78338, 78850, 79362,
+    79874, 80386, 80898, 81410, 81922, 82434, 82946, 83458, 83970, 84482, 84994, 85506,
+    86018, 86530, 87042, 87554, 88066, 88579, 89347, 90115, 90883, 91651, 92419, 93187,
+    93955, 94723, 95491, 96259, 97027, 97794, 98306, 98818, 99330, 99842, 100354, 100866,
+    101378, 101891, 102659, 103426, 103938, 104450, 104962, 105474, 105986, 106498, 107011, 107779,
+    108546, 109058, 109570, 110082, 110594, 111106, 111618, 112130, 112642, 113154, 113666, 114178,
+    114690, 115202, 115714, 116226, 116738, 117250, 117762, 118274, 118786, 119298, 119810, 120322,
+    120834, 121346, 121858, 122370, 122882, 123394, 123906, 124418, 124930, 125442, 125954, 126466,
+    126978, 127490, 128003, 128771, 129539, 130307, 131074, 131586, 132099, 132867, 133634, 134146,
+    134657, 134913, 135169, 135426, 135937, 136193, 136450, 136962, 137473, 137730, 138242, 138754,
+    139266, 139778, 140290, 140803, 141570, 142082, 142594, 143106, 143618, 144130, 144643, 145410,
+    145922, 146434, 146946, 147458, 147970, 148482, 148994, 149506, 150018, 150530, 151042, 151554,
+    152066, 152578, 153090, 153602, 154114, 154626, 155138, 155650, 156162, 156674, 157186, 157698,
+    158210, 158722, 159234, 159746, 160258, 160770, 161282, 161794, 162306, 162818, 163330, 163842,
+    164354, 164866, 165378, 165890, 166402, 166914, 167426, 167938, 168450, 168962, 169474, 169986,
+    170498, 171010, 171522, 172034, 172546, 173058, 173570, 174082, 174594, 175106, 175618, 176130,
+    176642, 177154, 177666, 178178, 178690, 179202, 179714, 180226, 180738, 181250, 181762, 182274,
+    182786, 183298, 183810, 184322, 184834, 185346, 185858, 186370, 186882, 187394, 187906, 188418,
+    188930, 189442, 189954, 190466, 190978, 191490, 192002, 192514, 193026, 193538, 194050, 194562,
+    195074, 195586, 196098, 196610, 197122, 197634, 198147, 198914, 199426, 199938, 200450, 200962,
+    201475, 202242, 202754, 203266, 203778, 204290, 204802, 205314, 205826, 206338, 206850, 207362,
+    207874, 208386, 208898, 209410, 209922, 210434, 210946, 211458, 211970, 212482, 212994, 213506,
+    214018, 214530, 215042, 215554, 216066, 216578, 217090, 217602, 218114, 218626, 219138, 219650,
+    220162, 220674, 221186, 221699, 222467, 223234, 223746, 224258, 224770, 225282, 225794, 226306,
+    226818, 227330, 227842, 228355, 229123, 229891, 230659, 231426, 231938, 232450, 232962, 233475,
+    234243, 235010, 235522, 236034, 236546, 237058, 237570, 238082, 238594, 239106, 239618, 240130,
+    240642, 241154, 241666, 242178, 242690, 243203, 243971, 244738, 245250, 245762, 246274, 246786,
+    247298, 247810, 248322, 248835, 249603, 250370, 250882, 251394, 251906, 252418, 252930, 253442,
+    253954, 254466, 254978, 255490, 256002, 256514, 257026, 257538, 258050, 258562, 259074, 259587,
+    260355, 261123, 261891, 262659, 263427, 264195, 264963, 265730, 266242, 266754, 267266, 267778,
+    268290, 268802, 269314, 269827, 270595, 271362, 271874, 272386, 272898, 273410, 273922, 274435,
+    275203, 275971, 276739, 277507, 278275, 279042, 279554, 280066, 280578, 281090, 281602, 282114,
+    282626, 283138, 283650, 284162, 284674, 285186, 285698, 286211, 286979, 287747, 288515, 289282,
+    289794, 290306, 290818, 291330, 291842, 292354, 292866, 293378, 293890, 294402, 294914, 295426,
+    295938, 296450, 296962, 297474, 297986, 298498, 299010, 299522, 300034, 300546, 301058, 301570,
+    302082, 302594, 303106, 303618, 304130, 304642, 305154, 305666, 306178, 306690, 307203, 307971,
+    308739, 309507, 310275, 311043, 311811, 312579, 313347, 314115, 314883, 315651, 316419, 317187,
+    317955, 318723, 319491, 320259, 321027, 321795, 322562, 323074, 323586, 324098, 324610, 325122,
+    325635, 326403, 327171, 327939, 328707, 329475, 330243, 331011, 331779, 332547, 333314, 333826,
+    334338, 334850, 335362, 335874, 336386, 336898, 337411, 338179, 338947, 339715, 340483, 341251,
+    342019, 342787, 343555, 344323, 345091, 345859, 346627, 347395, 348163, 348931, 349699, 350467,
+    351235, 352003, 352770, 353282, 353794, 354306, 354819, 355587, 356355, 357123, 357891, 358659,
+    359427, 360195, 360963, 361731, 362498, 363010, 363522, 364034, 364546, 365058, 365570, 366082,
+    366594, 367106, 367619, 368387, 369155, 369923, 370691, 371459, 372226, 372738, 373251, 374019,
+    374787, 375555, 376323, 377091, 377858, 378370, 378883, 379651, 380419, 381187, 381954, 382466,
+    382979, 383747, 384515, 385283, 386050, 386562, 387075, 387843, 388611, 389379, 390147, 390915,
+    391682, 392194, 392707, 393475, 394243, 395011, 395779, 396547, 397314, 397826, 398339, 399107,
+    399875, 400643, 401411, 402179, 402946, 403458, 403971, 404739, 405507, 406275, 407043, 407811,
+    408578, 409090, 409603, 410371, 411139, 411907, 412674, 413186, 413699, 414467, 415235, 416003,
+    416770, 417282, 417795, 418563, 419331, 420099, 420867, 421635, 422402, 422915, 423683, 424451,
+    425218, 425730, 426243, 427011, 427779, 428547, 429315, 430083, 430850, 431362, 431875, 432643,
+    433411, 434179, 434947, 435715, 436482, 436994, 437506, 438018, 438530, 439042, 439554, 440066,
+    440578, 441090, 441602, 442114, 442626, 443138, 443651, 444419, 445188, 446212, 447236, 448260,
+    449284, 450308, 451331, 452099, 452868, 453892, 454916, 455940, 456964, 457988, 459011, 459779,
+    460548, 461572, 462596, 463620, 464644, 465668, 466691, 467459, 468228, 469252, 470276, 471300,
+    472324, 473348, 474371, 475139, 475908, 476932, 477956, 478980, 480004, 481028, 482051, 482819,
+    483588, 484612, 485636, 486660, 487684, 488708, 489730, 490242, 490755, 491522, 492035, 492802,
+    493315, 494082, 494594, 495106, 495618, 496130, 496641, 496898, 497411, 498178, 498691, 499458,
+    499971, 500738, 501250, 501762, 502274, 502786, 503298, 503810, 504322, 504834, 505346, 505859,
+    506627, 507394, 507907, 508674, 509186, 509698, 510210, 510722, 511234, 511746, 512258, 512770,
+    513283, 514051, 514818, 515330, 515842, 516355, 517122, 517634, 518146, 518658, 519170, 519682,
+    520194, 520705, 520963, 521730, 522243, 523010, 523523, 524290, 524802, 525314, 525826, 526338,
+    526849, 527105, 527361, 527617, 527873, 528130, 528642, 529154, 529666, 530178, 530690, 531202,
+    531714, 532226, 532738, 533250, 533762, 534274, 534786, 535298, 535810, 536322, 536834, 537346,
+    537858, 538370, 538882, 539394, 539906, 540418, 540930, 541442, 541954, 542466, 542978, 543490,
+    544002, 544514, 545026, 545538, 546050, 546562, 547074, 547586, 548098, 548610, 549122, 549634,
+    550146, 550658, 551169, 551425, 551682, 552194, 552706, 553218, 553730, 554242, 554754, 555266,
+    555778, 556290, 556802, 557314, 557826, 558338, 558850, 559362, 559874, 560386, 560898, 561410,
+    561922, 562434, 562946, 563458, 563970, 564482, 564994, 565506, 566018, 566530, 567042, 567554,
+    568066, 568578, 569090, 569602, 570114, 570626, 571138, 571650, 572162, 572674, 573186, 573698,
+    574210, 574722, 575234, 575746, 576258, 576770, 577282, 577794, 578306, 578818, 579330, 579842,
+    580354, 580866, 581378, 581889, 582145, 582401, 582657, 582913, 583169, 583425, 583681, 583937,
+    584193, 584449, 584705, 584961, 585217, 585473, 585729, 585985, 586241, 586497, 586753, 587009,
+    587265, 587521, 587777, 588033, 588289, 588545, 588801, 589057, 589313, 589569, 589825, 590081,
+    590337, 590593, 590849, 591105, 591361, 591617, 591873, 592129, 592385, 592641, 592897, 593153,
+    593409, 593665, 593921, 594177, 594433, 594689, 594945, 595201, 595457, 595713, 595969, 596225,
+    596481, 596737, 596993, 597249, 597505, 597761, 598017, 598273, 598529, 598785, 599041, 599297,
+    599553, 599809, 600065, 600321, 600577, 600833, 601089, 601345, 601601, 601857, 602113, 602369,
+    602625, 602881, 603137, 603393, 603649, 603905, 604161, 604417, 604673, 604929, 605185, 605441,
+    605697, 605953, 606209, 606465, 606721, 606977, 607233, 607489, 607745, 608001, 608257, 608513,
+    608769, 609025, 609281, 609537, 609793, 610049, 610305, 610561, 610817, 611073, 611329, 611585,
+    611841, 612097, 612353, 612609, 612865, 613121, 613377, 613633, 613889, 614145, 614401, 614657,
+    614913, 615169, 615425, 615681, 615937, 616193, 616449, 616705, 616961, 617217, 617473, 617729,
+    617985, 618241, 618497, 618753, 619009, 619265, 619521, 619777, 620033, 620289, 620545, 620801,
+    621057, 621313, 621569, 621825, 622081, 622337, 622593, 622849, 623105, 623361, 623617, 623873,
+    624129, 624385, 624641, 624897, 625153, 625409, 625665, 625921, 626177, 626433, 626689, 626945,
+    627201, 627457, 627713, 627969, 628225, 628481, 628737, 628993, 629249, 629505, 629761, 630017,
+    630273, 630529, 630785, 631041, 631297, 631553, 631809, 632065, 632321, 632577, 632833, 633089,
+    633345, 633601, 633857, 634113, 634369, 634625, 634881, 635137, 635393, 635649, 635905, 636161,
+    636417, 636673, 636929, 637185, 637441, 637697, 637953, 638209, 638465, 638721, 638977, 639233,
+    639489, 639745, 640001, 640257, 640513, 640769, 641025, 641281, 641537, 641793, 642049, 642305,
+    642561, 642817, 643073, 643329, 643585, 643841, 644097, 644353, 644609, 644865, 645121, 645377,
+    645633, 645889, 646145, 646401, 646657, 646913, 647169, 647425, 647681, 647937, 648193, 648449,
+    648705, 648961, 649217, 649473, 649729, 649985, 650241, 650497, 650753, 651009, 651265, 651521,
+    651777, 652033, 652289, 652545, 652801, 653057, 653313, 653569, 653825, 654081, 654337, 654593,
+    654849, 655105, 655361, 655617, 655873, 656129, 656385, 656641, 656897, 657153, 657409, 657665,
+    657921, 658177, 658433, 658689, 658945, 659201, 659457, 659713, 659969, 660225, 660481, 660737,
+    660993, 661249, 661505, 661761, 662017, 662273, 662529, 662785, 663041, 663297, 663553, 663809,
+    664065, 664321, 664577, 664833, 665089, 665345, 665601, 665857, 666113, 666369, 666625, 666881,
+    667137, 667393, 667649, 667905, 668161, 668417, 668673, 668929, 669185, 669441, 669697, 669953,
+    670209, 670465, 670721, 670977, 671233, 671489, 671745, 672001, 672257, 672513, 672769, 673025,
+    673281, 673537, 673793, 674049, 674305, 674561, 674817, 675073, 675329, 675585, 675841, 676097,
+    676353, 676609, 676865, 677121, 677377, 677633, 677889, 678145, 678401, 678657, 678913, 679169,
+    679425, 679681, 679937, 680193, 680449, 680705, 680961, 681217, 681473, 681729, 681985, 682241,
+    682497, 682753, 683009, 683265, 683521, 683777, 684033, 684289, 684545, 684801, 685057, 685313,
+    685569, 685825, 686081, 686337, 686593, 686849, 687105, 687361, 687617, 687873, 688129, 688385,
+    688641, 688897, 689153, 689409, 689665, 689921, 690177, 690433, 690689, 690945, 691201, 691457,
+    691713, 691969, 692225, 692481, 692737, 692993, 693249, 693505, 693761, 694017, 694273, 694529,
+    694785, 695041, 695297, 695553, 695809, 696065, 696321, 696577, 696833, 697089, 697345, 697601,
+    697857, 698113, 698369, 698625, 698881, 699137, 699393, 699650, 700162, 700674, 701186, 701699,
+    702467, 703234, 703746, 704258, 704770, 705282, 705794, 706306, 706818, 707330, 707842, 708354,
+    708866, 709378, 709890, 710402, 710914, 711426, 711938, 712450, 712962, 713474, 713986, 714498,
+    715010, 715522, 716034, 716546, 717058, 717570, 718082, 718594, 719106, 719618, 720130, 720642,
+    721154, 721666, 722178, 722690, 723202, 723714, 724226, 724738, 725251, 726019, 726787, 727555,
+    728323, 729090, 729602, 730115, 730883, 731651, 732419, 733185, 733441, 733697, 733953, 734209,
+    734465, 734721, 734977, 735233, 735489, 735745, 736001, 736257, 736513, 736769, 737025, 737281,
+    737537, 737793, 738049, 738305, 738561, 738817, 739073, 739329, 739585, 739841, 740097, 740353,
+    740609, 740865, 741121, 741377, 741633, 741889, 742145, 742401, 742657, 742913, 743169, 743425,
+    743681, 743937, 744193, 744449, 744705, 744961, 745217, 745473, 745729, 745985, 746241, 746497,
+    746753, 747009, 747265, 747521, 747777, 748033, 748289, 748545, 748801, 749057, 749313, 749569,
+    749825, 750081, 750337, 750593, 750849, 751105, 751361, 751617, 751873, 752129, 752385, 752641,
+    752897, 753153, 753409, 753665, 753921, 754177, 754433, 754689, 754945, 755201, 755457, 755713,
+    755969, 756225, 756481, 756737, 756993, 757249, 757505, 757761, 758017, 758273, 758529, 758785,
+    759041, 759297, 759553, 759809, 760065, 760321, 760577, 760833, 761089, 761345, 761601, 761857,
+    762113, 762369, 762625, 762881, 763137, 763393, 763649, 763905, 764161, 764417, 764673, 764929,
+    765185, 765441, 765697, 765953, 766209, 766465, 766721, 766977, 767233, 767489, 767745, 768001,
+    768257, 768513, 768769, 769025, 769281, 769537, 769793, 770049, 770305, 770561, 770817, 771073,
+    771329, 771585, 771841, 772097, 772353, 772609, 772865, 773121, 773377, 773633, 773889, 774145,
+    774401, 774657, 774913, 775169, 775425, 775681, 775937, 776193, 776449, 776705, 776961, 777217,
+    777473, 777729, 777985, 778241, 778497, 778753, 779009, 779265, 779521, 779777, 780033, 780289,
+    780545, 780801, 781057, 781313, 781569, 781825, 782081, 782337, 782593, 782849, 783105, 783361,
+    783617, 783873, 784129, 784385, 784641, 784897, 785153, 785409, 785665, 785921, 786177, 786433,
+    786689, 786945, 787201, 787457, 787713, 787969, 788225, 788481, 788737, 788993, 789249, 789505,
+    789761, 790017, 790273, 790529, 790785, 791041, 791297, 791553, 791809, 792065, 792321, 792577,
+    792833, 793089, 793345, 793601, 793857, 794113, 794369, 794625, 794881, 795137, 795393, 795649,
+    795905, 796161, 796417, 796673, 796929, 797185, 797441, 797697, 797953, 798209, 798465, 798721,
+    798977, 799233, 799489, 799745, 800001, 800257, 800513, 800769, 801025, 801281, 801537, 801793,
+    802049, 802305, 802561, 802817, 803073, 803329, 803585, 803841, 804097, 804353, 804609, 804865,
+    805121, 805377, 805633, 805889, 806145, 806401, 806657, 806913, 807169, 807425, 807681, 807937,
+    808193, 808449, 808705, 808961, 809217, 809473, 809729, 809985, 810241, 810497, 810753, 811009,
+    811265, 811521, 811777, 812033, 812289, 812545, 812801, 813057, 813313, 813569, 813825, 814081,
+    814337, 814593, 814849, 815105, 815361, 815617, 815873, 816129, 816385, 816641, 816897, 817153,
+    817409, 817665, 817921, 818177, 818433, 818689, 818945, 819201, 819457, 819713, 819969, 820225,
+    820481, 820737, 820993, 821249, 821505, 821761, 822017, 822273, 822529, 822785, 823041, 823297,
+    823553, 823809, 824065, 824321, 824577, 824833, 825089, 825345, 825601, 825857, 826113, 826369,
+    826625, 826881, 827137, 827393, 827649, 827905, 828161, 828417, 828673, 828929, 829185, 829441,
+    829697, 829953, 830209, 830465, 830721, 830977, 831233, 831489, 831745, 832001, 832257, 832513,
+    832769, 833025, 833281, 833537, 833793, 834049, 834305, 834561, 834817, 835073, 835329, 835585,
+    835841, 836097, 836353, 836609, 836865, 837121, 837377, 837633, 837889, 838145, 838401, 838657,
+    838913, 839169, 839425, 839681, 839937, 840193, 840449, 840705, 840961, 841217, 841473, 841729,
+    841985, 842241, 842497, 842753, 843009, 843265, 843521, 843777, 844033, 844289, 844545, 844801,
+    845057, 845313, 845569, 845825, 846081, 846337, 846593, 846849, 847105, 847361, 847617, 847873,
+    848129, 848385, 848641, 848897, 849153, 849409, 849665, 849921, 850177, 850433, 850689, 850945,
+    851201, 851457, 851713, 851969, 852225, 852481, 852737, 852993, 853249, 853505, 853761, 854017,
+    854273, 854529, 854785, 855041, 855297, 855553, 855809, 856065, 856321, 856577, 856833, 857089,
+    857345, 857601, 857857, 858113, 858369, 858625, 858881, 859137, 859393, 859649, 859905, 860161,
+    860417, 860673, 860929, 861185, 861441, 861697, 861953, 862209, 862465, 862721, 862977, 863233,
+    863489, 863745, 864001, 864257, 864513, 864769, 865025, 865281, 865537, 865793, 866049, 866305,
+    866561, 866817, 867073, 867329, 867585, 867841, 868097, 868353, 868609, 868865, 869121, 869377,
+    869633, 869889, 870145, 870401, 870657, 870913, 871169, 871425, 871681,
+};
+static const uint32_t UNI_NFD_POOL[] = {
+    65, 768, 65, 769, 65, 770, 65, 771, 65, 776, 65, 778,
+    67, 807, 69, 768, 69, 769, 69, 770, 69, 776, 73, 768,
+    73, 769, 73, 770, 73, 776, 78, 771, 79, 768, 79, 769,
+    79, 770, 79, 771, 79, 776, 85, 768, 85, 769, 85, 770,
+    85, 776, 89, 769, 97, 768, 97, 769, 97, 770, 97, 771,
+    97, 776, 97, 778, 99, 807, 101, 768, 101, 769, 101, 770,
+    101, 776, 105, 768, 105, 769, 105, 770, 105, 776, 110, 771,
+    111, 768, 111, 769, 111, 770, 111, 771, 111, 776, 117, 768,
+    117, 769, 117, 770, 117, 776, 121, 769, 121, 776, 65, 772,
+    97, 772, 65, 774, 97, 774, 65, 808, 97, 808, 67, 769,
+    99, 769, 67, 770, 99, 770, 67, 775, 99, 775, 67, 780,
+    99, 780, 68, 780, 100, 780, 69, 772, 101, 772, 69, 774,
+    101, 774, 69, 775, 101, 775, 69, 808, 101, 808, 69, 780,
+    101, 780, 71, 770, 103, 770, 71, 774, 103, 774, 71, 775,
+    103, 775, 71, 807, 103, 807, 72, 770, 104, 770, 73, 771,
+    105, 771, 73, 772, 105, 772, 73, 774, 105, 774, 73, 808,
+    105, 808, 73, 775, 74, 770, 106, 770, 75, 807, 107, 807,
+    76, 769, 108, 769, 76, 807, 108, 807, 76, 780, 108, 780,
+    78, 769, 110, 769, 78, 807, 110, 807, 78, 780, 110, 780,
+    79, 772, 111, 772, 79, 774, 111, 774, 79, 779, 111, 779,
+    82, 769, 114, 769, 82, 807, 114, 807, 82, 780, 114, 780,
+    83, 769, 115, 769, 83, 770, 115, 770, 83, 807, 115, 807,
+    83, 780, 115, 780, 84, 807, 116, 807, 84, 780, 116, 780,
+    85, 771, 117, 771, 85, 772, 117, 772, 85, 774, 117, 774,
+    85, 778, 117, 778, 85, 779, 117, 779, 85, 808, 117, 808,
+    87, 770, 119, 770, 89, 770, 121, 770, 89, 776, 90, 769,
+    122, 769, 90, 775, 122, 775, 90, 780, 122, 780, 79, 795,
+    111, 795, 85, 795, 117, 795, 65, 780, 97, 780, 73, 780,
+    105, 780, 79, 780, 111, 780, 85, 780, 117, 780, 85, 776,
+    772, 117, 776, 772, 85, 776, 769, 117, 776, 769, 85, 776,
+    780, 117, 776, 780, 85, 776, 768, 117, 776, 768, 65, 776,
+    772, 97, 776, 772, 65, 775, 772, 97, 775, 772, 198, 772,
+    230, 772, 71, 780, 103, 780, 75, 780, 107, 780, 79, 808,
+    111, 808, 79, 808, 772, 111, 808, 772, 439, 780, 658, 780,
+    106, 780, 71, 769, 103, 769, 78, 768, 110, 768, 65, 778,
+    769, 97, 778, 769, 198, 769, 230, 769, 216, 769, 248, 769,
+    65, 783, 97, 783, 65, 785, 97, 785, 69, 783, 101, 783,
+    69, 785, 101, 785, 73, 783, 105, 783, 73, 785, 105, 785,
+    79, 783, 111, 783, 79, 785, 111, 785, 82, 783, 114, 783,
+    82, 785, 114, 785, 85, 783, 117, 783, 85, 785, 117, 785,
+    83, 806, 115, 806, 84, 806, 116, 806, 72, 780, 104, 780,
+    65, 775, 97, 775, 69, 807, 101, 807, 79, 776, 772, 111,
+    776, 772, 79, 771, 772, 111, 771, 772, 79, 775, 111, 775,
+    79, 775, 772, 111, 775, 772, 89, 772, 121, 772, 768, 769,
+    787, 776, 769, 697, 59, 168, 769, 913, 769, 183, 917, 769,
+    919, 769, 921, 769, 927, 769, 933, 769, 937, 769, 953, 776,
+    769, 921, 776, 933, 776, 945, 769, 949, 769, 951, 769, 953,
+    769, 965, 776, 769, 953, 776, 965, 776, 959, 769, 965, 769,
+    969, 769, 978, 769, 978, 776, 1045, 768, 1045, 776, 1043, 769,
+    1030, 776, 1050, 769, 1048, 768, 1059, 774, 1048, 774, 1080, 774,
+    1077, 768, 1077, 776, 1075, 769, 1110, 776, 1082, 769, 1080, 768,
+    1091, 774, 1140, 783, 1141, 783, 1046, 774, 1078, 774, 1040, 774,
+    1072, 774, 1040, 776, 1072, 776, 1045, 774, 1077, 774, 1240, 776,
+    1241, 776, 1046, 776, 1078, 776, 1047, 776, 1079, 776, 1048, 772,
+    1080, 772, 1048, 776, 1080, 776, 1054, 776, 1086, 776, 1256, 776,
+    1257, 776, 1069, 776, 1101, 776, 1059, 772, 1091, 772, 1059, 776,
+    1091, 776, 1059, 779, 1091, 779, 1063, 776, 1095, 776, 1067, 776,
+    1099, 776, 1575, 1619, 1575, 1620, 1608, 1620, 1575, 1621, 1610, 1620,
+    1749, 1620, 1729, 1620, 1746, 1620, 2344, 2364, 2352, 2364, 2355, 2364,
+    2325, 2364, 2326, 2364, 2327, 2364, 2332, 2364, 2337, 2364, 2338, 2364,
+    2347, 2364, 2351, 2364, 2503, 2494, 2503, 2519, 2465, 2492, 2466, 2492,
+    2479, 2492, 2610, 2620, 2616, 2620, 2582, 2620, 2583, 2620, 2588, 2620,
+    2603, 2620, 2887, 2902, 2887, 2878, 2887, 2903, 2849, 2876, 2850, 2876,
+    2962, 3031, 3014, 3006, 3015, 3006, 3014, 3031, 3142, 3158, 3263, 3285,
+    3270, 3285, 3270, 3286, 3270, 3266, 3270, 3266, 3285, 3398, 3390, 3399,
+    3390, 3398, 3415, 3545, 3530, 3545, 3535, 3545, 3535, 3530, 3545, 3551,
+    3906, 4023, 3916, 4023, 3921, 4023, 3926, 4023, 3931, 4023, 3904, 4021,
+    3953, 3954, 3953, 3956, 4018, 3968, 4019, 3968, 3953, 3968, 3986, 4023,
+    3996, 4023, 4001, 4023, 4006, 4023, 4011, 4023, 3984, 4021, 4133, 4142,
+    6917, 6965, 6919, 6965, 6921, 6965, 6923, 6965, 6925, 6965, 6929, 6965,
+    6970, 6965, 6972, 6965, 6974, 6965, 6975, 6965, 6978, 6965, 65, 805,
+    97, 805, 66, 775, 98, 775, 66, 803, 98, 803, 66, 817,
+    98, 817, 67, 807, 769, 99, 807, 769, 68, 775, 100, 775,
+    68, 803, 100, 803, 68, 817, 100, 817, 68, 807, 100, 807,
+    68, 813, 100, 813, 69, 772, 768, 101, 772, 768, 69, 772,
+    769, 101, 772, 769, 69, 813, 101, 813, 69, 816, 101, 816,
+    69, 807, 774, 101, 807, 774, 70, 775, 102, 775, 71, 772,
+    103, 772, 72, 775, 104, 775, 72, 803, 104, 803, 72, 776,
+    104, 776, 72, 807, 104, 807, 72, 814, 104, 814, 73, 816,
+    105, 816, 73, 776, 769, 105, 776, 769, 75, 769, 107, 769,
+    75, 803, 107, 803, 75, 817, 107, 817, 76, 803, 108, 803,
+    76, 803, 772, 108, 803, 772, 76, 817, 108, 817, 76, 813,
+    108, 813, 77, 769, 109, 769, 77, 775, 109, 775, 77, 803,
+    109, 803, 78, 775, 110, 775, 78, 803, 110, 803, 78, 817,
+    110, 817, 78, 813, 110, 813, 79, 771, 769, 111, 771, 769,
+    79, 771, 776, 111, 771, 776, 79, 772, 768, 111, 772, 768,
+    79, 772, 769, 111, 772, 769, 80, 769, 112, 769, 80, 775,
+    112, 775, 82, 775, 114, 775, 82, 803, 114, 803, 82, 803,
+    772, 114, 803, 772, 82, 817, 114, 817, 83, 775, 115, 775,
+    83, 803, 115, 803, 83, 769, 775, 115, 769, 775, 83, 780,
+    775, 115, 780, 775, 83, 803, 775, 115, 803, 775, 84, 775,
+    116, 775, 84, 803, 116, 803, 84, 817, 116, 817, 84, 813,
+    116, 813, 85, 804, 117, 804, 85, 816, 117, 816, 85, 813,
+    117, 813, 85, 771, 769, 117, 771, 769, 85, 772, 776, 117,
+    772, 776, 86, 771, 118, 771, 86, 803, 118, 803, 87, 768,
+    119, 768, 87, 769, 119, 769, 87, 776, 119, 776, 87, 775,
+    119, 775, 87, 803, 119, 803, 88, 775, 120, 775, 88, 776,
+    120, 776, 89, 775, 121, 775, 90, 770, 122, 770, 90, 803,
+    122, 803, 90, 817, 122, 817, 104, 817, 116, 776, 119, 778,
+    121, 778, 383, 775, 65, 803, 97, 803, 65, 777, 97, 777,
+    65, 770, 769, 97, 770, 769, 65, 770, 768, 97, 770, 768,
+    65, 770, 777, 97, 770, 777, 65, 770, 771, 97, 770, 771,
+    65, 803, 770, 97, 803, 770, 65, 774, 769, 97, 774, 769,
+    65, 774, 768, 97, 774, 768, 65, 774, 777, 97, 774, 777,
+    65, 774, 771, 97, 774, 771, 65, 803, 774, 97, 803, 774,
+    69, 803, 101, 803, 69, 777, 101, 777, 69, 771, 101, 771,
+    69, 770, 769, 101, 770, 769, 69, 770, 768, 101, 770, 768,
+    69, 770, 777, 101, 770, 777, 69, 770, 771, 101, 770, 771,
+    69, 803, 770, 101, 803, 770, 73, 777, 105, 777, 73, 803,
+    105, 803, 79, 803, 111, 803, 79, 777, 111, 777, 79, 770,
+    769, 111, 770, 769, 79, 770, 768, 111, 770, 768, 79, 770,
+    777, 111, 770, 777, 79, 770, 771, 111, 770, 771, 79, 803,
+    770, 111, 803, 770, 79, 795, 769, 111, 795, 769, 79, 795,
+    768, 111, 795, 768, 79, 795, 777, 111, 795, 777, 79, 795,
+    771, 111, 795, 771, 79, 795, 803, 111, 795, 803, 85, 803,
+    117, 803, 85, 777, 117, 777, 85, 795, 769, 117, 795, 769,
+    85, 795, 768, 117, 795, 768, 85, 795, 777, 117, 795, 777,
+    85, 795, 771, 117, 795, 771, 85, 795, 803, 117, 795, 803,
+    89, 768, 121, 768, 89, 803, 121, 803, 89, 777, 121, 777,
+    89, 771, 121, 771, 945, 787, 945, 788, 945, 787, 768, 945,
+    788, 768, 945, 787, 769, 945, 788, 769, 945, 787, 834, 945,
+    788, 834, 913, 787, 913, 788, 913, 787, 768, 913, 788, 768,
+    913, 787, 769, 913, 788, 769, 913, 787, 834, 913, 788, 834,
+    949, 787, 949, 788, 949, 787, 768, 949, 788, 768, 949, 787,
+    769, 949, 788, 769, 917, 787, 917, 788, 917, 787, 768, 917,
+    788, 768, 917, 787, 769, 917, 788, 769, 951, 787, 951, 788,
+    951, 787, 768, 951, 788, 768, 951, 787, 769, 951, 788, 769,
+    951, 787, 834, 951, 788, 834, 919, 787, 919, 788, 919, 787,
+    768, 919, 788, 768, 919, 787, 769, 919, 788, 769, 919, 787,
+    834, 919, 788, 834, 953, 787, 953, 788, 953, 787, 768, 953,
+    788, 768, 953, 787, 769, 953, 788, 769, 953, 787, 834, 953,
+    788, 834, 921, 787, 921, 788, 921, 787, 768, 921, 788, 768,
+    921, 787, 769, 921, 788, 769, 921, 787, 834, 921, 788, 834,
+    959, 787, 959, 788, 959, 787, 768, 959, 788, 768, 959, 787,
+    769, 959, 788, 769, 927, 787, 927, 788, 927, 787, 768, 927,
+    788, 768, 927, 787, 769, 927, 788, 769, 965, 787, 965, 788,
+    965, 787, 768, 965, 788, 768, 965, 787, 769, 965, 788, 769,
+    965, 787, 834, 965, 788, 834, 933, 788, 933, 788, 768, 933,
+    788, 769, 933, 788, 834, 969, 787, 969, 788, 969, 787, 768,
+    969, 788, 768, 969, 787, 769, 969, 788, 769, 969, 787, 834,
+    969, 788, 834, 937, 787, 937, 788, 937, 787, 768, 937, 788,
+    768, 937, 787, 769, 937, 788, 769, 937, 787, 834, 937, 788,
+    834, 945, 768, 945, 769, 949, 768, 949, 769, 951, 768, 951,
+    769, 953, 768, 953, 769, 959, 768, 959, 769, 965, 768, 965,
+    769, 969, 768, 969, 769, 945, 787, 837, 945, 788, 837, 945,
+    787, 768, 837, 945, 788, 768, 837, 945, 787, 769, 837, 945,
+    788, 769, 837, 945, 787, 834, 837, 945, 788, 834, 837, 913,
+    787, 837, 913, 788, 837, 913, 787, 768, 837, 913, 788, 768,
+    837, 913, 787, 769, 837, 913, 788, 769, 837, 913, 787, 834,
+    837, 913, 788, 834, 837, 951, 787, 837, 951, 788, 837, 951,
+    787, 768, 837, 951, 788, 768, 837, 951, 787, 769, 837, 951,
+    788, 769, 837, 951, 787, 834, 837, 951, 788, 834, 837, 919,
+    787, 837, 919, 788, 837, 919, 787, 768, 837, 919, 788, 768,
+    837, 919, 787, 769, 837, 919, 788, 769, 837, 919, 787, 834,
+    837, 919, 788, 834, 837, 969, 787, 837, 969, 788, 837, 969,
+    787, 768, 837, 969, 788, 768, 837, 969, 787, 769, 837, 969,
+    788, 769, 837, 969, 787, 834, 837, 969, 788, 834, 837, 937,
+    787, 837, 937, 788, 837, 937, 787, 768, 837, 937, 788, 768,
+    837, 937, 787, 769, 837, 937, 788, 769, 837, 937, 787, 834,
+    837, 937, 788, 834, 837, 945, 774, 945, 772, 945, 768, 837,
+    945, 837, 945, 769, 837, 945, 834, 945, 834, 837, 913, 774,
+    913, 772, 913, 768, 913, 769, 913, 837, 953, 168, 834, 951,
+    768, 837, 951, 837, 951, 769, 837, 951, 834, 951, 834, 837,
+    917, 768, 917, 769, 919, 768, 919, 769, 919, 837, 8127, 768,
+    8127, 769, 8127, 834, 953, 774, 953, 772, 953, 776, 768, 953,
+    776, 769, 953, 834, 953, 776, 834, 921, 774, 921, 772, 921,
+    768, 921, 769, 8190, 768, 8190, 769, 8190, 834, 965, 774, 965,
+    772, 965, 776, 768, 965, 776, 769, 961, 787, 961, 788, 965,
+    834, 965, 776, 834, 933, 774, 933, 772, 933, 768, 933, 769,
+    929, 788, 168, 768, 168, 769, 96, 969, 768, 837, 969, 837,
+    969, 769, 837, 969, 834, 969, 834, 837, 927, 768, 927, 769,
+    937, 768, 937, 769, 937, 837, 180, 8194, 8195, 937, 75, 65,
+    778, 8592, 824, 8594, 824, 8596, 824, 8656, 824, 8660, 824, 8658,
+    824, 8707, 824, 8712, 824, 8715, 824, 8739, 824, 8741, 824, 8764,
+    824, 8771, 824, 8773, 824, 8776, 824, 61, 824, 8801, 824, 8781,
+    824, 60, 824, 62, 824, 8804, 824, 8805, 824, 8818, 824, 8819,
+    824, 8822, 824, 8823, 824, 8826, 824, 8827, 824, 8834, 824, 8835,
+    824, 8838, 824, 8839, 824, 8866, 824, 8872, 824, 8873, 824, 8875,
+    824, 8828, 824, 8829, 824, 8849, 824, 8850, 824, 8882, 824, 8883,
+    824, 8884, 824, 8885, 824, 12296, 12297, 10973, 824, 12363, 12441, 12365,
+    12441, 12367, 12441, 12369, 12441, 12371, 12441, 12373, 12441, 12375, 12441, 12377,
+    12441, 12379, 12441, 12381, 12441, 12383, 12441, 12385, 12441, 12388, 12441, 12390,
+    12441, 12392, 12441, 12399, 12441, 12399, 12442, 12402, 12441, 12402, 12442, 12405,
+    12441, 12405, 12442, 12408, 12441, 12408, 12442, 12411, 12441, 12411, 12442, 12358,
+    12441, 12445, 12441, 12459, 12441, 12461, 12441, 12463, 12441, 12465, 12441, 12467,
+    12441, 12469, 12441, 12471, 12441, 12473, 12441, 12475, 12441, 12477, 12441, 12479,
+    12441, 12481, 12441, 12484, 12441, 12486, 12441, 12488, 12441, 12495, 12441, 12495,
+    12442, 12498, 12441, 12498, 12442, 12501, 12441, 12501, 12442, 12504, 12441, 12504,
+    12442, 12507, 12441, 12507, 12442, 12454, 12441, 12527, 12441, 12528, 12441, 12529,
+    12441, 12530, 12441, 12541, 12441, 35912, 26356, 36554, 36040, 28369, 20018, 21477,
+    40860, 40860, 22865, 37329, 21895, 22856, 25078, 30313, 32645, 34367, 34746, 35064,
+    37007, 27138, 27931, 28889, 29662, 33853, 37226, 39409, 20098, 21365, 27396, 29211,
+    34349, 40478, 23888, 28651, 34253, 35172, 25289, 33240, 34847, 24266, 26391, 28010,
+    29436, 37070, 20358, 20919, 21214, 25796, 27347, 29200, 30439, 32769, 34310, 34396,
+    36335, 38706, 39791, 40442, 30860, 31103, 32160, 33737, 37636, 40575, 35542, 22751,
+    24324, 31840, 32894, 29282, 30922, 36034, 38647, 22744, 23650, 27155, 28122, 28431,
+    32047, 32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190, 33777, 38517, 35712,
+    25295, 27138, 35582, 20025, 23527, 24594, 29575, 30064, 21271, 30971, 20415, 24489,
+    19981, 27852, 25976, 32034, 21443, 22622, 30465, 33865, 35498, 27578, 36784, 27784,
+    25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391, 35538, 37327,
+    21237, 21570, 22899, 24300, 26053, 28670, 31018, 38317, 39530, 40599, 40654, 21147,
+    26310, 27511, 36706, 24180, 24976, 25088, 25754, 28451, 29001, 29833, 31178, 32244,
+    32879, 36646, 34030, 36899, 37706, 21015, 21155, 21693, 28872, 35010, 35498, 24265,
+    24565, 25467, 27566, 31806, 29557, 20196, 22265, 23527, 23994, 24604, 29618, 29801,
+    32666, 32838, 37428, 38646, 38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102,
+    20698, 23534, 23615, 26009, 27138, 29134, 30274, 34044, 36988, 40845, 26248, 38446,
+    21129, 26491, 26611, 27969, 28316, 29705, 30041, 30827, 32016, 39006, 20845, 25134,
+    38520, 20523, 23833, 28138, 36650, 24459, 24900, 26647, 29575, 38534, 21033, 21519,
+    23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633, 35023, 35041, 37324, 38626,
+    21311, 28346, 21533, 29136, 29848, 34298, 38563, 40023, 40607, 26519, 28107, 33256,
+    31435, 31520, 31890, 29376, 28825, 35672, 20160, 33590, 21050, 20999, 24230, 25299,
+    31958, 23429, 27934, 26292, 36667, 34892, 38477, 35211, 24275, 20800, 21952, 22618,
+    26228, 20958, 29482, 30410, 31036, 31070, 31077, 31119, 38742, 31934, 32701, 34322,
+    35576, 36920, 37117, 39151, 39164, 39208, 40372, 37086, 38583, 20398, 20711, 20813,
+    21193, 21220, 21329, 21917, 22022, 22120, 22592, 22696, 23652, 23662, 24724, 24936,
+    24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038, 29227, 29730,
+    30865, 31038, 31049, 31048, 31056, 31062, 31069, 31117, 31118, 31296, 31361, 31680,
+    32244, 32265, 32321, 32626, 32773, 33261, 33401, 33401, 33879, 35088, 35222, 35585,
+    35641, 36051, 36104, 36790, 36920, 38627, 38911, 38971, 24693, 148206, 33304, 20006,
+    20917, 20840, 20352, 20805, 20864, 21191, 21242, 21917, 21845, 21913, 21986, 22618,
+    22707, 22852, 22868, 23138, 23336, 24274, 24281, 24425, 24493, 24792, 24910, 24840,
+    24974, 24928, 25074, 25140, 25540, 25628, 25682, 25942, 26228, 26391, 26395, 26454,
+    27513, 27578, 27969, 28379, 28363, 28450, 28702, 29038, 30631, 29237, 29359, 29482,
+    29809, 29958, 30011, 30237, 30239, 30410, 30427, 30452, 30538, 30528, 30924, 31409,
+    31680, 31867, 32091, 32244, 32574, 32773, 33618, 33775, 34681, 35137, 35206, 35222,
+    35519, 35576, 35531, 35585, 35582, 35565, 35641, 35722, 36104, 36664, 36978, 37273,
+    37494, 38524, 38627, 38742, 38875, 38911, 38923, 38971, 39698, 40860, 141386, 141380,
+    144341, 15261, 16408, 16441, 152137, 154832, 163539, 40771, 40846, 1497, 1460, 1522,
+    1463, 1513, 1473, 1513, 1474, 1513, 1468, 1473, 1513, 1468, 1474, 1488,
+    1463, 1488, 1464, 1488, 1468, 1489, 1468, 1490, 1468, 1491, 1468, 1492,
+    1468, 1493, 1468, 1494, 1468, 1496, 1468, 1497, 1468, 1498, 1468, 1499,
+    1468, 1500, 1468, 1502, 1468, 1504, 1468, 1505, 1468, 1507, 1468, 1508,
+    1468, 1510, 1468, 1511, 1468, 1512, 1468, 1513, 1468, 1514, 1468, 1493,
+    1465, 1489, 1471, 1499, 1471, 1508, 1471, 69785, 69818, 69787, 69818, 69797,
+    69818, 69937, 69927, 69938, 69927, 70471, 70462, 70471, 70487, 70841, 70842, 70841,
+    70832, 70841, 70845, 71096, 71087, 71097, 71087, 71989, 71984, 119127, 119141, 119128,
+    119141, 119128, 119141, 119150, 119128, 119141, 119151, 119128, 119141, 119152, 119128, 119141,
+    119153, 119128, 119141, 119154, 119225, 119141, 119226, 119141, 119225, 119141, 119150, 119226,
+    119141, 119150, 119225, 119141, 119151, 119226, 119141, 119151, 20029, 20024, 20033, 131362,
+    20320, 20398, 20411, 20482, 20602, 20633, 20711, 20687, 13470, 132666, 20813, 20820,
+    20836, 20855, 132380, 13497, 20839, 20877, 132427, 20887, 20900, 20172, 20908, 20917,
+    168415, 20981, 20995, 13535, 21051, 21062, 21106, 21111, 13589, 21191, 21193, 21220,
+    21242, 21253, 21254, 21271, 21321, 21329, 21338, 21363, 21373, 21375, 21375, 21375,
+    133676, 28784, 21450, 21471, 133987, 21483, 21489, 21510, 21662, 21560, 21576, 21608,
+    21666, 21750, 21776, 21843, 21859, 21892, 21892, 21913, 21931, 21939, 21954, 22294,
+    22022, 22295, 22097, 22132, 20999, 22766, 22478, 22516, 22541, 22411, 22578, 22577,
+    22700, 136420, 22770, 22775, 22790, 22810, 22818, 22882, 136872, 136938, 23020, 23067,
+    23079, 23000, 23142, 14062, 14076, 23304, 23358, 23358, 137672, 23491, 23512, 23527,
+    23539, 138008, 23551, 23558, 24403, 23586, 14209, 23648, 23662, 23744, 23693, 138724,
+    23875, 138726, 23918, 23915, 23932, 24033, 24034, 14383, 24061, 24104, 24125, 24169,
+    14434, 139651, 14460, 24240, 24243, 24246, 24266, 172946, 24318, 140081, 140081, 33281,
+    24354, 24354, 14535, 144056, 156122, 24418, 24427, 14563, 24474, 24525, 24535, 24569,
+    24705, 14650, 14620, 24724, 141012, 24775, 24904, 24908, 24910, 24908, 24954, 24974,
+    25010, 24996, 25007, 25054, 25074, 25078, 25104, 25115, 25181, 25265, 25300, 25424,
+    142092, 25405, 25340, 25448, 25475, 25572, 142321, 25634, 25541, 25513, 14894, 25705,
+    25726, 25757, 25719, 14956, 25935, 25964, 143370, 26083, 26360, 26185, 15129, 26257,
+    15112, 15076, 20882, 20885, 26368, 26268, 32941, 17369, 26391, 26395, 26401, 26462,
+    26451, 144323, 15177, 26618, 26501, 26706, 26757, 144493, 26766, 26655, 26900, 15261,
+    26946, 27043, 27114, 27304, 145059, 27355, 15384, 27425, 145575, 27476, 15438, 27506,
+    27551, 27578, 27579, 146061, 138507, 146170, 27726, 146620, 27839, 27853, 27751, 27926,
+    27966, 28023, 27969, 28009, 28024, 28037, 146718, 27956, 28207, 28270, 15667, 28363,
+    28359, 147153, 28153, 28526, 147294, 147342, 28614, 28729, 28702, 28699, 15766, 28746,
+    28797, 28791, 28845, 132389, 28997, 148067, 29084, 148395, 29224, 29237, 29264, 149000,
+    29312, 29333, 149301, 149524, 29562, 29579, 16044, 29605, 16056, 16056, 29767, 29788,
+    29809, 29829, 29898, 16155, 29988, 150582, 30014, 150674, 30064, 139679, 30224, 151457,
+    151480, 151620, 16380, 16392, 30452, 151795, 151794, 151833, 151859, 30494, 30495, 30495,
+    30538, 16441, 30603, 16454, 16534, 152605, 30798, 30860, 30924, 16611, 153126, 31062,
+    153242, 153285, 31119, 31211, 16687, 31296, 31306, 31311, 153980, 154279, 154279, 31470,
+    16898, 154539, 31686, 31689, 16935, 154752, 31954, 17056, 31976, 31971, 32000, 155526,
+    32099, 17153, 32199, 32258, 32325, 17204, 156200, 156231, 17241, 156377, 32634, 156478,
+    32661, 32762, 32773, 156890, 156963, 32864, 157096, 32880, 144223, 17365, 32946, 33027,
+    17419, 33086, 23221, 157607, 157621, 144275, 144284, 33281, 33284, 36766, 17515, 33425,
+    33419, 33437, 21171, 33457, 33459, 33469, 33510, 158524, 33509, 33565, 33635, 33709,
+    33571, 33725, 33767, 33879, 33619, 33738, 33740, 33756, 158774, 159083, 158933, 17707,
+    34033, 34035, 34070, 160714, 34148, 159532, 17757, 17761, 159665, 159954, 17771, 34384,
+    34396, 34407, 34409, 34473, 34440, 34574, 34530, 34681, 34600, 34667, 34694, 17879,
+    34785, 34817, 17913, 34912, 34915, 161383, 35031, 35038, 17973, 35066, 13499, 161966,
+    162150, 18110, 18119, 35488, 35565, 35722, 35925, 162984, 36011, 36033, 36123, 36215,
+    163631, 133124, 36299, 36284, 36336, 133342, 36564, 36664, 165330, 165357, 37012, 37105,
+    37137, 165678, 37147, 37432, 37591, 37592, 37500, 37881, 37909, 166906, 38283, 18837,
+    38327, 167287, 18918, 38595, 23986, 38691, 168261, 168474, 19054, 19062, 38880, 168970,
+    19122, 169110, 38923, 38923, 38953, 169398, 39138, 19251, 39209, 39335, 39362, 39422,
+    19406, 170800, 39698, 40000, 40189, 19662, 19693, 40295, 172238, 19704, 172293, 172558,
+    172689, 40635, 19798, 40697, 40702, 40709, 40719, 40726, 40763, 173568,
+};
+
+// Full compatibility decompositions, where they differ from UNI_NFD
+static const size_t UNI_NFKD_SIZE = 3750;
+static const uint32_t UNI_NFKD_KEYS[] = {
+    160, 168, 170, 175, 178, 179, 180, 181, 184, 185, 186, 188,
+    189, 190, 306, 307, 319, 320, 329, 383, 452, 453, 454, 455,
+    456, 457, 458, 459, 460, 497, 498, 499, 688, 689, 690, 691,
+    692, 693, 694, 695, 696, 728, 729, 730, 731, 732, 733, 736,
+    737, 738, 739, 740, 890, 900, 901, 976, 977, 978, 979, 980,
+    981, 982, 1008, 1009, 1010, 1012, 1013, 1017, 1415, 1653, 1654, 1655,
+    1656, 3635, 3763, 3804, 3805, 3852, 3959, 3961, 4348, 7468, 7469, 7470,
+    7472, 7473, 7474, 7475, 7476, 7477, 7478, 7479, 7480, 7481, 7482, 7484,
+    7485, 7486, 7487, 7488, 7489, 7490, 7491, 7492, 7493, 7494, 7495, 7496,
+    7497, 7498, 7499, 7500, 7501, 7503, 7504, 7505, 7506, 7507, 7508, 7509,
+    7510, 7511, 7512, 7513, 7514, 7515, 7516, 7517, 7518, 7519, 7520, 7521,
+    7522, 7523, 7524, 7525, 7526, 7527, 7528, 7529, 7530, 7544, 7579, 7580,
+    7581, 7582, 7583, 7584, 7585, 7586, 7587, 7588, 7589, 7590, 7591, 7592,
+    7593, 7594, 7595, 7596, 7597, 7598, 7599, 7600, 7601, 7602, 7603, 7604,
+    7605, 7606, 7607, 7608, 7609, 7610, 7611, 7612, 7613, 7614, 7615, 7834,
+    7835, 8125, 8127, 8128, 8129, 8141, 8142, 8143, 8157, 8158, 8159, 8173,
+    8174, 8189, 8190, 8192, 8193, 8194, 8195, 8196, 8197, 8198, 8199, 8200,
+    8201, 8202, 8209, 8215, 8228, 8229, 8230, 8239, 8243, 8244, 8246, 8247,
+    8252, 8254, 8263, 8264, 8265, 8279, 8287, 8304, 8305, 8308, 8309, 8310,
+    8311, 8312, 8313, 8314, 8315, 8316, 8317, 8318, 8319, 8320, 8321, 8322,
+    8323, 8324, 8325, 8326, 8327, 8328, 8329, 8330, 8331, 8332, 8333, 8334,
+    8336, 8337, 8338, 8339, 8340, 8341, 8342, 8343, 8344, 8345, 8346, 8347,
+    8348, 8360, 8448, 8449, 8450, 8451, 8453, 8454, 8455, 8457, 8458, 8459,
+    8460, 8461, 8462, 8463, 8464, 8465, 8466, 8467, 8469, 8470, 8473, 8474,
+    8475, 8476, 8477, 8480, 8481, 8482, 8484, 8488, 8492, 8493, 8495, 8496,
+    8497, 8499, 8500, 8501, 8502, 8503, 8504, 8505, 8507, 8508, 8509, 8510,
+    8511, 8512, 8517, 8518, 8519, 8520, 8521, 8528, 8529, 8530, 8531, 8532,
+    8533, 8534, 8535, 8536, 8537, 8538, 8539, 8540, 8541, 8542, 8543, 8544,
+    8545, 8546, 8547, 8548, 8549, 8550, 8551, 8552, 8553, 8554, 8555, 8556,
+    8557, 8558, 8559, 8560, 8561, 8562, 8563, 8564, 8565, 8566, 8567, 8568,
+    8569, 8570, 8571, 8572, 8573, 8574, 8575, 8585, 8748, 8749, 8751, 8752,
+    9312, 9313, 9314, 9315, 9316, 9317, 9318, 9319, 9320, 9321, 9322, 9323,
+    9324, 9325, 9326, 9327, 9328, 9329, 9330, 9331, 9332, 9333, 9334, 9335,
+    9336, 9337, 9338, 9339, 9340, 9341, 9342, 9343, 9344, 9345, 9346, 9347,
+    9348, 9349, 9350, 9351, 9352, 9353, 9354, 9355, 9356, 9357, 9358, 9359,
+    9360, 9361, 9362, 9363, 9364, 9365, 9366, 9367, 9368, 9369, 9370, 9371,
+    9372, 9373, 9374, 9375, 9376, 9377, 9378, 9379, 9380, 9381, 9382, 9383,
+    9384, 9385, 9386, 9387, 9388, 9389, 9390, 9391, 9392, 9393, 9394, 9395,
+    9396, 9397, 9398, 9399, 9400, 9401, 9402, 9403, 9404, 9405, 9406, 9407,
+    9408, 9409, 9410, 9411, 9412, 9413, 9414, 9415, 9416, 9417, 9418, 9419,
+    9420, 9421, 9422, 9423, 9424, 9425, 9426, 9427, 9428, 9429, 9430, 9431,
+    9432, 9433, 9434, 9435, 9436, 9437, 9438, 9439, 9440, 9441, 9442, 9443,
+    9444, 9445, 9446, 9447, 9448, 9449, 9450, 10764, 10868, 10869, 10870, 11388,
+    11389, 11631, 11935, 12019, 12032, 12033, 12034, 12035, 12036, 12037, 12038, 12039,
+    12040, 12041, 12042, 12043, 12044, 12045, 12046, 12047, 12048, 12049, 12050, 12051,
+    12052, 12053, 12054, 12055, 12056, 12057, 12058, 12059, 12060, 12061, 12062, 12063,
+    12064, 12065, 12066, 12067, 12068, 12069, 12070, 12071, 12072, 12073, 12074, 12075,
+    12076, 12077, 12078, 12079, 12080, 12081, 12082, 12083, 12084, 12085, 12086, 12087,
+    12088, 12089, 12090, 12091, 12092, 12093, 12094, 12095, 12096, 12097, 12098, 12099,
+    12100, 12101, 12102, 12103, 12104, 12105, 12106, 12107, 12108, 12109, 12110, 12111,
+    12112, 12113, 12114, 12115, 12116, 12117, 12118, 12119, 12120, 12121, 12122, 12123,
+    12124, 12125, 12126, 12127, 12128, 12129, 12130, 12131, 12132, 12133, 12134, 12135,
+    12136, 12137, 12138, 12139, 12140, 12141, 12142, 12143, 12144, 12145, 12146, 12147,
+    12148, 12149, 12150, 12151, 12152, 12153, 12154, 12155, 12156, 12157, 12158, 12159,
+    12160, 12161, 12162, 12163, 12164, 12165, 12166, 12167, 12168, 12169, 12170, 12171,
+    12172, 12173, 12174, 12175, 12176, 12177, 12178, 12179, 12180, 12181, 12182, 12183,
+    12184, 12185, 12186, 12187, 12188, 12189, 12190, 12191, 12192, 12193, 12194, 12195,
+    12196, 12197, 12198, 12199, 12200, 12201, 12202, 12203, 12204, 12205, 12206, 12207,
+    12208, 12209, 12210, 12211, 12212, 12213, 12214, 12215, 12216, 12217, 12218, 12219,
+    12220, 12221, 12222, 12223, 12224, 12225, 12226, 12227, 12228, 12229, 12230, 12231,
+    12232, 12233, 12234, 12235, 12236, 12237, 12238, 12239, 12240, 12241, 12242, 12243,
+    12244, 12245, 12288, 12342, 12344, 12345, 12346, 12443, 12444, 12447, 12543, 12593,
+    12594, 12595, 12596, 12597, 12598, 12599, 12600, 12601, 12602, 12603, 12604, 12605,
+    12606, 12607, 12608, 12609, 12610, 12611, 12612, 12613, 12614, 12615, 12616, 12617,
+    12618, 12619, 12620, 12621, 12622, 12623, 12624, 12625, 12626, 12627, 12628, 12629,
+    12630, 12631, 12632, 12633, 12634, 12635, 12636, 12637, 12638, 12639, 12640, 12641,
+    12642, 12643, 12644, 12645, 12646, 12647, 12648, 12649, 12650, 12651, 12652, 12653,
+    12654, 12655, 12656, 12657, 12658, 12659, 12660, 12661, 12662, 12663, 12664, 12665,
+    12666, 12667, 12668, 12669, 12670, 12671, 12672, 12673, 12674, 12675, 12676, 12677,
+    12678, 12679, 12680, 12681, 12682, 12683, 12684, 12685, 12686, 12690, 12691, 12692,
+    12693, 12694, 12695, 12696, 12697, 12698, 12699, 12700, 12701, 12702, 12703, 12800,
+    12801, 12802, 12803, 12804, 12805, 12806, 12807, 12808, 12809, 12810, 12811, 12812,
+    12813, 12814, 12815, 12816, 12817, 12818, 12819, 12820, 12821, 12822, 12823, 12824,
+    12825, 12826, 12827, 12828, 12829, 12830, 12832, 12833, 12834, 12835, 12836, 12837,
+    12838, 12839, 12840, 12841, 12842, 12843, 12844, 12845, 12846, 12847, 12848, 12849,
+    12850, 12851, 12852, 12853, 12854, 12855, 12856, 12857, 12858, 12859, 12860, 12861,
+    12862, 12863, 12864, 12865, 12866, 12867, 12868, 12869, 12870, 12871, 12880, 12881,
+    12882, 12883, 12884, 12885, 12886, 12887, 12888, 12889, 12890, 12891, 12892, 12893,
+    12894, 12895, 12896, 12897, 12898, 12899, 12900, 12901, 12902, 12903, 12904, 12905,
+    12906, 12907, 12908, 12909, 12910, 12911, 12912, 12913, 12914, 12915, 12916, 12917,
+    12918, 12919, 12920, 12921, 12922, 12923, 12924, 12925, 12926, 12928, 12929, 12930,
+    12931, 12932, 12933, 12934, 12935, 12936, 12937, 12938, 12939, 12940, 12941, 12942,
+    12943, 12944, 12945, 12946, 12947, 12948, 12949, 12950, 12951, 12952, 12953, 12954,
+    12955, 12956, 12957, 12958, 12959, 12960, 12961, 12962, 12963, 12964, 12965, 12966,
+    12967, 12968, 12969, 12970, 12971, 12972, 12973, 12974, 12975, 12976, 12977, 12978,
+    12979, 12980, 12981, 12982, 12983, 12984, 12985, 12986, 12987, 12988, 12989, 12990,
+    12991, 12992, 12993, 12994, 12995, 12996, 12997, 12998, 12999, 13000, 13001, 13002,
+    13003, 13004, 13005, 13006, 13007, 13008, 13009, 13010, 13011, 13012, 13013, 13014,
+    13015, 13016, 13017, 13018, 13019, 13020, 13021, 13022, 13023, 13024, 13025, 13026,
+    13027, 13028, 13029, 13030, 13031, 13032, 13033, 13034, 13035, 13036, 13037, 13038,
+    13039, 13040, 13041, 13042, 13043, 13044, 13045, 13046, 13047, 13048, 13049, 13050,
+    13051, 13052, 13053, 13054, 13055, 13056, 13057, 13058, 13059, 13060, 13061, 13062,
+    13063, 13064, 13065, 13066, 13067, 13068, 13069, 13070, 13071, 13072, 13073, 13074,
+    13075, 13076, 13077, 13078, 13079, 13080, 13081, 13082, 13083, 13084, 13085, 13086,
+    13087, 13088, 13089, 13090, 13091, 13092, 13093, 13094, 13095, 13096, 13097, 13098,
+    13099, 13100, 13101, 13102, 13103, 13104, 13105, 13106, 13107, 13108, 13109, 13110,
+    13111, 13112, 13113, 13114, 13115, 13116, 13117, 13118, 13119, 13120, 13121, 13122,
+    13123, 13124, 13125, 13126, 13127, 13128, 13129, 13130, 13131, 13132, 13133, 13134,
+    13135, 13136, 13137, 13138, 13139, 13140, 13141, 13142, 13143, 13144, 13145, 13146,
+    13147, 13148, 13149, 13150, 13151, 13152, 13153, 13154, 13155, 13156, 13157, 13158,
+    13159, 13160, 13161, 13162, 13163, 13164, 13165, 13166, 13167, 13168, 13169, 13170,
+    13171, 13172, 13173, 13174, 13175, 13176, 13177, 13178, 13179, 13180, 13181, 13182,
+    13183, 13184, 13185, 13186, 13187, 13188, 13189, 13190, 13191, 13192, 13193, 13194,
+    13195, 13196, 13197, 13198, 13199, 13200, 13201, 13202, 13203, 13204, 13205, 13206,
+    13207, 13208, 13209, 13210, 13211, 13212, 13213, 13214, 13215, 13216, 13217, 13218,
+    13219, 13220, 13221, 13222, 13223, 13224, 13225, 13226, 13227, 13228, 13229, 13230,
+    13231, 13232, 13233, 13234, 13235, 13236, 13237, 13238, 13239, 13240, 13241, 13242,
+    13243, 13244, 13245, 13246, 13247, 13248, 13249, 13250, 13251, 13252, 13253, 13254,
+    13255, 13256, 13257, 13258, 13259, 13260, 13261, 13262, 13263, 13264, 13265, 13266,
+    13267, 13268, 13269, 13270, 13271, 13272, 13273, 13274, 13275, 13276, 13277, 13278,
+    13279, 13280, 13281, 13282, 13283, 13284, 13285, 13286, 13287, 13288, 13289, 13290,
+    13291, 13292, 13293, 13294, 13295, 13296, 13297, 13298, 13299, 13300, 13301, 13302,
+    13303, 13304, 13305, 13306, 13307, 13308, 13309, 13310, 13311, 42652, 42653, 42864,
+    42994, 42995, 42996, 43000, 43001, 43868, 43869, 43870, 43871, 43881, 64256, 64257,
+    64258, 64259, 64260, 64261, 64262, 64275, 64276, 64277, 64278, 64279, 64288, 64289,
+    64290, 64291, 64292, 64293, 64294, 64295, 64296, 64297, 64335, 64336, 64337, 64338,
+    64339, 64340, 64341, 64342, 64343, 64344, 64345, 64346, 64347, 64348, 64349, 64350,
+    64351, 64352, 64353, 64354, 64355, 64356, 64357, 64358, 64359, 64360, 64361, 64362,
+    64363, 64364, 64365, 64366, 64367, 64368, 64369, 64370, 64371, 64372, 64373, 64374,
+    64375, 64376, 64377, 64378, 64379, 64380, 64381, 64382, 64383, 64384, 64385, 64386,
+    64387, 64388, 64389, 64390, 64391, 64392, 64393, 64394, 64395, 64396, 64397, 64398,
+    64399, 64400, 64401, 64402, 64403, 64404, 64405, 64406, 64407, 64408, 64409, 64410,
+    64411, 64412, 64413, 64414, 64415, 64416, 64417, 64418, 64419, 64420, 64421, 64422,
+    64423, 64424, 64425, 64426, 64427, 64428, 64429, 64430, 64431, 64432, 64433, 64467,
+    64468, 64469, 64470, 64471, 64472, 64473, 64474, 64475, 64476, 64477, 64478, 64479,
+    64480, 64481, 64482, 64483, 64484, 64485, 64486, 64487, 64488, 64489, 64490, 64491,
+    64492, 64493, 64494, 64495, 64496, 64497, 64498, 64499, 64500, 64501, 64502, 64503,
+    64504, 64505, 64506, 64507, 64508, 64509, 64510, 64511, 64512, 64513, 64514, 64515,
+    64516, 64517, 64518, 64519, 64520, 64521, 64522, 64523, 64524, 64525, 64526, 64527,
+    64528, 64529, 64530, 64531, 64532, 64533, 64534, 64535, 64536, 64537, 64538, 64539,
+    64540, 64541, 64542, 64543, 64544, 64545, 64546, 64547, 64548, 64549, 64550, 64551,
+    64552, 64553, 64554, 64555, 64556, 64557, 64558, 64559, 64560, 64561, 64562, 64563,
+    64564, 64565, 64566, 64567, 64568, 64569, 64570, 64571, 64572, 64573, 64574, 64575,
+    64576, 64577, 64578, 64579, 64580, 64581, 64582, 64583, 64584, 64585, 64586, 64587,
+    64588, 64589, 64590, 64591, 64592, 64593, 64594, 64595, 64596, 64597, 64598, 64599,
+    64600, 64601, 64602, 64603, 64604, 64605, 64606, 64607, 64608, 64609, 64610, 64611,
+    64612, 64613, 64614, 64615, 64616, 64617, 64618, 64619, 64620, 64621, 64622, 64623,
+    64624, 64625, 64626, 64627, 64628, 64629, 64630, 64631, 64632, 64633, 64634, 64635,
+    64636, 64637, 64638, 64639, 64640, 64641, 64642, 64643, 64644, 64645, 64646, 64647,
+    64648, 64649, 64650, 64651, 64652, 64653, 64654, 64655, 64656, 64657, 64658, 64659,
+    64660, 64661, 64662, 64663, 64664, 64665, 64666, 64667, 64668, 64669, 64670, 64671,
+    64672, 64673, 64674, 64675, 64676, 64677, 64678, 64679, 64680, 64681, 64682, 64683,
+    64684, 64685, 64686, 64687, 64688, 64689, 64690, 64691, 64692, 64693, 64694, 64695,
+    64696, 64697, 64698, 64699, 64700, 64701, 64702, 64703, 64704, 64705, 64706, 64707,
+    64708, 64709, 64710, 64711, 64712, 64713, 64714, 64715, 64716, 64717, 64718, 64719,
+    64720, 64721, 64722, 64723, 64724, 64725, 64726, 64727, 64728, 64729, 64730, 64731,
+    64732, 64733, 64734, 64735, 64736, 64737, 64738, 64739, 64740, 64741, 64742, 64743,
+    64744, 64745, 64746, 64747, 64748, 64749, 64750, 64751, 64752, 64753, 64754, 64755,
+    64756, 64757, 64758, 64759, 64760, 64761, 64762, 64763, 64764, 64765, 64766, 64767,
+    64768, 64769, 64770, 64771, 64772, 64773, 64774, 64775, 64776, 64777, 64778, 64779,
+    64780, 64781, 64782, 64783, 64784, 64785, 64786, 64787, 64788, 64789, 64790, 64791,
+    64792, 64793, 64794, 64795, 64796, 64797, 64798, 64799, 64800, 64801, 64802, 64803,
+    64804, 64805, 64806, 64807, 64808, 64809, 64810, 64811, 64812, 64813, 64814, 64815,
+    64816, 64817, 64818, 64819, 64820, 64821, 64822, 64823, 64824, 64825, 64826, 64827,
+    64828, 64829, 64848, 64849, 64850, 64851, 64852, 64853, 64854, 64855, 64856, 64857,
+    64858, 64859, 64860, 64861, 64862, 64863, 64864, 64865, 64866, 64867, 64868, 64869,
+    64870, 64871, 64872, 64873, 64874, 64875, 64876, 64877, 64878, 64879, 64880, 64881,
+    64882, 64883, 64884, 64885, 64886, 64887, 64888, 64889, 64890, 64891, 64892, 64893,
+    64894, 64895, 64896, 64897, 64898, 64899, 64900, 64901, 64902, 64903, 64904, 64905,
+    64906, 64907, 64908, 64909, 64910, 64911, 64914, 64915, 64916, 64917, 64918, 64919,
+    64920, 64921, 64922, 64923, 64924, 64925, 64926, 64927, 64928, 64929, 64930, 64931,
+    64932, 64933, 64934, 64935, 64936, 64937, 64938, 64939, 64940, 64941, 64942, 64943,
+    64944, 64945, 64946, 64947, 64948, 64949, 64950, 64951, 64952, 64953, 64954, 64955,
+    64956, 64957, 64958, 64959, 64960, 64961, 64962, 64963, 64964, 64965, 64966, 64967,
+    65008, 65009, 65010, 65011, 65012, 65013, 65014, 65015, 65016, 65017, 65018, 65019,
+    65020, 65040, 65041, 65042, 65043, 65044, 65045, 65046, 65047, 65048, 65049, 65072,
+    65073, 65074, 65075, 65076, 65077, 65078, 65079, 65080, 65081, 65082, 65083, 65084,
+    65085, 65086, 65087, 65088, 65089, 65090, 65091, 65092, 65095, 65096, 65097, 65098,
+    65099, 65100, 65101, 65102, 65103, 65104, 65105, 65106, 65108, 65109, 65110, 65111,
+    65112, 65113, 65114, 65115, 65116, 65117, 65118, 65119, 65120, 65121, 65122, 65123,
+    65124, 65125, 65126, 65128, 65129, 65130, 65131, 65136, 65137, 65138, 65140, 65142,
+    65143, 65144, 65145, 65146, 65147, 65148, 65149, 65150, 65151, 65152, 65153, 65154,
+    65155, 65156, 65157, 65158, 65159, 65160, 65161, 65162, 65163, 65164, 65165, 65166,
+    65167, 65168, 65169, 65170, 65171, 65172, 65173, 65174, 65175, 65176, 65177, 65178,
+    65179, 65180, 65181, 65182, 65183, 65184, 65185, 65186, 65187, 65188, 65189, 65190,
+    65191, 65192, 65193, 65194, 65195, 65196, 65197, 65198, 65199, 65200, 65201, 65202,
+    65203, 65204, 65205, 65206, 65207, 65208, 65209, 65210, 65211, 65212, 65213, 65214,
+    65215, 65216, 65217, 65218, 65219, 65220, 65221, 65222, 65223, 65224, 65225, 65226,
+    65227, 65228, 65229, 65230, 65231, 65232, 65233, 65234, 65235, 65236, 65237, 65238,
+    65239, 65240, 65241, 65242, 65243, 65244, 65245, 65246, 65247, 65248, 65249, 65250,
+    65251, 65252, 65253, 65254, 65255, 65256, 65257, 65258, 65259, 65260, 65261, 65262,
+    65263, 65264, 65265, 65266, 65267, 65268, 65269, 65270, 65271, 65272, 65273, 65274,
+    65275, 65276, 65281, 65282, 65283, 65284, 65285, 65286, 65287, 65288, 65289, 65290,
+    65291, 65292, 65293, 65294, 65295, 65296, 65297, 65298, 65299, 65300, 65301, 65302,
+    65303, 65304, 65305, 65306, 65307, 65308, 65309, 65310, 65311, 65312, 65313, 65314,
+    65315, 65316, 65317, 65318, 65319, 65320, 65321, 65322, 65323, 65324, 65325, 65326,
+    65327, 65328, 65329, 65330, 65331, 65332, 65333, 65334, 65335, 65336, 65337, 65338,
+    65339, 65340, 65341, 65342, 65343, 65344, 65345, 65346, 65347, 65348, 65349, 65350,
+    65351, 65352, 65353, 65354, 65355, 65356, 65357, 65358, 65359, 65360, 65361, 65362,
+    65363, 65364, 65365, 65366, 65367, 65368, 65369, 65370, 65371, 65372, 65373, 65374,
+    65375, 65376, 65377, 65378, 65379, 65380, 65381, 65382, 65383, 65384, 65385, 65386,
+    65387, 65388, 65389, 65390, 65391, 65392, 65393, 65394, 65395, 65396, 65397, 65398,
+    65399, 65400, 65401, 65402, 65403, 65404, 65405, 65406, 65407, 65408, 65409, 65410,
+    65411, 65412, 65413, 65414, 65415, 65416, 65417, 65418, 65419, 65420, 65421, 65422,
+    65423, 65424, 65425, 65426, 65427, 65428, 65429, 65430, 65431, 65432, 65433, 65434,
+    65435, 65436, 65437, 65438, 65439, 65440, 65441, 65442, 65443, 65444, 65445, 65446,
+    65447, 65448, 65449, 65450, 65451, 65452, 65453, 65454, 65455, 65456, 65457, 65458,
+    65459, 65460, 65461, 65462, 65463, 65464, 65465, 65466, 65467, 65468, 65469, 65470,
+    65474, 65475, 65476, 65477, 65478, 65479, 65482, 65483, 65484, 65485, 65486, 65487,
+    65490, 65491, 65492, 65493, 65494, 65495, 65498, 65499, 65500, 65504, 65505, 65506,
+    65507, 65508, 65509, 65510, 65512, 65513, 65514, 65515, 65516, 65517, 65518, 67457,
+    67458, 67459, 67460, 67461, 67463, 67464, 67465, 67466, 67467, 67468, 67469, 67470,
+    67471, 67472, 67473, 67474, 67475, 67476, 67477, 67478, 67479, 67480, 67481, 67482,
+    67483, 67484, 67485, 67486, 67487, 67488, 67489, 67490, 67491, 67492, 67493, 67494,
+    67495, 67496, 67497, 67498, 67499, 67500, 67501, 67502, 67503, 67504, 67506, 67507,
+    67508, 67509, 67510, 67511, 67512, 67513, 67514, 119808, 119809, 119810, 119811, 119812,
+    119813, 119814, 119815, 119816, 119817, 119818, 119819, 119820, 119821, 119822, 119823, 119824,
+    119825, 119826, 119827, 119828, 119829, 119830, 119831, 119832, 119833, 119834, 119835, 119836,
+    119837, 119838, 119839, 119840, 119841, 119842, 119843, 119844, 119845, 119846, 119847, 119848,
+    119849, 119850, 119851, 119852, 119853, 119854, 119855, 119856, 119857, 119858, 119859, 119860,
+    119861, 119862, 119863, 119864, 119865, 119866, 119867, 119868, 119869, 119870, 119871, 119872,
+    119873, 119874, 119875, 119876, 119877, 119878, 119879, 119880, 119881, 119882, 119883, 119884,
+    119885, 119886, 119887, 119888, 119889, 119890, 119891, 119892, 119894, 119895, 119896, 119897,
+    119898, 119899, 119900, 119901, 119902, 119903, 119904, 119905, 119906, 119907, 119908, 119909,
+    119910, 119911, 119912, 119913, 119914, 119915, 119916, 119917, 119918, 119919, 119920, 119921,
+    119922, 119923, 119924, 119925, 119926, 119927, 119928, 119929, 119930, 119931, 119932, 119933,
+    119934, 119935, 119936, 119937, 119938, 119939, 119940, 119941, 119942, 119943, 119944, 119945,
+    119946, 119947, 119948, 119949, 119950, 119951, 119952, 119953, 119954, 119955, 119956, 119957,
+    119958, 119959, 119960, 119961, 119962, 119963, 119964, 119966, 119967, 119970, 119973, 119974,
+    119977, 119978, 119979, 119980, 119982, 119983, 119984, 119985, 119986, 119987, 119988, 119989,
+    119990, 119991, 119992, 119993, 119995, 119997, 119998, 119999, 120000, 120001, 120002, 120003,
+    120005, 120006, 120007, 120008, 120009, 120010, 120011, 120012, 120013, 120014, 120015, 120016,
+    120017, 120018, 120019, 120020, 120021, 120022, 120023, 120024, 120025, 120026, 120027, 120028,
+    120029, 120030, 120031, 120032, 120033, 120034, 120035, 120036, 120037, 120038, 120039, 120040,
+    120041, 120042, 120043, 120044, 120045, 120046, 120047, 120048, 120049, 120050, 120051, 120052,
+    120053, 120054, 120055, 120056, 120057, 120058, 120059, 120060, 120061, 120062, 120063, 120064,
+    120065, 120066, 120067, 120068, 120069, 120071, 120072, 120073, 120074, 120077, 120078, 120079,
+    120080, 120081, 120082, 120083, 120084, 120086, 120087, 120088, 120089, 120090, 120091, 120092,
+    120094, 120095, 120096, 120097, 120098, 120099, 120100, 120101, 120102, 120103, 120104, 120105,
+    120106, 120107, 120108, 120109, 120110, 120111, 120112, 120113, 120114, 120115, 120116, 120117,
+    120118, 120119, 120120, 120121, 120123, 120124, 120125, 120126, 120128, 120129, 120130, 120131,
+    120132, 120134, 120138, 120139, 120140, 120141, 120142, 120143, 120144, 120146, 120147, 120148,
+    120149, 120150, 120151, 120152, 120153, 120154, 120155, 120156, 120157, 120158, 120159, 120160,
+    120161, 120162, 120163, 120164, 120165, 120166, 120167, 120168, 120169, 120170, 120171, 120172,
+    120173, 120174, 120175, 120176, 120177, 120178, 120179, 120180, 120181, 120182, 120183, 120184,
+    120185, 120186, 120187, 120188, 120189, 120190, 120191, 120192, 120193, 120194, 120195, 120196,
+    120197, 120198, 120199, 120200, 120201, 120202, 120203, 120204, 120205, 120206, 120207, 120208,
+    120209, 120210, 120211, 120212, 120213, 120214, 120215, 120216, 120217, 120218, 120219, 120220,
+    120221, 120222, 120223, 120224, 120225, 120226, 120227, 120228, 120229, 120230, 120231, 120232,
+    120233, 120234, 120235, 120236, 120237, 120238, 120239, 120240, 120241, 120242, 120243, 120244,
+    120245, 120246, 120247, 120248, 120249, 120250, 120251, 120252, 120253, 120254, 120255, 120256,
+    120257, 120258, 120259, 120260, 120261, 120262, 120263, 120264, 120265, 120266, 120267, 120268,
+    120269, 120270, 120271, 120272, 120273, 120274, 120275, 120276, 120277, 120278, 120279, 120280,
+    120281, 120282, 120283, 120284, 120285, 120286, 120287, 120288, 120289, 120290, 120291, 120292,
+    120293, 120294, 120295, 120296, 120297, 120298, 120299, 120300, 120301, 120302, 120303, 120304,
+    120305, 120306, 120307, 120308, 120309, 120310, 120311, 120312, 120313, 120314, 120315, 120316,
+    120317, 120318, 120319, 120320, 120321, 120322, 120323, 120324, 120325, 120326, 120327, 120328,
+    120329, 120330, 120331, 120332, 120333, 120334, 120335, 120336, 120337, 120338, 120339, 120340,
+    120341, 120342, 120343, 120344, 120345, 120346, 120347, 120348, 120349, 120350, 120351, 120352,
+    120353, 120354, 120355, 120356, 120357, 120358, 120359, 120360, 120361, 120362, 120363, 120364,
+    120365, 120366, 120367, 120368, 120369, 120370, 120371, 120372, 120373, 120374, 120375, 120376,
+    120377, 120378, 120379, 120380, 120381, 120382, 120383, 120384, 120385, 120386, 120387, 120388,
+    120389, 120390, 120391, 120392, 120393, 120394, 120395, 120396, 120397, 120398, 120399, 120400,
+    120401, 120402, 120403, 120404, 120405, 120406, 120407, 120408, 120409, 120410, 120411, 120412,
+    120413, 120414, 120415, 120416, 120417, 120418, 120419, 120420, 120421, 120422, 120423, 120424,
+    120425, 120426, 120427, 120428, 120429, 120430, 120431, 120432, 120433, 120434, 120435, 120436,
+    120437, 120438, 120439, 120440, 120441, 120442, 120443, 120444, 120445, 120446, 120447, 120448,
+    120449, 120450, 120451, 120452, 120453, 120454, 120455, 120456, 120457, 120458, 120459, 120460,
+    120461, 120462, 120463, 120464, 120465, 120466, 120467, 120468, 120469, 120470, 120471, 120472,
+    120473, 120474, 120475, 120476, 120477, 120478, 120479, 120480, 120481, 120482, 120483, 120484,
+    120485, 120488, 120489, 120490, 120491, 120492, 120493, 120494, 120495, 120496, 120497, 120498,
+    120499, 120500, 120501, 120502, 120503, 120504, 120505, 120506, 120507, 120508, 120509, 120510,
+    120511, 120512, 120513, 120514, 120515, 120516, 120517, 120518, 120519, 120520, 120521, 120522,
+    120523, 120524, 120525, 120526, 120527, 120528, 120529, 120530, 120531, 120532, 120533, 120534,
+    120535, 120536, 120537, 120538, 120539, 120540, 120541, 120542, 120543, 120544, 120545, 120546,
+    120547, 120548, 120549, 120550, 120551, 120552, 120553, 120554, 120555, 120556, 120557, 120558,
+    120559, 120560, 120561, 120562, 120563, 120564, 120565, 120566, 120567, 120568, 120569, 120570,
+    120571, 120572, 120573, 120574, 120575, 120576, 120577, 120578, 120579, 120580, 120581, 120582,
+    120583, 120584, 120585, 120586, 120587, 120588, 120589, 120590, 120591, 120592, 120593, 120594,
+    120595, 120596, 120597, 120598, 120599, 120600, 120601, 120602, 120603, 120604, 120605, 120606,
+    120607, 120608, 120609, 120610, 120611, 120612, 120613, 120614, 120615, 120616, 120617, 120618,
+    120619, 120620, 120621, 120622, 120623, 120624, 120625, 120626, 120627, 120628, 120629, 120630,
+    120631, 120632, 120633, 120634, 120635, 120636, 120637, 120638, 120639, 120640, 120641, 120642,
+    120643, 120644, 120645, 120646, 120647, 120648, 120649, 120650, 120651, 120652, 120653, 120654,
+    120655, 120656, 120657, 120658, 120659, 120660, 120661, 120662, 120663, 120664, 120665, 120666,
+    120667, 120668, 120669, 120670, 120671, 120672, 120673, 120674, 120675, 120676, 120677, 120678,
+    120679, 120680, 120681, 120682, 120683, 120684, 120685, 120686, 120687, 120688, 120689, 120690,
+    120691, 120692, 120693, 120694, 120695, 120696, 120697, 120698, 120699, 120700, 120701, 120702,
+    120703, 120704, 120705, 120706, 120707, 120708, 120709, 120710, 120711, 120712, 120713, 120714,
+    120715, 120716, 120717, 120718, 120719, 120720, 120721, 120722, 120723, 120724, 120725, 120726,
+    120727, 120728, 120729, 120730, 120731, 120732, 120733, 120734, 120735, 120736, 120737, 120738,
+    120739, 120740, 120741, 120742, 120743, 120744, 120745, 120746, 120747, 120748, 120749, 120750,
+    120751, 120752, 120753, 120754, 120755, 120756, 120757, 120758, 120759, 120760, 120761, 120762,
+    120763, 120764, 120765, 120766, 120767, 120768, 120769, 120770, 120771, 120772, 120773, 120774,
+    120775, 120776, 120777, 120778, 120779, 120782, 120783, 120784, 120785, 120786, 120787, 120788,
+    120789, 120790, 120791, 120792, 120793, 120794, 120795, 120796, 120797, 120798, 120799, 120800,
+    120801, 120802, 120803, 120804, 120805, 120806, 120807, 120808, 120809, 120810, 120811, 120812,
+    120813, 120814, 120815, 120816, 120817, 120818, 120819, 120820, 120821, 120822, 120823, 120824,
+    120825, 120826, 120827, 120828, 120829, 120830, 120831, 126464, 126465, 126466, 126467, 126469,
+    126470, 126471, 126472, 126473, 126474, 126475, 126476, 126477, 126478, 126479, 126480, 126481,
+    126482, 126483, 126484, 126485, 126486, 126487, 126488, 126489, 126490, 126491, 126492, 126493,
+    126494, 126495, 126497, 126498, 126500, 126503, 126505, 126506, 126507, 126508, 126509, 126510,
+    126511, 126512, 126513, 126514, 126516, 126517, 126518, 126519, 126521, 126523, 126530, 126535,
+    126537, 126539, 126541, 126542, 126543, 126545, 126546, 126548, 126551, 126553, 126555, 126557,
+    126559, 126561, 126562, 126564, 126567, 126568, 126569, 126570, 126572, 126573, 126574, 126575,
+    126576, 126577, 126578, 126580, 126581, 126582, 126583, 126585, 126586, 126587, 126588, 126590,
+    126592, 126593, 126594, 126595, 126596, 126597, 126598, 126599, 126600, 126601, 126603, 126604,
+    126605, 126606, 126607, 126608, 126609, 126610, 126611, 126612, 126613, 126614, 126615, 126616,
+    126617, 126618, 126619, 126625, 126626, 126627, 126629, 126630, 126631, 126632, 126633, 126635,
+    126636, 126637, 126638, 126639, 126640, 126641, 126642, 126643, 126644, 126645, 126646, 126647,
+    126648, 126649, 126650, 126651, 127232, 127233, 127234, 127235, 127236, 127237, 127238, 127239,
+    127240, 127241, 127242, 127248, 127249, 127250, 127251, 127252, 127253, 127254, 127255, 127256,
+    127257, 127258, 127259, 127260, 127261, 127262, 127263, 127264, 127265, 127266, 127267, 127268,
+    127269, 127270, 127271, 127272, 127273, 127274, 127275, 127276, 127277, 127278, 127280, 127281,
+    127282, 127283, 127284, 127285, 127286, 127287, 127288, 127289, 127290, 127291, 127292, 127293,
+    127294, 127295, 127296, 127297, 127298, 127299, 127300, 127301, 127302, 127303, 127304, 127305,
+    127306, 127307, 127308, 127309, 127310, 127311, 127338, 127339, 127340, 127376, 127488, 127489,
+    127490, 127504, 127505, 127506, 127507, 127508, 127509, 127510, 127511, 127512, 127513, 127514,
+    127515, 127516, 127517, 127518, 127519, 127520, 127521, 127522, 127523, 127524, 127525, 127526,
+    127527, 127528, 127529, 127530, 127531, 127532, 127533, 127534, 127535, 127536, 127537, 127538,
+    127539, 127540, 127541, 127542, 127543, 127544, 127545, 127546, 127547, 127552, 127553, 127554,
+    127555, 127556, 127557, 127558, 127559, 127560, 127568, 127569, 130032, 130033, 130034, 130035,
+    130036, 130037, 130038, 130039, 130040, 130041,
+};
+static const uint32_t UNI_NFKD_VALS[] = {
+    1, 258, 769, 1026, 1537, 1793, 2050, 2561, 2818, 3329, 3585, 3843,
+    4611, 5379, 6146, 6658, 7170, 7682, 8194, 8705, 8963, 9731, 10499, 11266,
+    11778, 12290, 12802, 13314, 13826, 14338, 14850, 15362, 15873, 16129, 16385, 16641,
+    16897, 17153, 17409, 17665, 17921, 18178, 18690, 19202, 19714, 20226, 20738, 21249,
+    21505, 21761, 22017, 22273, 22530, 23042, 23555, 24321, 24577, 24833, 25090, 25602,
+    26113, 26369, 26625, 26881, 27137, 27393, 27649, 27905, 28162, 28674, 29186, 29698,
+    30210, 30722, 31234, 31746, 32258, 32769, 33027, 33795, 34561, 34817, 35073, 35329,
+    35585, 35841, 36097, 36353, 36609, 36865, 37121, 37377, 37633, 37889, 38145, 38401,
+    38657, 38913, 39169, 39425, 39681, 39937, 40193, 40449, 40705, 40961, 41217, 41473,
+    41729, 41985, 42241, 42497, 42753, 43009, 43265, 43521, 43777, 44033, 44289, 44545,
+    44801, 45057, 45313, 45569, 45825, 46081, 46337, 46593, 46849, 47105, 47361, 47617,
+    47873, 48129, 48385, 48641, 48897, 49153, 49409, 49665, 49921, 50177, 50433, 50689,
+    50945, 51201, 51457, 51713, 51969, 52225, 52481, 52737, 52993, 53249, 53505, 53761,
+    54017, 54273, 54529, 54785, 55041, 55297, 55553, 55809, 56065, 56321, 56577, 56833,
+    57089, 57345, 57601, 57857, 58113, 58369, 58625, 58881, 59137, 59393, 59649, 59906,
+    60418, 60930, 61442, 61954, 62467, 63235, 64003, 64771, 65539, 66307, 67075, 67843,
+    68611, 69378, 69890, 70401, 70657, 70913, 71169, 71425, 71681, 71937, 72193, 72449,
+    72705, 72961, 73217, 73474, 73985, 74242, 74755, 75521, 75778, 76291, 77058, 77571,
+    78338, 78850, 79362, 79874, 80386, 80900, 81921, 82177, 82433, 82689, 82945, 83201,
+    83457, 83713, 83969, 84225, 84481, 84737, 84993, 85249, 85505, 85761, 86017, 86273,
+    86529, 86785, 87041, 87297, 87553, 87809, 88065, 88321, 88577, 88833, 89089, 89345,
+    89601, 89857, 90113, 90369, 90625, 90881, 91137, 91393, 91649, 91905, 92161, 92417,
+    92673, 92930, 93443, 94211, 94977, 95234, 95747, 96515, 97281, 97538, 98049, 98305,
+    98561, 98817, 99073, 99329, 99585, 99841, 100097, 100353, 100609, 100866, 101377, 101633,
+    101889, 102145, 102401, 102658, 103171, 103938, 104449, 104705, 104961, 105217, 105473, 105729,
+    105985, 106241, 106497, 106753, 107009, 107265, 107521, 107777, 108035, 108801, 109057, 109313,
+    109569, 109825, 110081, 110337, 110593, 110849, 111105, 111363, 112131, 112900, 113923, 114691,
+    115459, 116227, 116995, 117763, 118531, 119299, 120067, 120835, 121603, 122371, 123138, 123649,
+    123906, 124419, 125186, 125697, 125954, 126467, 127236, 128258, 128769, 129026, 129539, 130305,
+    130561, 130817, 131073, 131329, 131586, 132099, 132866, 133377, 133634, 134147, 134916, 135938,
+    136449, 136706, 137219, 137985, 138241, 138497, 138753, 139011, 139778, 140291, 141058, 141571,
+    142337, 142593, 142849, 143105, 143361, 143617, 143873, 144129, 144385, 144642, 145154, 145666,
+    146178, 146690, 147202, 147714, 148226, 148738, 149250, 149762, 150275, 151043, 151811, 152579,
+    153347, 154115, 154883, 155651, 156419, 157188, 158212, 159236, 160260, 161284, 162308, 163332,
+    164356, 165380, 166404, 167428, 168450, 168962, 169474, 169986, 170498, 171010, 171522, 172034,
+    172546, 173059, 173827, 174595, 175363, 176131, 176899, 177667, 178435, 179203, 179971, 180739,
+    181507, 182275, 183043, 183811, 184579, 185347, 186115, 186883, 187651, 188419, 189187, 189955,
+    190723, 191491, 192259, 193027, 193795, 194563, 195331, 196099, 196867, 197635, 198403, 199171,
+    199939, 200707, 201473, 201729, 201985, 202241, 202497, 202753, 203009, 203265, 203521, 203777,
+    204033, 204289, 204545, 204801, 205057, 205313, 205569, 205825, 206081, 206337, 206593, 206849,
+    207105, 207361, 207617, 207873, 208129, 208385, 208641, 208897, 209153, 209409, 209665, 209921,
+    210177, 210433, 210689, 210945, 211201, 211457, 211713, 211969, 212225, 212481, 212737, 212993,
+    213249, 213505, 213761, 214017, 214273, 214529, 214785, 215044, 216067, 216834, 217347, 218113,
+    218369, 218625, 218881, 219137, 219393, 219649, 219905, 220161, 220417, 220673, 220929, 221185,
+    221441, 221697, 221953, 222209, 222465, 222721, 222977, 223233, 223489, 223745, 224001, 224257,
+    224513, 224769, 225025, 225281, 225537, 225793, 226049, 226305, 226561, 226817, 227073, 227329,
+    227585, 227841, 228097, 228353, 228609, 228865, 229121, 229377, 229633, 229889, 230145, 230401,
+    230657, 230913, 231169, 231425, 231681, 231937, 232193, 232449, 232705, 232961, 233217, 233473,
+    233729, 233985, 234241, 234497, 234753, 235009, 235265, 235521, 235777, 236033, 236289, 236545,
+    236801, 237057, 237313, 237569, 237825, 238081, 238337, 238593, 238849, 239105, 239361, 239617,
+    239873, 240129, 240385, 240641, 240897, 241153, 241409, 241665, 241921, 242177, 242433, 242689,
+    242945, 243201, 243457, 243713, 243969, 244225, 244481, 244737, 244993, 245249, 245505, 245761,
+    246017, 246273, 246529, 246785, 247041, 247297, 247553, 247809, 248065, 248321, 248577, 248833,
+    249089, 249345, 249601, 249857, 250113, 250369, 250625, 250881, 251137, 251393, 251649, 251905,
+    252161, 252417, 252673, 252929, 253185, 253441, 253697, 253953, 254209, 254465, 254721, 254977,
+    255233, 255489, 255745, 256001, 256257, 256513, 256769, 257025, 257281, 257537, 257793, 258049,
+    258305, 258561, 258817, 259073, 259329, 259585, 259841, 260097, 260353, 260609, 260865, 261121,
+    261377, 261633, 261889, 262145, 262401, 262657, 262913, 263169, 263425, 263681, 263937, 264193,
+    264449, 264705, 264961, 265217, 265473, 265729, 265985, 266241, 266497, 266753, 267009, 267265,
+    267521, 267777, 268033, 268289, 268545, 268801, 269057, 269313, 269569, 269825, 270081, 270337,
+    270593, 270849, 271105, 271361, 271617, 271873, 272129, 272385, 272641, 272897, 273153, 273409,
+    273665, 273921, 274177, 274433, 274689, 274945, 275201, 275458, 275970, 276482, 276994, 277505,
+    277761, 278017, 278273, 278529, 278785, 279041, 279297, 279553, 279809, 280065, 280321, 280577,
+    280833, 281089, 281345, 281601, 281857, 282113, 282369, 282625, 282881, 283137, 283393, 283649,
+    283905, 284161, 284417, 284673, 284929, 285185, 285441, 285697, 285953, 286209, 286465, 286721,
+    286977, 287233, 287489, 287745, 288001, 288257, 288513, 288769, 289025, 289281, 289537, 289793,
+    290049, 290305, 290561, 290817, 291073, 291329, 291585, 291841, 292097, 292353, 292609, 292865,
+    293121, 293377, 293633, 293889, 294145, 294401, 294657, 294913, 295169, 295425, 295681, 295937,
+    296193, 296449, 296705, 296961, 297217, 297473, 297729, 297985, 298241, 298497, 298753, 299009,
+    299265, 299521, 299777, 300033, 300289, 300545, 300801, 301057, 301313, 301569, 301825, 302081,
+    302337, 302593, 302849, 303105, 303361, 303617, 303873, 304129, 304385, 304641, 304897, 305155,
+    305923, 306691, 307459, 308227, 308995, 309763, 310531, 311299, 312067, 312835, 313603, 314371,
+    315139, 315908, 316932, 317956, 318980, 320004, 321028, 322052, 323076, 324100, 325124, 326148,
+    327172, 328196, 329220, 330244, 331271, 333062, 334595, 335363, 336131, 336899, 337667, 338435,
+    339203, 339971, 340739, 341507, 342275, 343043, 343811, 344579, 345347, 346115, 346883, 347651,
+    348419, 349187, 349955, 350723, 351491, 352259, 353027, 353795, 354563, 355331, 356099, 356867,
+    357635, 358403, 359171, 359939, 360707, 361475, 362241, 362497, 362753, 363009, 363267, 364034,
+    364546, 365058, 365570, 366082, 366594, 367106, 367618, 368130, 368642, 369154, 369666, 370178,
+    370690, 371202, 371713, 371969, 372225, 372481, 372737, 372993, 373249, 373505, 373761, 374017,
+    374273, 374529, 374785, 375041, 375298, 375810, 376322, 376834, 377346, 377858, 378370, 378882,
+    379394, 379906, 380418, 380930, 381442, 381954, 382469, 383748, 384770, 385281, 385537, 385793,
+    386049, 386305, 386561, 386817, 387073, 387329, 387585, 387841, 388097, 388353, 388609, 388865,
+    389121, 389377, 389633, 389889, 390145, 390401, 390657, 390913, 391169, 391425, 391681, 391937,
+    392193, 392449, 392705, 392961, 393217, 393473, 393729, 393985, 394241, 394497, 394753, 395009,
+    395265, 395521, 395777, 396033, 396289, 396545, 396801, 397057, 397313, 397569, 397826, 398338,
+    398850, 399362, 399874, 400386, 400898, 401410, 401922, 402434, 402946, 403458, 403970, 404482,
+    404994, 405506, 406018, 406530, 407042, 407554, 408066, 408578, 409090, 409602, 410115, 410883,
+    411651, 412418, 412931, 413698, 414211, 414977, 415233, 415489, 415745, 416001, 416257, 416513,
+    416769, 417025, 417281, 417537, 417793, 418049, 418305, 418561, 418817, 419073, 419329, 419585,
+    419841, 420097, 420353, 420609, 420865, 421121, 421377, 421633, 421889, 422145, 422401, 422657,
+    422913, 423169, 423425, 423681, 423937, 424193, 424449, 424705, 424961, 425217, 425473, 425729,
+    425985, 426241, 426497, 426753, 427010, 427525, 428804, 429829, 431107, 431877, 433155, 433923,
+    434694, 436228, 437251, 438019, 438787, 439556, 440580, 441604, 442628, 443652, 444676, 445700,
+    446726, 448258, 448774, 450310, 451845, 453124, 454150, 455686, 457220, 458243, 459011, 459780,
+    460804, 461829, 463109, 464387, 465155, 465924, 466947, 467715, 468482, 468994, 469507, 470275,
+    471046, 472580, 473605, 474886, 476420, 477443, 478211, 478982, 480516, 481542, 483075, 483845,
+    485123, 485892, 486915, 487684, 488709, 489988, 491013, 492292, 493314, 493829, 495107, 495875,
+    496644, 497667, 498435, 499203, 499973, 501252, 502274, 502790, 504323, 505093, 506372, 507396,
+    508419, 509187, 509956, 510978, 511492, 512517, 513794, 514310, 515843, 516610, 517122, 517634,
+    518146, 518658, 519170, 519682, 520194, 520706, 521218, 521731, 522499, 523267, 524035, 524803,
+    525571, 526339, 527107, 527875, 528643, 529411, 530179, 530947, 531715, 532483, 533251, 534018,
+    534530, 535043, 535810, 536322, 536834, 537347, 538115, 538882, 539394, 539906, 540418, 540930,
+    541444, 542466, 542978, 543490, 544002, 544514, 545026, 545538, 546050, 546563, 547332, 548354,
+    548866, 549378, 549890, 550402, 550914, 551426, 551939, 552707, 553475, 554243, 555010, 555522,
+    556034, 556546, 557058, 557570, 558082, 558594, 559106, 559618, 560131, 560899, 561666, 562179,
+    562947, 563715, 564482, 564995, 565763, 566532, 567554, 568067, 568835, 569603, 570371, 571141,
+    572422, 573954, 574466, 574978, 575490, 576002, 576514, 577026, 577538, 578050, 578562, 579074,
+    579586, 580098, 580610, 581122, 581634, 582146, 582658, 583172, 584194, 584706, 585218, 585732,
+    586755, 587522, 588034, 588546, 589058, 589570, 590082, 590594, 591106, 591618, 592130, 592643,
+    593410, 593922, 594435, 595203, 595970, 596484, 597507, 598274, 598786, 599298, 599810, 600323,
+    601091, 601858, 602370, 602882, 603394, 603906, 604418, 604930, 605442, 605954, 606467, 607235,
+    608003, 608771, 609539, 610307, 611075, 611843, 612611, 613379, 614147, 614915, 615683, 616451,
+    617219, 617987, 618755, 619523, 620291, 621059, 621827, 622595, 623363, 624129, 624385, 624641,
+    624897, 625153, 625409, 625665, 625921, 626177, 626433, 626689, 626945, 627201, 627458, 627970,
+    628482, 628995, 629763, 630530, 631042, 631554, 632066, 632578, 633090, 633602, 634113, 634369,
+    634625, 634881, 635137, 635393, 635649, 635905, 636161, 636417, 636674, 637185, 637441, 637697,
+    637953, 638209, 638465, 638721, 638977, 639233, 639489, 639745, 640001, 640257, 640513, 640769,
+    641025, 641281, 641537, 641793, 642049, 642305, 642561, 642817, 643073, 643329, 643585, 643841,
+    644097, 644353, 644609, 644865, 645121, 645377, 645633, 645889, 646145, 646401, 646657, 646913,
+    647169, 647425, 647681, 647937, 648193, 648449, 648705, 648961, 649217, 649473, 649729, 649985,
+    650241, 650497, 650753, 651009, 651265, 651521, 651777, 652033, 652289, 652545, 652801, 653057,
+    653313, 653569, 653825, 654081, 654337, 654593, 654849, 655105, 655361, 655617, 655873, 656129,
+    656385, 656641, 656897, 657153, 657409, 657665, 657921, 658177, 658433, 658690, 659202, 659713,
+    659969, 660225, 660481, 660737, 660993, 661249, 661505, 661761, 662017, 662274, 662786, 663297,
+    663553, 663809, 664065, 664321, 664577, 664833, 665089, 665345, 665601, 665858, 666369, 666625,
+    666881, 667137, 667393, 667649, 667905, 668161, 668417, 668673, 668929, 669185, 669443, 670211,
+    670979, 671747, 672515, 673283, 674051, 674819, 675587, 676355, 677123, 677891, 678659, 679427,
+    680195, 680963, 681731, 682499, 683265, 683521, 683777, 684033, 684291, 685059, 685827, 686595,
+    687363, 688130, 688642, 689154, 689666, 690178, 690690, 691202, 691714, 692226, 692738, 693250,
+    693762, 694274, 694786, 695298, 695810, 696322, 696834, 697346, 697858, 698370, 698882, 699394,
+    699906, 700418, 700930, 701442, 701954, 702466, 702978, 703490, 704002, 704514, 705026, 705538,
+    706050, 706562, 707074, 707586, 708098, 708610, 709122, 709634, 710146, 710658, 711170, 711682,
+    712194, 712706, 713218, 713730, 714242, 714754, 715266, 715778, 716290, 716802, 717314, 717826,
+    718338, 718850, 719362, 719874, 720386, 720898, 721410, 721922, 722434, 722946, 723458, 723970,
+    724482, 724994, 725506, 726018, 726530, 727042, 727554, 728066, 728578, 729090, 729602, 730114,
+    730626, 731138, 731650, 732162, 732674, 733186, 733699, 734467, 735235, 736003, 736771, 737539,
+    738307, 739075, 739843, 740611, 741379, 742147, 742914, 743426, 743938, 744450, 744962, 745474,
+    745986, 746498, 747010, 747522, 748034, 748546, 749058, 749570, 750082, 750594, 751106, 751618,
+    752130, 752642, 753154, 753666, 754178, 754690, 755202, 755714, 756226, 756738, 757250, 757762,
+    758274, 758786, 759298, 759810, 760322, 760834, 761346, 761858, 762370, 762882, 763394, 763906,
+    764418, 764930, 765442, 765955, 766723, 767491, 768259, 769027, 769794, 770306, 770818, 771330,
+    771842, 772354, 772866, 773378, 773890, 774402, 774914, 775426, 775938, 776450, 776962, 777474,
+    777986, 778498, 779010, 779522, 780034, 780546, 781058, 781570, 782082, 782594, 783106, 783618,
+    784130, 784642, 785154, 785666, 786178, 786690, 787202, 787714, 788226, 788738, 789250, 789762,
+    790274, 790786, 791298, 791810, 792322, 792834, 793346, 793858, 794370, 794882, 795394, 795906,
+    796418, 796930, 797442, 797954, 798466, 798978, 799490, 800002, 800514, 801026, 801538, 802050,
+    802562, 803074, 803586, 804099, 804867, 805634, 806146, 806658, 807170, 807682, 808194, 808706,
+    809218, 809730, 810242, 810754, 811266, 811778, 812290, 812802, 813314, 813826, 814339, 815107,
+    815875, 816642, 817154, 817666, 818178, 818690, 819202, 819714, 820226, 820738, 821250, 821762,
+    822274, 822786, 823298, 823810, 824322, 824834, 825346, 825858, 826370, 826882, 827394, 827906,
+    828418, 828930, 829442, 829954, 830466, 830978, 831490, 832002, 832514, 833026, 833538, 834050,
+    834562, 835074, 835586, 836098, 836610, 837122, 837634, 838146, 838658, 839170, 839682, 840194,
+    840706, 841218, 841730, 842242, 842754, 843266, 843778, 844290, 844802, 845314, 845826, 846338,
+    846850, 847362, 847874, 848386, 848898, 849410, 849922, 850434, 850946, 851458, 851970, 852482,
+    852994, 853506, 854019, 854787, 855555, 856323, 857091, 857859, 858627, 859395, 860163, 860931,
+    861699, 862467, 863235, 864003, 864771, 865539, 866307, 867075, 867843, 868611, 869379, 870147,
+    870915, 871683, 872451, 873219, 873987, 874755, 875523, 876291, 877059, 877827, 878595, 879363,
+    880131, 880899, 881667, 882435, 883203, 883971, 884739, 885507, 886275, 887043, 887811, 888579,
+    889347, 890115, 890883, 891651, 892419, 893187, 893955, 894723, 895491, 896259, 897027, 897795,
+    898563, 899331, 900099, 900867, 901635, 902403, 903171, 903939, 904707, 905475, 906243, 907011,
+    907779, 908547, 909315, 910083, 910851, 911619, 912387, 913155, 913923, 914691, 915459, 916227,
+    916995, 917763, 918531, 919299, 920067, 920835, 921603, 922371, 923139, 923907, 924675, 925443,
+    926211, 926979, 927747, 928515, 929283, 930051, 930819, 931587, 932355, 933123, 933891, 934659,
+    935427, 936195, 936963, 937731, 938499, 939267, 940035, 940803, 941571, 942339, 943107, 943875,
+    944643, 945411, 946180, 947204, 948228, 949252, 950276, 951300, 952324, 953347, 954130, 958728,
+    960772, 961793, 962049, 962305, 962561, 962817, 963073, 963329, 963585, 963841, 964099, 964866,
+    965377, 965633, 965889, 966145, 966401, 966657, 966913, 967169, 967425, 967681, 967937, 968193,
+    968449, 968705, 968961, 969217, 969473, 969729, 969985, 970241, 970497, 970753, 971010, 971522,
+    972034, 972546, 973057, 973313, 973569, 973825, 974081, 974337, 974593, 974849, 975105, 975361,
+    975617, 975873, 976129, 976385, 976641, 976897, 977153, 977409, 977665, 977921, 978177, 978433,
+    978689, 978945, 979201, 979457, 979713, 979969, 980225, 980482, 980994, 981506, 982018, 982530,
+    983042, 983554, 984066, 984578, 985090, 985602, 986114, 986626, 987138, 987649, 987906, 988418,
+    988930, 989442, 989954, 990466, 990978, 991490, 992002, 992514, 993026, 993538, 994049, 994305,
+    994561, 994817, 995073, 995329, 995585, 995841, 996097, 996353, 996609, 996865, 997121, 997377,
+    997633, 997889, 998145, 998401, 998657, 998913, 999169, 999425, 999681, 999937, 1000193, 1000449,
+    1000705, 1000961, 1001217, 1001473, 1001729, 1001985, 1002241, 1002497, 1002753, 1003009, 1003265, 1003521,
+    1003777, 1004033, 1004289, 1004545, 1004801, 1005057, 1005313, 1005569, 1005825, 1006081, 1006337, 1006593,
+    1006849, 1007105, 1007361, 1007617, 1007873, 1008129, 1008385, 1008641, 1008897, 1009153, 1009409, 1009665,
+    1009921, 1010177, 1010433, 1010689, 1010945, 1011201, 1011457, 1011713, 1011969, 1012225, 1012481, 1012737,
+    1012993, 1013249, 1013505, 1013761, 1014017, 1014273, 1014529, 1014785, 1015041, 1015297, 1015553, 1015809,
+    1016065, 1016321, 1016577, 1016833, 1017089, 1017345, 1017601, 1017857, 1018113, 1018369, 1018625, 1018881,
+    1019137, 1019393, 1019649, 1019905, 1020161, 1020417, 1020675, 1021443, 1022211, 1022979, 1023747, 1024515,
+    1025282, 1025794, 1026305, 1026561, 1026817, 1027073, 1027329, 1027585, 1027841, 1028097, 1028353, 1028609,
+    1028865, 1029121, 1029377, 1029633, 1029889, 1030145, 1030401, 1030657, 1030913, 1031169, 1031425, 1031681,
+    1031937, 1032193, 1032449, 1032705, 1032961, 1033217, 1033473, 1033729, 1033985, 1034241, 1034497, 1034753,
+    1035009, 1035265, 1035521, 1035777, 1036033, 1036289, 1036545, 1036801, 1037057, 1037313, 1037569, 1037825,
+    1038081, 1038337, 1038593, 1038849, 1039105, 1039361, 1039617, 1039873, 1040129, 1040385, 1040641, 1040897,
+    1041153, 1041409, 1041665, 1041921, 1042177, 1042433, 1042689, 1042945, 1043201, 1043457, 1043713, 1043969,
+    1044225, 1044481, 1044737, 1044993, 1045249, 1045505, 1045761, 1046017, 1046273, 1046529, 1046785, 1047041,
+    1047297, 1047553, 1047809, 1048065, 1048321, 1048577, 1048833, 1049089, 1049345, 1049601, 1049857, 1050113,
+    1050369, 1050625, 1050881, 1051137, 1051393, 1051649, 1051905, 1052161, 1052417, 1052673, 1052929, 1053185,
+    1053441, 1053697, 1053953, 1054209, 1054465, 1054721, 1054977, 1055233, 1055489, 1055745, 1056001, 1056257,
+    1056513, 1056769, 1057025, 1057281, 1057537, 1057793, 1058049, 1058305, 1058561, 1058817, 1059073, 1059329,
+    1059585, 1059841, 1060097, 1060353, 1060609, 1060865, 1061121, 1061377, 1061633, 1061889, 1062145, 1062401,
+    1062657, 1062913, 1063169, 1063425, 1063681, 1063937, 1064193, 1064449, 1064705, 1064961, 1065217, 1065473,
+    1065729, 1065985, 1066241, 1066497, 1066753, 1067009, 1067265, 1067521, 1067777, 1068033, 1068289, 1068545,
+    1068801, 1069057, 1069313, 1069569, 1069825, 1070081, 1070337, 1070593, 1070849, 1071105, 1071361, 1071617,
+    1071873, 1072129, 1072385, 1072641, 1072897, 1073153, 1073409, 1073665, 1073921, 1074177, 1074433, 1074689,
+    1074945, 1075201, 1075457, 1075713, 1075969, 1076225, 1076481, 1076737, 1076993, 1077249, 1077505, 1077761,
+    1078017, 1078273, 1078529, 1078785, 1079041, 1079297, 1079553, 1079809, 1080065, 1080321, 1080577, 1080833,
+    1081090, 1081601, 1081857, 1082113, 1082369, 1082625, 1082881, 1083137, 1083393, 1083649, 1083905, 1084161,
+    1084417, 1084673, 1084929, 1085185, 1085441, 1085697, 1085953, 1086209, 1086465, 1086721, 1086977, 1087233,
+    1087489, 1087745, 1088001, 1088257, 1088513, 1088769, 1089025, 1089281, 1089537, 1089793, 1090049, 1090305,
+    1090561, 1090817, 1091073, 1091329, 1091585, 1091841, 1092097, 1092353, 1092609, 1092865, 1093121, 1093377,
+    1093633, 1093889, 1094145, 1094401, 1094657, 1094913, 1095169, 1095425, 1095681, 1095937, 1096193, 1096449,
+    1096705, 1096961, 1097217, 1097473, 1097729, 1097985, 1098241, 1098497, 1098753, 1099009, 1099265, 1099521,
+    1099777, 1100033, 1100289, 1100545, 1100801, 1101057, 1101313, 1101569, 1101825, 1102081, 1102337, 1102593,
+    1102849, 1103105, 1103361, 1103617, 1103873, 1104129, 1104385, 1104641, 1104897, 1105153, 1105409, 1105665,
+    1105921, 1106177, 1106433, 1106689, 1106945, 1107201, 1107457, 1107713, 1107969, 1108225, 1108481, 1108737,
+    1108993, 1109249, 1109505, 1109761, 1110017, 1110273, 1110529, 1110785, 1111041, 1111297, 1111553, 1111809,
+    1112065, 1112321, 1112577, 1112833, 1113089, 1113345, 1113601, 1113857, 1114113, 1114369, 1114625, 1114881,
+    1115137, 1115393, 1115649, 1115905, 1116161, 1116417, 1116673, 1116929, 1117185, 1117441, 1117697, 1117953,
+    1118209, 1118465, 1118721, 1118977, 1119233, 1119489, 1119745, 1120001, 1120257, 1120513, 1120769, 1121025,
+    1121281, 1121537, 1121793, 1122049, 1122305, 1122561, 1122817, 1123073, 1123329, 1123585, 1123841, 1124097,
+    1124353, 1124609, 1124865, 1125121, 1125377, 1125633, 1125889, 1126145, 1126401, 1126657, 1126913, 1127169,
+    1127425, 1127681, 1127937, 1128193, 1128449, 1128705, 1128961, 1129217, 1129473, 1129729, 1129985, 1130241,
+    1130497, 1130753, 1131009, 1131265, 1131521, 1131777, 1132033, 1132289, 1132545, 1132801, 1133057, 1133313,
+    1133569, 1133825, 1134081, 1134337, 1134593, 1134849, 1135105, 1135361, 1135617, 1135873, 1136129, 1136385,
+    1136641, 1136897, 1137153, 1137409, 1137665, 1137921, 1138177, 1138433, 1138689, 1138945, 1139201, 1139457,
+    1139713, 1139969, 1140225, 1140481, 1140737, 1140993, 1141249, 1141505, 1141761, 1142017, 1142273, 1142529,
+    1142785, 1143041, 1143297, 1143553, 1143809, 1144065, 1144321, 1144577, 1144833, 1145089, 1145345, 1145601,
+    1145857, 1146113, 1146369, 1146625, 1146881, 1147137, 1147393, 1147649, 1147905, 1148161, 1148417, 1148673,
+    1148929, 1149185, 1149441, 1149697, 1149953, 1150209, 1150465, 1150721, 1150977, 1151233, 1151489, 1151745,
+    1152001, 1152257, 1152513, 1152769, 1153025, 1153281, 1153537, 1153793, 1154049, 1154305, 1154561, 1154817,
+    1155073, 1155329, 1155585, 1155841, 1156097, 1156353, 1156609, 1156865, 1157121, 1157377, 1157633, 1157889,
+    1158145, 1158401, 1158657, 1158913, 1159169, 1159425, 1159681, 1159937, 1160193, 1160449, 1160705, 1160961,
+    1161217, 1161473, 1161729, 1161985, 1162241, 1162497, 1162753, 1163009, 1163265, 1163521, 1163777, 1164033,
+    1164289, 1164545, 1164801, 1165057, 1165313, 1165569, 1165825, 1166081, 1166337, 1166593, 1166849, 1167105,
+    1167361, 1167617, 1167873, 1168129, 1168385, 1168641, 1168897, 1169153, 1169409, 1169665, 1169921, 1170177,
+    1170433, 1170689, 1170945, 1171201, 1171457, 1171713, 1171969, 1172225, 1172481, 1172737, 1172993, 1173249,
+    1173505, 1173761, 1174017, 1174273, 1174529, 1174785, 1175041, 1175297, 1175553, 1175809, 1176065, 1176321,
+    1176577, 1176833, 1177089, 1177345, 1177601, 1177857, 1178113, 1178369, 1178625, 1178881, 1179137, 1179393,
+    1179649, 1179905, 1180161, 1180417, 1180673, 1180929, 1181185, 1181441, 1181697, 1181953, 1182209, 1182465,
+    1182721, 1182977, 1183233, 1183489, 1183745, 1184001, 1184257, 1184513, 1184769, 1185025, 1185281, 1185537,
+    1185793, 1186049, 1186305, 1186561, 1186817, 1187073, 1187329, 1187585, 1187841, 1188097, 1188353, 1188609,
+    1188865, 1189121, 1189377, 1189633, 1189889, 1190145, 1190401, 1190657, 1190913, 1191169, 1191425, 1191681,
+    1191937, 1192193, 1192449, 1192705, 1192961, 1193217, 1193473, 1193729, 1193985, 1194241, 1194497, 1194753,
+    1195009, 1195265, 1195521, 1195777, 1196033, 1196289, 1196545, 1196801, 1197057, 1197313, 1197569, 1197825,
+    1198081, 1198337, 1198593, 1198849, 1199105, 1199361, 1199617, 1199873, 1200129, 1200385, 1200641, 1200897,
+    1201153, 1201409, 1201665, 1201921, 1202177, 1202433, 1202689, 1202945, 1203201, 1203457, 1203713, 1203969,
+    1204225, 1204481, 1204737, 1204993, 1205249, 1205505, 1205761, 1206017, 1206273, 1206529, 1206785, 1207041,
+    1207297, 1207553, 1207809, 1208065, 1208321, 1208577, 1208833, 1209089, 1209345, 1209601, 1209857, 1210113,
+    1210369, 1210625, 1210881, 1211137, 1211393, 1211649, 1211905, 1212161, 1212417, 1212673, 1212929, 1213185,
+    1213441, 1213697, 1213953, 1214209, 1214465, 1214721, 1214977, 1215233, 1215489, 1215745, 1216001, 1216257,
+    1216513, 1216769, 1217025, 1217281, 1217537, 1217793, 1218049, 1218305, 1218561, 1218817, 1219073, 1219329,
+    1219585, 1219841, 1220097, 1220353, 1220609, 1220865, 1221121, 1221377, 1221633, 1221889, 1222145, 1222401,
+    1222657, 1222913, 1223169, 1223425, 1223681, 1223937, 1224193, 1224449, 1224705, 1224961, 1225217, 1225473,
+    1225729, 1225985, 1226241, 1226497, 1226753, 1227009, 1227265, 1227521, 1227777, 1228033, 1228289, 1228545,
+    1228801, 1229057, 1229313, 1229569, 1229825, 1230081, 1230337, 1230593, 1230849, 1231105, 1231361, 1231617,
+    1231873, 1232129, 1232385, 1232641, 1232897, 1233153, 1233409, 1233665, 1233921, 1234177, 1234433, 1234689,
+    1234945, 1235201, 1235457, 1235713, 1235969, 1236225, 1236481, 1236737, 1236993, 1237249, 1237505, 1237761,
+    1238017, 1238273, 1238529, 1238785, 1239041, 1239297, 1239553, 1239809, 1240065, 1240321, 1240577, 1240833,
+    1241089, 1241345, 1241601, 1241857, 1242113, 1242369, 1242625, 1242881, 1243137, 1243393, 1243649, 1243905,
+    1244161, 1244417, 1244673, 1244929, 1245185, 1245441, 1245697, 1245953, 1246209, 1246465, 1246721, 1246977,
+    1247233, 1247489, 1247745, 1248001, 1248257, 1248513, 1248769, 1249025, 1249281, 1249537, 1249793, 1250049,
+    1250305, 1250561, 1250817, 1251073, 1251329, 1251585, 1251841, 1252097, 1252353, 1252609, 1252865, 1253121,
+    1253377, 1253633, 1253889, 1254145, 1254401, 1254657, 1254913, 1255169, 1255425, 1255681, 1255937, 1256193,
+    1256449, 1256705, 1256961, 1257217, 1257473, 1257729, 1257985, 1258241, 1258497, 1258753, 1259009, 1259265,
+    1259521, 1259777, 1260033, 1260289, 1260545, 1260801, 1261057, 1261313, 1261569, 1261825, 1262081, 1262337,
+    1262593, 1262849, 1263105, 1263361, 1263617, 1263873, 1264129, 1264385, 1264641, 1264897, 1265153, 1265409,
+    1265665, 1265921, 1266177, 1266433, 1266689, 1266945, 1267201, 1267457, 1267713, 1267969, 1268225, 1268481,
+    1268737, 1268993, 1269249, 1269505, 1269761, 1270017, 1270273, 1270529, 1270785, 1271041, 1271297, 1271553,
+    1271809, 1272065, 1272321, 1272577, 1272833, 1273089, 1273345, 1273601, 1273857, 1274113, 1274369, 1274625,
+    1274881, 1275137, 1275393, 1275649, 1275905, 1276161, 1276417, 1276673, 1276929, 1277185, 1277441, 1277697,
+    1277953, 1278209, 1278465, 1278721, 1278977, 1279233, 1279489, 1279745, 1280001, 1280257, 1280513, 1280769,
+    1281025, 1281281, 1281537, 1281793, 1282049, 1282305, 1282561, 1282817, 1283073, 1283329, 1283585, 1283841,
+    1284097, 1284353, 1284609, 1284865, 1285121, 1285377, 1285633, 1285889, 1286145, 1286401, 1286657, 1286913,
+    1287169, 1287425, 1287681, 1287937, 1288193, 1288449, 1288705, 1288961, 1289217, 1289473, 1289729, 1289985,
+    1290241, 1290497, 1290753, 1291009, 1291265, 1291521, 1291777, 1292033, 1292289, 1292545, 1292801, 1293057,
+    1293313, 1293569, 1293825, 1294081, 1294337, 1294593, 1294849, 1295105, 1295361, 1295617, 1295873, 1296129,
+    1296385, 1296641, 1296897, 1297153, 1297409, 1297665, 1297921, 1298177, 1298433, 1298689, 1298945, 1299201,
+    1299457, 1299713, 1299969, 1300225, 1300481, 1300737, 1300993, 1301249, 1301505, 1301761, 1302017, 1302273,
+    1302529, 1302785, 1303041, 1303297, 1303553, 1303809, 1304065, 1304321, 1304577, 1304833, 1305089, 1305345,
+    1305601, 1305857, 1306113, 1306369, 1306625, 1306881, 1307137, 1307393, 1307649, 1307905, 1308161, 1308417,
+    1308673, 1308929, 1309185, 1309441, 1309697, 1309953, 1310209, 1310465, 1310721, 1310977, 1311233, 1311489,
+    1311745, 1312001, 1312257, 1312513, 1312769, 1313025, 1313281, 1313537, 1313793, 1314049, 1314305, 1314561,
+    1314817, 1315073, 1315329, 1315585, 1315841, 1316097, 1316353, 1316609, 1316865, 1317121, 1317377, 1317633,
+    1317889, 1318145, 1318401, 1318657, 1318913, 1319169, 1319425, 1319681, 1319937, 1320193, 1320449, 1320705,
+    1320961, 1321217, 1321473, 1321729, 1321985, 1322241, 1322497, 1322753, 1323009, 1323265, 1323521, 1323777,
+    1324033, 1324289, 1324545, 1324801, 1325057, 1325313, 1325569, 1325825, 1326081, 1326337, 1326593, 1326849,
+    1327105, 1327361, 1327617, 1327873, 1328129, 1328385, 1328641, 1328897, 1329153, 1329409, 1329665, 1329921,
+    1330177, 1330433, 1330689, 1330945, 1331201, 1331457, 1331713, 1331969, 1332225, 1332481, 1332737, 1332993,
+    1333249, 1333505, 1333761, 1334017, 1334273, 1334529, 1334785, 1335041, 1335297, 1335553, 1335809, 1336065,
+    1336321, 1336577, 1336833, 1337089, 1337345, 1337601, 1337857, 1338113, 1338369, 1338625, 1338881, 1339137,
+    1339393, 1339649, 1339905, 1340161, 1340417, 1340673, 1340929, 1341185, 1341441, 1341697, 1341953, 1342209,
+    1342465, 1342721, 1342977, 1343233, 1343489, 1343745, 1344001, 1344257, 1344513, 1344769, 1345025, 1345281,
+    1345537, 1345793, 1346049, 1346305, 1346561, 1346817, 1347073, 1347329, 1347585, 1347841, 1348097, 1348353,
+    1348609, 1348865, 1349121, 1349377, 1349633, 1349889, 1350145, 1350401, 1350657, 1350913, 1351169, 1351425,
+    1351681, 1351937, 1352193, 1352449, 1352705, 1352961, 1353217, 1353473, 1353729, 1353985, 1354241, 1354497,
+    1354753, 1355009, 1355265, 1355521, 1355777, 1356033, 1356289, 1356545, 1356801, 1357057, 1357313, 1357569,
+    1357825, 1358081, 1358337, 1358593, 1358849, 1359105, 1359361, 1359617, 1359873, 1360129, 1360385, 1360641,
+    1360897, 1361153, 1361409, 1361665, 1361921, 1362177, 1362433, 1362689, 1362945, 1363201, 1363457, 1363713,
+    1363969, 1364225, 1364481, 1364737, 1364993, 1365249, 1365505, 1365761, 1366017, 1366273, 1366529, 1366785,
+    1367041, 1367297, 1367553, 1367809, 1368065, 1368321, 1368577, 1368833, 1369089, 1369345, 1369601, 1369857,
+    1370113, 1370369, 1370625, 1370881, 1371137, 1371393, 1371649, 1371905, 1372161, 1372417, 1372673, 1372929,
+    1373185, 1373441, 1373697, 1373953, 1374209, 1374465, 1374721, 1374977, 1375233, 1375489, 1375745, 1376001,
+    1376257, 1376513, 1376769, 1377025, 1377281, 1377537, 1377793, 1378049, 1378305, 1378561, 1378817, 1379073,
+    1379329, 1379585, 1379841, 1380097, 1380353, 1380609, 1380865, 1381121, 1381377, 1381633, 1381889, 1382145,
+    1382401, 1382657, 1382913, 1383169, 1383425, 1383681, 1383937, 1384193, 1384449, 1384705, 1384961, 1385217,
+    1385473, 1385729, 1385985, 1386241, 1386497, 1386753, 1387009, 1387265, 1387521, 1387777, 1388033, 1388289,
+    1388545, 1388801, 1389057, 1389313, 1389570, 1390082, 1390594, 1391106, 1391618, 1392130, 1392642, 1393154,
+    1393666, 1394178, 1394690, 1395203, 1395971, 1396739, 1397507, 1398275, 1399043, 1399811, 1400579, 1401347,
+    1402115, 1402883, 1403651, 1404419, 1405187, 1405955, 1406723, 1407491, 1408259, 1409027, 1409795, 1410563,
+    1411331, 1412099, 1412867, 1413635, 1414403, 1415171, 1415937, 1416193, 1416450, 1416962, 1417473, 1417729,
+    1417985, 1418241, 1418497, 1418753, 1419009, 1419265, 1419521, 1419777, 1420033, 1420289, 1420545, 1420801,
+    1421057, 1421313, 1421569, 1421825, 1422081, 1422337, 1422593, 1422849, 1423105, 1423361, 1423617, 1423873,
+    1424130, 1424642, 1425154, 1425666, 1426179, 1426946, 1427458, 1427970, 1428482, 1428994, 1429506, 1430018,
+    1430529, 1430785, 1431041, 1431297, 1431554, 1432065, 1432321, 1432577, 1432833, 1433089, 1433345, 1433601,
+    1433857, 1434113, 1434369, 1434625, 1434881, 1435137, 1435393, 1435649, 1435905, 1436161, 1436417, 1436673,
+    1436929, 1437185, 1437441, 1437697, 1437953, 1438209, 1438465, 1438721, 1438977, 1439233, 1439489, 1439745,
+    1440001, 1440257, 1440513, 1440769, 1441025, 1441281, 1441537, 1441793, 1442049, 1442307, 1443075, 1443843,
+    1444611, 1445379, 1446147, 1446915, 1447683, 1448451, 1449217, 1449473, 1449729, 1449985, 1450241, 1450497,
+    1450753, 1451009, 1451265, 1451521, 1451777, 1452033,
+};
+static const uint32_t UNI_NFKD_POOL[] = {
+    32, 32, 776, 97, 32, 772, 50, 51, 32, 769, 956, 32,
+    807, 49, 111, 49, 8260, 52, 49, 8260, 50, 51, 8260, 52,
+    73, 74, 105, 106, 76, 183, 108, 183, 700, 110, 115, 68,
+    90, 780, 68, 122, 780, 100, 122, 780, 76, 74, 76, 106,
+    108, 106, 78, 74, 78, 106, 110, 106, 68, 90, 68, 122,
+    100, 122, 104, 614, 106, 114, 633, 635, 641, 119, 121, 32,
+    774, 32, 775, 32, 778, 32, 808, 32, 771, 32, 779, 611,
+    108, 115, 120, 661, 32, 837, 32, 769, 32, 776, 769, 946,
+    952, 933, 933, 769, 933, 776, 966, 960, 954, 961, 962, 920,
+    949, 931, 1381, 1410, 1575, 1652, 1608, 1652, 1735, 1652, 1610, 1652,
+    3661, 3634, 3789, 3762, 3755, 3737, 3755, 3745, 3851, 4018, 3953, 3968,
+    4019, 3953, 3968, 4316, 65, 198, 66, 68, 69, 398, 71, 72,
+    73, 74, 75, 76, 77, 78, 79, 546, 80, 82, 84, 85,
+    87, 97, 592, 593, 7426, 98, 100, 101, 601, 603, 604, 103,
+    107, 109, 331, 111, 596, 7446, 7447, 112, 116, 117, 7453, 623,
+    118, 7461, 946, 947, 948, 966, 967, 105, 114, 117, 118, 946,
+    947, 961, 966, 967, 1085, 594, 99, 597, 240, 604, 102, 607,
+    609, 613, 616, 617, 618, 7547, 669, 621, 7557, 671, 625, 624,
+    626, 627, 628, 629, 632, 642, 643, 427, 649, 650, 7452, 651,
+    652, 122, 656, 657, 658, 952, 97, 702, 115, 775, 32, 787,
+    32, 787, 32, 834, 32, 776, 834, 32, 787, 768, 32, 787,
+    769, 32, 787, 834, 32, 788, 768, 32, 788, 769, 32, 788,
+    834, 32, 776, 768, 32, 776, 769, 32, 769, 32, 788, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 8208, 32,
+    819, 46, 46, 46, 46, 46, 46, 32, 8242, 8242, 8242, 8242,
+    8242, 8245, 8245, 8245, 8245, 8245, 33, 33, 32, 773, 63, 63,
+    63, 33, 33, 63, 8242, 8242, 8242, 8242, 32, 48, 105, 52,
+    53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 110, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 43, 8722, 61,
+    40, 41, 97, 101, 111, 120, 601, 104, 107, 108, 109, 110,
+    112, 115, 116, 82, 115, 97, 47, 99, 97, 47, 115, 67,
+    176, 67, 99, 47, 111, 99, 47, 117, 400, 176, 70, 103,
+    72, 72, 72, 104, 295, 73, 73, 76, 108, 78, 78, 111,
+    80, 81, 82, 82, 82, 83, 77, 84, 69, 76, 84, 77,
+    90, 90, 66, 67, 101, 69, 70, 77, 111, 1488, 1489, 1490,
+    1491, 105, 70, 65, 88, 960, 947, 915, 928, 8721, 68, 100,
+    101, 105, 106, 49, 8260, 55, 49, 8260, 57, 49, 8260, 49,
+    48, 49, 8260, 51, 50, 8260, 51, 49, 8260, 53, 50, 8260,
+    53, 51, 8260, 53, 52, 8260, 53, 49, 8260, 54, 53, 8260,
+    54, 49, 8260, 56, 51, 8260, 56, 53, 8260, 56, 55, 8260,
+    56, 49, 8260, 73, 73, 73, 73, 73, 73, 73, 86, 86,
+    86, 73, 86, 73, 73, 86, 73, 73, 73, 73, 88, 88,
+    88, 73, 88, 73, 73, 76, 67, 68, 77, 105, 105, 105,
+    105, 105, 105, 105, 118, 118, 118, 105, 118, 105, 105, 118,
+    105, 105, 105, 105, 120, 120, 120, 105, 120, 105, 105, 108,
+    99, 100, 109, 48, 8260, 51, 8747, 8747, 8747, 8747, 8747, 8750,
+    8750, 8750, 8750, 8750, 49, 50, 51, 52, 53, 54, 55, 56,
+    57, 49, 48, 49, 49, 49, 50, 49, 51, 49, 52, 49,
+    53, 49, 54, 49, 55, 49, 56, 49, 57, 50, 48, 40,
+    49, 41, 40, 50, 41, 40, 51, 41, 40, 52, 41, 40,
+    53, 41, 40, 54, 41, 40, 55, 41, 40, 56, 41, 40,
+    57, 41, 40, 49, 48, 41, 40, 49, 49, 41, 40, 49,
+    50, 41, 40, 49, 51, 41, 40, 49, 52, 41, 40, 49,
+    53, 41, 40, 49, 54, 41, 40, 49, 55, 41, 40, 49,
+    56, 41, 40, 49, 57, 41, 40, 50, 48, 41, 49, 46,
+    50, 46, 51, 46, 52, 46, 53, 46, 54, 46, 55, 46,
+    56, 46, 57, 46, 49, 48, 46, 49, 49, 46, 49, 50,
+    46, 49, 51, 46, 49, 52, 46, 49, 53, 46, 49, 54,
+    46, 49, 55, 46, 49, 56, 46, 49, 57, 46, 50, 48,
+    46, 40, 97, 41, 40, 98, 41, 40, 99, 41, 40, 100,
+    41, 40, 101, 41, 40, 102, 41, 40, 103, 41, 40, 104,
+    41, 40, 105, 41, 40, 106, 41, 40, 107, 41, 40, 108,
+    41, 40, 109, 41, 40, 110, 41, 40, 111, 41, 40, 112,
+    41, 40, 113, 41, 40, 114, 41, 40, 115, 41, 40, 116,
+    41, 40, 117, 41, 40, 118, 41, 40, 119, 41, 40, 120,
+    41, 40, 121, 41, 40, 122, 41, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 48,
+    8747, 8747, 8747, 8747, 58, 58, 61, 61, 61, 61, 61, 61,
+    106, 86, 11617, 27597, 40863, 19968, 20008, 20022, 20031, 20057, 20101, 20108,
+    20128, 20154, 20799, 20837, 20843, 20866, 20886, 20907, 20960, 20981, 20992, 21147,
+    21241, 21269, 21274, 21304, 21313, 21340, 21353, 21378, 21430, 21448, 21475, 22231,
+    22303, 22763, 22786, 22794, 22805, 22823, 22899, 23376, 23424, 23544, 23567, 23586,
+    23608, 23662, 23665, 24027, 24037, 24049, 24062, 24178, 24186, 24191, 24308, 24318,
+    24331, 24339, 24400, 24417, 24435, 24515, 25096, 25142, 25163, 25903, 25908, 25991,
+    26007, 26020, 26041, 26080, 26085, 26352, 26376, 26408, 27424, 27490, 27513, 27571,
+    27595, 27604, 27611, 27663, 27668, 27700, 28779, 29226, 29238, 29243, 29247, 29255,
+    29273, 29275, 29356, 29572, 29577, 29916, 29926, 29976, 29983, 29992, 30000, 30091,
+    30098, 30326, 30333, 30382, 30399, 30446, 30683, 30690, 30707, 31034, 31160, 31166,
+    31348, 31435, 31481, 31859, 31992, 32566, 32593, 32650, 32701, 32769, 32780, 32786,
+    32819, 32895, 32905, 33251, 33258, 33267, 33276, 33292, 33307, 33311, 33390, 33394,
+    33400, 34381, 34411, 34880, 34892, 34915, 35198, 35211, 35282, 35328, 35895, 35910,
+    35925, 35960, 35997, 36196, 36208, 36275, 36523, 36554, 36763, 36784, 36789, 37009,
+    37193, 37318, 37324, 37329, 38263, 38272, 38428, 38582, 38585, 38632, 38737, 38750,
+    38754, 38761, 38859, 38893, 38899, 38913, 39080, 39131, 39135, 39318, 39321, 39340,
+    39592, 39640, 39647, 39717, 39727, 39730, 39740, 39770, 40165, 40565, 40575, 40613,
+    40635, 40643, 40653, 40657, 40697, 40701, 40718, 40723, 40736, 40763, 40778, 40786,
+    40845, 40860, 40864, 32, 12306, 21313, 21316, 21317, 32, 12441, 32, 12442,
+    12424, 12426, 12467, 12488, 4352, 4353, 4522, 4354, 4524, 4525, 4355, 4356,
+    4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360, 4385,
+    4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449, 4450,
+    4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462,
+    4463, 4464, 4465, 4466, 4467, 4468, 4469, 4448, 4372, 4373, 4551, 4552,
+    4556, 4558, 4563, 4567, 4569, 4380, 4573, 4575, 4381, 4382, 4384, 4386,
+    4387, 4391, 4393, 4395, 4396, 4397, 4398, 4399, 4402, 4406, 4416, 4423,
+    4428, 4593, 4594, 4439, 4440, 4441, 4484, 4485, 4488, 4497, 4498, 4500,
+    4510, 4513, 19968, 20108, 19977, 22235, 19978, 20013, 19979, 30002, 20057, 19993,
+    19969, 22825, 22320, 20154, 40, 4352, 41, 40, 4354, 41, 40, 4355,
+    41, 40, 4357, 41, 40, 4358, 41, 40, 4359, 41, 40, 4361,
+    41, 40, 4363, 41, 40, 4364, 41, 40, 4366, 41, 40, 4367,
+    41, 40, 4368, 41, 40, 4369, 41, 40, 4370, 41, 40, 4352,
+    4449, 41, 40, 4354, 4449, 41, 40, 4355, 4449, 41, 40, 4357,
+    4449, 41, 40, 4358, 4449, 41, 40, 4359, 4449, 41, 40, 4361,
+    4449, 41, 40, 4363, 4449, 41, 40, 4364, 4449, 41, 40, 4366,
+    4449, 41, 40, 4367, 4449, 41, 40, 4368, 4449, 41, 40, 4369,
+    4449, 41, 40, 4370, 4449, 41, 40, 4364, 4462, 41, 40, 4363,
+    4457, 4364, 4453, 4523, 41, 40, 4363, 4457, 4370, 4462, 41, 40,
+    19968, 41, 40, 20108, 41, 40, 19977, 41, 40, 22235, 41, 40,
+    20116, 41, 40, 20845, 41, 40, 19971, 41, 40, 20843, 41, 40,
+    20061, 41, 40, 21313, 41, 40, 26376, 41, 40, 28779, 41, 40,
+    27700, 41, 40, 26408, 41, 40, 37329, 41, 40, 22303, 41, 40,
+    26085, 41, 40, 26666, 41, 40, 26377, 41, 40, 31038, 41, 40,
+    21517, 41, 40, 29305, 41, 40, 36001, 41, 40, 31069, 41, 40,
+    21172, 41, 40, 20195, 41, 40, 21628, 41, 40, 23398, 41, 40,
+    30435, 41, 40, 20225, 41, 40, 36039, 41, 40, 21332, 41, 40,
+    31085, 41, 40, 20241, 41, 40, 33258, 41, 40, 33267, 41, 21839,
+    24188, 25991, 31631, 80, 84, 69, 50, 49, 50, 50, 50, 51,
+    50, 52, 50, 53, 50, 54, 50, 55, 50, 56, 50, 57,
+    51, 48, 51, 49, 51, 50, 51, 51, 51, 52, 51, 53,
+    4352, 4354, 4355, 4357, 4358, 4359, 4361, 4363, 4364, 4366, 4367, 4368,
+    4369, 4370, 4352, 4449, 4354, 4449, 4355, 4449, 4357, 4449, 4358, 4449,
+    4359, 4449, 4361, 4449, 4363, 4449, 4364, 4449, 4366, 4449, 4367, 4449,
+    4368, 4449, 4369, 4449, 4370, 4449, 4366, 4449, 4535, 4352, 4457, 4364,
+    4462, 4363, 4468, 4363, 4462, 19968, 20108, 19977, 22235, 20116, 20845, 19971,
+    20843, 20061, 21313, 26376, 28779, 27700, 26408, 37329, 22303, 26085, 26666, 26377,
+    31038, 21517, 29305, 36001, 31069, 21172, 31192, 30007, 22899, 36969, 20778, 21360,
+    27880, 38917, 20241, 20889, 27491, 19978, 20013, 19979, 24038, 21491, 21307, 23447,
+    23398, 30435, 20225, 36039, 21332, 22812, 51, 54, 51, 55, 51, 56,
+    51, 57, 52, 48, 52, 49, 52, 50, 52, 51, 52, 52,
+    52, 53, 52, 54, 52, 55, 52, 56, 52, 57, 53, 48,
+    49, 26376, 50, 26376, 51, 26376, 52, 26376, 53, 26376, 54, 26376,
+    55, 26376, 56, 26376, 57, 26376, 49, 48, 26376, 49, 49, 26376,
+    49, 50, 26376, 72, 103, 101, 114, 103, 101, 86, 76, 84,
+    68, 12450, 12452, 12454, 12456, 12458, 12459, 12461, 12463, 12465, 12467, 12469,
+    12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488, 12490, 12491, 12492,
+    12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510, 12511, 12512, 12513, 12514,
+    12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12528, 12529, 12530,
+    20196, 21644, 12450, 12495, 12442, 12540, 12488, 12450, 12523, 12501, 12449, 12450,
+    12531, 12504, 12442, 12450, 12450, 12540, 12523, 12452, 12491, 12531, 12463, 12441,
+    12452, 12531, 12481, 12454, 12457, 12531, 12456, 12473, 12463, 12540, 12488, 12441,
+    12456, 12540, 12459, 12540, 12458, 12531, 12473, 12458, 12540, 12512, 12459, 12452,
+    12522, 12459, 12521, 12483, 12488, 12459, 12525, 12522, 12540, 12459, 12441, 12525,
+    12531, 12459, 12441, 12531, 12510, 12461, 12441, 12459, 12441, 12461, 12441, 12491,
+    12540, 12461, 12517, 12522, 12540, 12461, 12441, 12523, 12479, 12441, 12540, 12461,
+    12525, 12461, 12525, 12463, 12441, 12521, 12512, 12461, 12525, 12513, 12540, 12488,
+    12523, 12461, 12525, 12527, 12483, 12488, 12463, 12441, 12521, 12512, 12463, 12441,
+    12521, 12512, 12488, 12531, 12463, 12523, 12475, 12441, 12452, 12525, 12463, 12525,
+    12540, 12493, 12465, 12540, 12473, 12467, 12523, 12490, 12467, 12540, 12507, 12442,
+    12469, 12452, 12463, 12523, 12469, 12531, 12481, 12540, 12512, 12471, 12522, 12531,
+    12463, 12441, 12475, 12531, 12481, 12475, 12531, 12488, 12479, 12441, 12540, 12473,
+    12486, 12441, 12471, 12488, 12441, 12523, 12488, 12531, 12490, 12494, 12494, 12483,
+    12488, 12495, 12452, 12484, 12495, 12442, 12540, 12475, 12531, 12488, 12495, 12442,
+    12540, 12484, 12495, 12441, 12540, 12524, 12523, 12498, 12442, 12450, 12473, 12488,
+    12523, 12498, 12442, 12463, 12523, 12498, 12442, 12467, 12498, 12441, 12523, 12501,
+    12449, 12521, 12483, 12488, 12441, 12501, 12451, 12540, 12488, 12501, 12441, 12483,
+    12471, 12455, 12523, 12501, 12521, 12531, 12504, 12463, 12479, 12540, 12523, 12504,
+    12442, 12477, 12504, 12442, 12491, 12498, 12504, 12523, 12484, 12504, 12442, 12531,
+    12473, 12504, 12442, 12540, 12471, 12441, 12504, 12441, 12540, 12479, 12507, 12442,
+    12452, 12531, 12488, 12507, 12441, 12523, 12488, 12507, 12531, 12507, 12442, 12531,
+    12488, 12441, 12507, 12540, 12523, 12507, 12540, 12531, 12510, 12452, 12463, 12525,
+    12510, 12452, 12523, 12510, 12483, 12495, 12510, 12523, 12463, 12510, 12531, 12471,
+    12519, 12531, 12511, 12463, 12525, 12531, 12511, 12522, 12511, 12522, 12495, 12441,
+    12540, 12523, 12513, 12459, 12441, 12513, 12459, 12441, 12488, 12531, 12513, 12540,
+    12488, 12523, 12516, 12540, 12488, 12441, 12516, 12540, 12523, 12518, 12450, 12531,
+    12522, 12483, 12488, 12523, 12522, 12521, 12523, 12498, 12442, 12540, 12523, 12540,
+    12501, 12441, 12523, 12524, 12512, 12524, 12531, 12488, 12465, 12441, 12531, 12527,
+    12483, 12488, 48, 28857, 49, 28857, 50, 28857, 51, 28857, 52, 28857,
+    53, 28857, 54, 28857, 55, 28857, 56, 28857, 57, 28857, 49, 48,
+    28857, 49, 49, 28857, 49, 50, 28857, 49, 51, 28857, 49, 52,
+    28857, 49, 53, 28857, 49, 54, 28857, 49, 55, 28857, 49, 56,
+    28857, 49, 57, 28857, 50, 48, 28857, 50, 49, 28857, 50, 50,
+    28857, 50, 51, 28857, 50, 52, 28857, 104, 80, 97, 100, 97,
+    65, 85, 98, 97, 114, 111, 86, 112, 99, 100, 109, 100,
+    109, 50, 100, 109, 51, 73, 85, 24179, 25104, 26157, 21644, 22823,
+    27491, 26126, 27835, 26666, 24335, 20250, 31038, 112, 65, 110, 65, 956,
+    65, 109, 65, 107, 65, 75, 66, 77, 66, 71, 66, 99,
+    97, 108, 107, 99, 97, 108, 112, 70, 110, 70, 956, 70,
+    956, 103, 109, 103, 107, 103, 72, 122, 107, 72, 122, 77,
+    72, 122, 71, 72, 122, 84, 72, 122, 956, 108, 109, 108,
+    100, 108, 107, 108, 102, 109, 110, 109, 956, 109, 109, 109,
+    99, 109, 107, 109, 109, 109, 50, 99, 109, 50, 109, 50,
+    107, 109, 50, 109, 109, 51, 99, 109, 51, 109, 51, 107,
+    109, 51, 109, 8725, 115, 109, 8725, 115, 50, 80, 97, 107,
+    80, 97, 77, 80, 97, 71, 80, 97, 114, 97, 100, 114,
+    97, 100, 8725, 115, 114, 97, 100, 8725, 115, 50, 112, 115,
+    110, 115, 956, 115, 109, 115, 112, 86, 110, 86, 956, 86,
+    109, 86, 107, 86, 77, 86, 112, 87, 110, 87, 956, 87,
+    109, 87, 107, 87, 77, 87, 107, 937, 77, 937, 97, 46,
+    109, 46, 66, 113, 99, 99, 99, 100, 67, 8725, 107, 103,
+    67, 111, 46, 100, 66, 71, 121, 104, 97, 72, 80, 105,
+    110, 75, 75, 75, 77, 107, 116, 108, 109, 108, 110, 108,
+    111, 103, 108, 120, 109, 98, 109, 105, 108, 109, 111, 108,
+    80, 72, 112, 46, 109, 46, 80, 80, 77, 80, 82, 115,
+    114, 83, 118, 87, 98, 86, 8725, 109, 65, 8725, 109, 49,
+    26085, 50, 26085, 51, 26085, 52, 26085, 53, 26085, 54, 26085, 55,
+    26085, 56, 26085, 57, 26085, 49, 48, 26085, 49, 49, 26085, 49,
+    50, 26085, 49, 51, 26085, 49, 52, 26085, 49, 53, 26085, 49,
+    54, 26085, 49, 55, 26085, 49, 56, 26085, 49, 57, 26085, 50,
+    48, 26085, 50, 49, 26085, 50, 50, 26085, 50, 51, 26085, 50,
+    52, 26085, 50, 53, 26085, 50, 54, 26085, 50, 55, 26085, 50,
+    56, 26085, 50, 57, 26085, 51, 48, 26085, 51, 49, 26085, 103,
+    97, 108, 1098, 1100, 42863, 67, 70, 81, 294, 339, 42791, 43831,
+    619, 43858, 653, 102, 102, 102, 105, 102, 108, 102, 102, 105,
+    102, 102, 108, 115, 116, 115, 116, 1396, 1398, 1396, 1381, 1396,
+    1387, 1406, 1398, 1396, 1389, 1506, 1488, 1491, 1492, 1499, 1500, 1501,
+    1512, 1514, 43, 1488, 1500, 1649, 1649, 1659, 1659, 1659, 1659, 1662,
+    1662, 1662, 1662, 1664, 1664, 1664, 1664, 1658, 1658, 1658, 1658, 1663,
+    1663, 1663, 1663, 1657, 1657, 1657, 1657, 1700, 1700, 1700, 1700, 1702,
+    1702, 1702, 1702, 1668, 1668, 1668, 1668, 1667, 1667, 1667, 1667, 1670,
+    1670, 1670, 1670, 1671, 1671, 1671, 1671, 1677, 1677, 1676, 1676, 1678,
+    1678, 1672, 1672, 1688, 1688, 1681, 1681, 1705, 1705, 1705, 1705, 1711,
+    1711, 1711, 1711, 1715, 1715, 1715, 1715, 1713, 1713, 1713, 1713, 1722,
+    1722, 1723, 1723, 1723, 1723, 1749, 1620, 1749, 1620, 1729, 1729, 1729,
+    1729, 1726, 1726, 1726, 1726, 1746, 1746, 1746, 1620, 1746, 1620, 1709,
+    1709, 1709, 1709, 1735, 1735, 1734, 1734, 1736, 1736, 1735, 1652, 1739,
+    1739, 1733, 1733, 1737, 1737, 1744, 1744, 1744, 1744, 1609, 1609, 1610,
+    1620, 1575, 1610, 1620, 1575, 1610, 1620, 1749, 1610, 1620, 1749, 1610,
+    1620, 1608, 1610, 1620, 1608, 1610, 1620, 1735, 1610, 1620, 1735, 1610,
+    1620, 1734, 1610, 1620, 1734, 1610, 1620, 1736, 1610, 1620, 1736, 1610,
+    1620, 1744, 1610, 1620, 1744, 1610, 1620, 1744, 1610, 1620, 1609, 1610,
+    1620, 1609, 1610, 1620, 1609, 1740, 1740, 1740, 1740, 1610, 1620, 1580,
+    1610, 1620, 1581, 1610, 1620, 1605, 1610, 1620, 1609, 1610, 1620, 1610,
+    1576, 1580, 1576, 1581, 1576, 1582, 1576, 1605, 1576, 1609, 1576, 1610,
+    1578, 1580, 1578, 1581, 1578, 1582, 1578, 1605, 1578, 1609, 1578, 1610,
+    1579, 1580, 1579, 1605, 1579, 1609, 1579, 1610, 1580, 1581, 1580, 1605,
+    1581, 1580, 1581, 1605, 1582, 1580, 1582, 1581, 1582, 1605, 1587, 1580,
+    1587, 1581, 1587, 1582, 1587, 1605, 1589, 1581, 1589, 1605, 1590, 1580,
+    1590, 1581, 1590, 1582, 1590, 1605, 1591, 1581, 1591, 1605, 1592, 1605,
+    1593, 1580, 1593, 1605, 1594, 1580, 1594, 1605, 1601, 1580, 1601, 1581,
+    1601, 1582, 1601, 1605, 1601, 1609, 1601, 1610, 1602, 1581, 1602, 1605,
+    1602, 1609, 1602, 1610, 1603, 1575, 1603, 1580, 1603, 1581, 1603, 1582,
+    1603, 1604, 1603, 1605, 1603, 1609, 1603, 1610, 1604, 1580, 1604, 1581,
+    1604, 1582, 1604, 1605, 1604, 1609, 1604, 1610, 1605, 1580, 1605, 1581,
+    1605, 1582, 1605, 1605, 1605, 1609, 1605, 1610, 1606, 1580, 1606, 1581,
+    1606, 1582, 1606, 1605, 1606, 1609, 1606, 1610, 1607, 1580, 1607, 1605,
+    1607, 1609, 1607, 1610, 1610, 1580, 1610, 1581, 1610, 1582, 1610, 1605,
+    1610, 1609, 1610, 1610, 1584, 1648, 1585, 1648, 1609, 1648, 32, 1612,
+    1617, 32, 1613, 1617, 32, 1614, 1617, 32, 1615, 1617, 32, 1616,
+    1617, 32, 1617, 1648, 1610, 1620, 1585, 1610, 1620, 1586, 1610, 1620,
+    1605, 1610, 1620, 1606, 1610, 1620, 1609, 1610, 1620, 1610, 1576, 1585,
+    1576, 1586, 1576, 1605, 1576, 1606, 1576, 1609, 1576, 1610, 1578, 1585,
+    1578, 1586, 1578, 1605, 1578, 1606, 1578, 1609, 1578, 1610, 1579, 1585,
+    1579, 1586, 1579, 1605, 1579, 1606, 1579, 1609, 1579, 1610, 1601, 1609,
+    1601, 1610, 1602, 1609, 1602, 1610, 1603, 1575, 1603, 1604, 1603, 1605,
+    1603, 1609, 1603, 1610, 1604, 1605, 1604, 1609, 1604, 1610, 1605, 1575,
+    1605, 1605, 1606, 1585, 1606, 1586, 1606, 1605, 1606, 1606, 1606, 1609,
+    1606, 1610, 1609, 1648, 1610, 1585, 1610, 1586, 1610, 1605, 1610, 1606,
+    1610, 1609, 1610, 1610, 1610, 1620, 1580, 1610, 1620, 1581, 1610, 1620,
+    1582, 1610, 1620, 1605, 1610, 1620, 1607, 1576, 1580, 1576, 1581, 1576,
+    1582, 1576, 1605, 1576, 1607, 1578, 1580, 1578, 1581, 1578, 1582, 1578,
+    1605, 1578, 1607, 1579, 1605, 1580, 1581, 1580, 1605, 1581, 1580, 1581,
+    1605, 1582, 1580, 1582, 1605, 1587, 1580, 1587, 1581, 1587, 1582, 1587,
+    1605, 1589, 1581, 1589, 1582, 1589, 1605, 1590, 1580, 1590, 1581, 1590,
+    1582, 1590, 1605, 1591, 1581, 1592, 1605, 1593, 1580, 1593, 1605, 1594,
+    1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582, 1601, 1605, 1602,
+    1581, 1602, 1605, 1603, 1580, 1603, 1581, 1603, 1582, 1603, 1604, 1603,
+    1605, 1604, 1580, 1604, 1581, 1604, 1582, 1604, 1605, 1604, 1607, 1605,
+    1580, 1605, 1581, 1605, 1582, 1605, 1605, 1606, 1580, 1606, 1581, 1606,
+    1582, 1606, 1605, 1606, 1607, 1607, 1580, 1607, 1605, 1607, 1648, 1610,
+    1580, 1610, 1581, 1610, 1582, 1610, 1605, 1610, 1607, 1610, 1620, 1605,
+    1610, 1620, 1607, 1576, 1605, 1576, 1607, 1578, 1605, 1578, 1607, 1579,
+    1605, 1579, 1607, 1587, 1605, 1587, 1607, 1588, 1605, 1588, 1607, 1603,
+    1604, 1603, 1605, 1604, 1605, 1606, 1605, 1606, 1607, 1610, 1605, 1610,
+    1607, 1600, 1614, 1617, 1600, 1615, 1617, 1600, 1616, 1617, 1591, 1609,
+    1591, 1610, 1593, 1609, 1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609,
+    1587, 1610, 1588, 1609, 1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609,
+    1580, 1610, 1582, 1609, 1582, 1610, 1589, 1609, 1589, 1610, 1590, 1609,
+    1590, 1610, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1605, 1588, 1585,
+    1587, 1585, 1589, 1585, 1590, 1585, 1591, 1609, 1591, 1610, 1593, 1609,
+    1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610, 1588, 1609,
+    1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609, 1580, 1610, 1582, 1609,
+    1582, 1610, 1589, 1609, 1589, 1610, 1590, 1609, 1590, 1610, 1588, 1580,
+    1588, 1581, 1588, 1582, 1588, 1605, 1588, 1585, 1587, 1585, 1589, 1585,
+    1590, 1585, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1605, 1587, 1607,
+    1588, 1607, 1591, 1605, 1587, 1580, 1587, 1581, 1587, 1582, 1588, 1580,
+    1588, 1581, 1588, 1582, 1591, 1605, 1592, 1605, 1575, 1611, 1575, 1611,
+    1578, 1580, 1605, 1578, 1581, 1580, 1578, 1581, 1580, 1578, 1581, 1605,
+    1578, 1582, 1605, 1578, 1605, 1580, 1578, 1605, 1581, 1578, 1605, 1582,
+    1580, 1605, 1581, 1580, 1605, 1581, 1581, 1605, 1610, 1581, 1605, 1609,
+    1587, 1581, 1580, 1587, 1580, 1581, 1587, 1580, 1609, 1587, 1605, 1581,
+    1587, 1605, 1581, 1587, 1605, 1580, 1587, 1605, 1605, 1587, 1605, 1605,
+    1589, 1581, 1581, 1589, 1581, 1581, 1589, 1605, 1605, 1588, 1581, 1605,
+    1588, 1581, 1605, 1588, 1580, 1610, 1588, 1605, 1582, 1588, 1605, 1582,
+    1588, 1605, 1605, 1588, 1605, 1605, 1590, 1581, 1609, 1590, 1582, 1605,
+    1590, 1582, 1605, 1591, 1605, 1581, 1591, 1605, 1581, 1591, 1605, 1605,
+    1591, 1605, 1610, 1593, 1580, 1605, 1593, 1605, 1605, 1593, 1605, 1605,
+    1593, 1605, 1609, 1594, 1605, 1605, 1594, 1605, 1610, 1594, 1605, 1609,
+    1601, 1582, 1605, 1601, 1582, 1605, 1602, 1605, 1581, 1602, 1605, 1605,
+    1604, 1581, 1605, 1604, 1581, 1610, 1604, 1581, 1609, 1604, 1580, 1580,
+    1604, 1580, 1580, 1604, 1582, 1605, 1604, 1582, 1605, 1604, 1605, 1581,
+    1604, 1605, 1581, 1605, 1581, 1580, 1605, 1581, 1605, 1605, 1581, 1610,
+    1605, 1580, 1581, 1605, 1580, 1605, 1605, 1582, 1580, 1605, 1582, 1605,
+    1605, 1580, 1582, 1607, 1605, 1580, 1607, 1605, 1605, 1606, 1581, 1605,
+    1606, 1581, 1609, 1606, 1580, 1605, 1606, 1580, 1605, 1606, 1580, 1609,
+    1606, 1605, 1610, 1606, 1605, 1609, 1610, 1605, 1605, 1610, 1605, 1605,
+    1576, 1582, 1610, 1578, 1580, 1610, 1578, 1580, 1609, 1578, 1582, 1610,
+    1578, 1582, 1609, 1578, 1605, 1610, 1578, 1605, 1609, 1580, 1605, 1610,
+    1580, 1581, 1609, 1580, 1605, 1609, 1587, 1582, 1609, 1589, 1581, 1610,
+    1588, 1581, 1610, 1590, 1581, 1610, 1604, 1580, 1610, 1604, 1605, 1610,
+    1610, 1581, 1610, 1610, 1580, 1610, 1610, 1605, 1610, 1605, 1605, 1610,
+    1602, 1605, 1610, 1606, 1581, 1610, 1602, 1605, 1581, 1604, 1581, 1605,
+    1593, 1605, 1610, 1603, 1605, 1610, 1606, 1580, 1581, 1605, 1582, 1610,
+    1604, 1580, 1605, 1603, 1605, 1605, 1604, 1580, 1605, 1606, 1580, 1581,
+    1580, 1581, 1610, 1581, 1580, 1610, 1605, 1580, 1610, 1601, 1605, 1610,
+    1576, 1581, 1610, 1603, 1605, 1605, 1593, 1580, 1605, 1589, 1605, 1605,
+    1587, 1582, 1610, 1606, 1580, 1610, 1589, 1604, 1746, 1602, 1604, 1746,
+    1575, 1604, 1604, 1607, 1575, 1603, 1576, 1585, 1605, 1581, 1605, 1583,
+    1589, 1604, 1593, 1605, 1585, 1587, 1608, 1604, 1593, 1604, 1610, 1607,
+    1608, 1587, 1604, 1605, 1589, 1604, 1609, 1589, 1604, 1609, 32, 1575,
+    1604, 1604, 1607, 32, 1593, 1604, 1610, 1607, 32, 1608, 1587, 1604,
+    1605, 1580, 1604, 32, 1580, 1604, 1575, 1604, 1607, 1585, 1740, 1575,
+    1604, 44, 12289, 12290, 58, 59, 33, 63, 12310, 12311, 46, 46,
+    46, 46, 46, 8212, 8211, 95, 95, 40, 41, 123, 125, 12308,
+    12309, 12304, 12305, 12298, 12299, 12296, 12297, 12300, 12301, 12302, 12303, 91,
+    93, 32, 773, 32, 773, 32, 773, 32, 773, 95, 95, 95,
+    44, 12289, 46, 59, 58, 63, 33, 8212, 40, 41, 123, 125,
+    12308, 12309, 35, 38, 42, 43, 45, 60, 62, 61, 92, 36,
+    37, 64, 32, 1611, 1600, 1611, 32, 1612, 32, 1613, 32, 1614,
+    1600, 1614, 32, 1615, 1600, 1615, 32, 1616, 1600, 1616, 32, 1617,
+    1600, 1617, 32, 1618, 1600, 1618, 1569, 1575, 1619, 1575, 1619, 1575,
+    1620, 1575, 1620, 1608, 1620, 1608, 1620, 1575, 1621, 1575, 1621, 1610,
+    1620, 1610, 1620, 1610, 1620, 1610, 1620, 1575, 1575, 1576, 1576, 1576,
+    1576, 1577, 1577, 1578, 1578, 1578, 1578, 1579, 1579, 1579, 1579, 1580,
+    1580, 1580, 1580, 1581, 1581, 1581, 1581, 1582, 1582, 1582, 1582, 1583,
+    1583, 1584, 1584, 1585, 1585, 1586, 1586, 1587, 1587, 1587, 1587, 1588,
+    1588, 1588, 1588, 1589, 1589, 1589, 1589, 1590, 1590, 1590, 1590, 1591,
+    1591, 1591, 1591, 1592, 1592, 1592, 1592, 1593, 1593, 1593, 1593, 1594,
+    1594, 1594, 1594, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1603,
+    1603, 1603, 1603, 1604, 1604, 1604, 1604, 1605, 1605, 1605, 1605, 1606,
+    1606, 1606, 1606, 1607, 1607, 1607, 1607, 1608, 1608, 1609, 1609, 1610,
+    1610, 1610, 1610, 1604, 1575, 1619, 1604, 1575, 1619, 1604, 1575, 1620,
+    1604, 1575, 1620, 1604, 1575, 1621, 1604, 1575, 1621, 1604, 1575, 1604,
+    1575, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+    92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 10629,
+    10630, 12290, 12300, 12301, 12289, 12539, 12530, 12449, 12451, 12453, 12455, 12457,
+    12515, 12517, 12519, 12483, 12540, 12450, 12452, 12454, 12456, 12458, 12459, 12461,
+    12463, 12465, 12467, 12469, 12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486,
+    12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510,
+    12511, 12512, 12513, 12514, 12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525,
+    12527, 12531, 12441, 12442, 4448, 4352, 4353, 4522, 4354, 4524, 4525, 4355,
+    4356, 4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360,
+    4385, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449,
+    4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461,
+    4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 162, 163, 172, 32,
+    772, 166, 165, 8361, 9474, 8592, 8593, 8594, 8595, 9632, 9675, 720,
+    721, 230, 665, 595, 675, 43878, 677, 676, 598, 599, 7569, 600,
+    606, 681, 612, 610, 608, 667, 295, 668, 615, 644, 682, 683,
+    620, 122628, 42894, 622, 122629, 654, 122630, 248, 630, 631, 113, 634,
+    122632, 637, 638, 640, 680, 678, 43879, 679, 648, 11377, 655, 673,
+    674, 664, 448, 449, 450, 122634, 122654, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+    90, 97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74,
+    75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+    87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 65, 67, 68, 71, 74, 75,
+    78, 79, 80, 81, 83, 84, 85, 86, 87, 88, 89, 90,
+    97, 98, 99, 100, 102, 104, 105, 106, 107, 108, 109, 110,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+    90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 65, 66, 68, 69, 70, 71, 74, 75, 76,
+    77, 78, 79, 80, 81, 83, 84, 85, 86, 87, 88, 89,
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 65, 66, 68, 69, 70, 71, 73, 74, 75, 76,
+    77, 79, 83, 84, 85, 86, 87, 88, 89, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+    90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+    90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 305,
+    567, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923,
+    924, 925, 926, 927, 928, 929, 920, 931, 932, 933, 934, 935,
+    936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953,
+    954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965,
+    966, 967, 968, 969, 8706, 949, 952, 954, 966, 961, 960, 913,
+    914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925,
+    926, 927, 928, 929, 920, 931, 932, 933, 934, 935, 936, 937,
+    8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955,
+    956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967,
+    968, 969, 8706, 949, 952, 954, 966, 961, 960, 913, 914, 915,
+    916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 920, 931, 932, 933, 934, 935, 936, 937, 8711, 945,
+    946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957,
+    958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969,
+    8706, 949, 952, 954, 966, 961, 960, 913, 914, 915, 916, 917,
+    918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929,
+    920, 931, 932, 933, 934, 935, 936, 937, 8711, 945, 946, 947,
+    948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959,
+    960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949,
+    952, 954, 966, 961, 960, 913, 914, 915, 916, 917, 918, 919,
+    920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931,
+    932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949,
+    950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961,
+    962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954,
+    966, 961, 960, 988, 989, 48, 49, 50, 51, 52, 53, 54,
+    55, 56, 57, 48, 49, 50, 51, 52, 53, 54, 55, 56,
+    57, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 1575, 1576, 1580, 1583, 1608,
+    1586, 1581, 1591, 1610, 1603, 1604, 1605, 1606, 1587, 1593, 1601, 1589,
+    1602, 1585, 1588, 1578, 1579, 1582, 1584, 1590, 1592, 1594, 1646, 1722,
+    1697, 1647, 1576, 1580, 1607, 1581, 1610, 1603, 1604, 1605, 1606, 1587,
+    1593, 1601, 1589, 1602, 1588, 1578, 1579, 1582, 1590, 1594, 1580, 1581,
+    1610, 1604, 1606, 1587, 1593, 1589, 1602, 1588, 1582, 1590, 1594, 1722,
+    1647, 1576, 1580, 1607, 1581, 1591, 1610, 1603, 1605, 1606, 1587, 1593,
+    1601, 1589, 1602, 1588, 1578, 1579, 1582, 1590, 1592, 1594, 1646, 1697,
+    1575, 1576, 1580, 1583, 1607, 1608, 1586, 1581, 1591, 1610, 1604, 1605,
+    1606, 1587, 1593, 1601, 1589, 1602, 1585, 1588, 1578, 1579, 1582, 1584,
+    1590, 1592, 1594, 1576, 1580, 1583, 1608, 1586, 1581, 1591, 1610, 1604,
+    1605, 1606, 1587, 1593, 1601, 1589, 1602, 1585, 1588, 1578, 1579, 1582,
+    1584, 1590, 1592, 1594, 48, 46, 48, 44, 49, 44, 50, 44,
+    51, 44, 52, 44, 53, 44, 54, 44, 55, 44, 56, 44,
+    57, 44, 40, 65, 41, 40, 66, 41, 40, 67, 41, 40,
+    68, 41, 40, 69, 41, 40, 70, 41, 40, 71, 41, 40,
+    72, 41, 40, 73, 41, 40, 74, 41, 40, 75, 41, 40,
+    76, 41, 40, 77, 41, 40, 78, 41, 40, 79, 41, 40,
+    80, 41, 40, 81, 41, 40, 82, 41, 40, 83, 41, 40,
+    84, 41, 40, 85, 41, 40, 86, 41, 40, 87, 41, 40,
+    88, 41, 40, 89, 41, 40, 90, 41, 12308, 83, 12309, 67,
+    82, 67, 68, 87, 90, 65, 66, 67, 68, 69, 70, 71,
+    72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 72, 86, 77, 86, 83,
+    68, 83, 83, 80, 80, 86, 87, 67, 77, 67, 77, 68,
+    77, 82, 68, 74, 12411, 12363, 12467, 12467, 12469, 25163, 23383, 21452,
+    12486, 12441, 20108, 22810, 35299, 22825, 20132, 26144, 28961, 26009, 21069, 24460,
+    20877, 26032, 21021, 32066, 29983, 36009, 22768, 21561, 28436, 25237, 25429, 19968,
+    19977, 36938, 24038, 20013, 21491, 25351, 36208, 25171, 31105, 31354, 21512, 28288,
+    26377, 26376, 30003, 21106, 21942, 37197, 12308, 26412, 12309, 12308, 19977, 12309,
+    12308, 20108, 12309, 12308, 23433, 12309, 12308, 28857, 12309, 12308, 25171, 12309,
+    12308, 30423, 12309, 12308, 21213, 12309, 12308, 25943, 12309, 24471, 21487, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+
+// Primary composites, keyed by (first << 21 | second)
+static const size_t UNI_COMPOSE_SIZE = 941;
+static const uint64_t UNI_COMPOSE_KEYS[] = {
+    125829944, 127927096, 130024248, 136315648, 136315649, 136315650, 136315651, 136315652, 136315654, 136315655, 136315656, 136315657,
+    136315658, 136315660, 136315663, 136315665, 136315683, 136315685, 136315688, 138412807, 138412835, 138412849, 140509953, 140509954,
+    140509959, 140509964, 140509991, 142607111, 142607116, 142607139, 142607143, 142607149, 142607153, 144704256, 144704257, 144704258,
+    144704259, 144704260, 144704262, 144704263, 144704264, 144704265, 144704268, 144704271, 144704273, 144704291, 144704295, 144704296,
+    144704301, 144704304, 146801415, 148898561, 148898562, 148898564, 148898566, 148898567, 148898572, 148898599, 150995714, 150995719,
+    150995720, 150995724, 150995747, 150995751, 150995758, 153092864, 153092865, 153092866, 153092867, 153092868, 153092870, 153092871,
+    153092872, 153092873, 153092876, 153092879, 153092881, 153092899, 153092904, 153092912, 155190018, 157287169, 157287180, 157287203,
+    157287207, 157287217, 159384321, 159384332, 159384355, 159384359, 159384365, 159384369, 161481473, 161481479, 161481507, 163578624,
+    163578625, 163578627, 163578631, 163578636, 163578659, 163578663, 163578669, 163578673, 165675776, 165675777, 165675778, 165675779,
+    165675780, 165675782, 165675783, 165675784, 165675785, 165675787, 165675788, 165675791, 165675793, 165675803, 165675811, 165675816,
+    167772929, 167772935, 171967233, 171967239, 171967244, 171967247, 171967249, 171967267, 171967271, 171967281, 174064385, 174064386,
+    174064391, 174064396, 174064419, 174064422, 174064423, 176161543, 176161548, 176161571, 176161574, 176161575, 176161581, 176161585,
+    178258688, 178258689, 178258690, 178258691, 178258692, 178258694, 178258696, 178258697, 178258698, 178258699, 178258700, 178258703,
+    178258705, 178258715, 178258723, 178258724, 178258728, 178258733, 178258736, 180355843, 180355875, 182452992, 182452993, 182452994,
+    182452999, 182453000, 182453027, 184550151, 184550152, 186647296, 186647297, 186647298, 186647299, 186647300, 186647303, 186647304,
+    186647305, 186647331, 188744449, 188744450, 188744455, 188744460, 188744483, 188744497, 203424512, 203424513, 203424514, 203424515,
+    203424516, 203424518, 203424519, 203424520, 203424521, 203424522, 203424524, 203424527, 203424529, 203424547, 203424549, 203424552,
+    205521671, 205521699, 205521713, 207618817, 207618818, 207618823, 207618828, 207618855, 209715975, 209715980, 209716003, 209716007,
+    209716013, 209716017, 211813120, 211813121, 211813122, 211813123, 211813124, 211813126, 211813127, 211813128, 211813129, 211813132,
+    211813135, 211813137, 211813155, 211813159, 211813160, 211813165, 211813168, 213910279, 216007425, 216007426, 216007428, 216007430,
+    216007431, 216007436, 216007463, 218104578, 218104583, 218104584, 218104588, 218104611, 218104615, 218104622, 218104625, 220201728,
+    220201729, 220201730, 220201731, 220201732, 220201734, 220201736, 220201737, 220201740, 220201743, 220201745, 220201763, 220201768,
+    220201776, 222298882, 222298892, 224396033, 224396044, 224396067, 224396071, 224396081, 226493185, 226493196, 226493219, 226493223,
+    226493229, 226493233, 228590337, 228590343, 228590371, 230687488, 230687489, 230687491, 230687495, 230687500, 230687523, 230687527,
+    230687533, 230687537, 232784640, 232784641, 232784642, 232784643, 232784644, 232784646, 232784647, 232784648, 232784649, 232784651,
+    232784652, 232784655, 232784657, 232784667, 232784675, 232784680, 234881793, 234881799, 239076097, 239076103, 239076108, 239076111,
+    239076113, 239076131, 239076135, 239076145, 241173249, 241173250, 241173255, 241173260, 241173283, 241173286, 241173287, 243270407,
+    243270408, 243270412, 243270435, 243270438, 243270439, 243270445, 243270449, 245367552, 245367553, 245367554, 245367555, 245367556,
+    245367558, 245367560, 245367561, 245367562, 245367563, 245367564, 245367567, 245367569, 245367579, 245367587, 245367588, 245367592,
+    245367597, 245367600, 247464707, 247464739, 249561856, 249561857, 249561858, 249561863, 249561864, 249561866, 249561891, 251659015,
+    251659016, 253756160, 253756161, 253756162, 253756163, 253756164, 253756167, 253756168, 253756169, 253756170, 253756195, 255853313,
+    255853314, 255853319, 255853324, 255853347, 255853361, 352322304, 352322305, 352322370, 406848256, 406848257, 406848259, 406848265,
+    411042564, 413139713, 415236865, 415236868, 417334017, 423625472, 423625473, 423625475, 423625481, 434111233, 444596992, 444596993,
+    444596995, 444597001, 446694145, 446694148, 446694152, 448791300, 452985601, 461374208, 461374209, 461374212, 461374220, 473957120,
+    473957121, 473957123, 473957129, 478151428, 480248577, 482345729, 482345732, 484442881, 490734336, 490734337, 490734339, 490734345,
+    501220097, 511705856, 511705857, 511705859, 511705865, 513803009, 513803012, 513803016, 515900164, 520094465, 528483072, 528483073,
+    528483076, 528483084, 541065984, 541065985, 541065987, 541065993, 543163136, 543163137, 543163139, 543163145, 574620416, 574620417,
+    576717568, 576717569, 696255232, 696255233, 698352384, 698352385, 725615367, 727712519, 738198279, 740295431, 754975489, 757072641,
+    759169800, 761266952, 803209991, 872416000, 872416001, 872416003, 872416009, 872416035, 874513152, 874513153, 874513155, 874513161,
+    874513187, 903873280, 903873281, 903873283, 903873289, 903873315, 905970432, 905970433, 905970435, 905970441, 905970467, 920650508,
+    1027605252, 1029702404, 1153434372, 1155531524, 1157628678, 1159725830, 1170211588, 1172308740, 1379926796, 1914700544, 1914700545, 1914700548,
+    1914700550, 1914700563, 1914700564, 1914700613, 1923089152, 1923089153, 1923089171, 1923089172, 1927283456, 1927283457, 1927283475, 1927283476,
+    1927283525, 1931477760, 1931477761, 1931477764, 1931477766, 1931477768, 1931477779, 1931477780, 1944060672, 1944060673, 1944060691, 1944060692,
+    1948254996, 1956643584, 1956643585, 1956643588, 1956643590, 1956643592, 1956643604, 1965032192, 1965032193, 1965032211, 1965032212, 1965032261,
+    1971323717, 1975518021, 1981809408, 1981809409, 1981809412, 1981809414, 1981809427, 1981809428, 1981809474, 1981809477, 1990198016, 1990198017,
+    1990198035, 1990198036, 1994392320, 1994392321, 1994392339, 1994392340, 1994392386, 1994392389, 1998586624, 1998586625, 1998586628, 1998586630,
+    1998586632, 1998586643, 1998586644, 1998586690, 2011169536, 2011169537, 2011169555, 2011169556, 2015363859, 2015363860, 2023752448, 2023752449,
+    2023752452, 2023752454, 2023752456, 2023752467, 2023752468, 2023752514, 2032141056, 2032141057, 2032141075, 2032141076, 2032141122, 2032141125,
+    2034238208, 2034238209, 2034238274, 2036335360, 2036335361, 2036335426, 2042626885, 2051015425, 2051015432, 2160067336, 2181038854, 2181038856,
+    2187330305, 2191524608, 2191524614, 2191524616, 2193621766, 2193621768, 2195718920, 2197816064, 2197816068, 2197816070, 2197816072, 2202010369,
+    2210398984, 2220884740, 2220884742, 2220884744, 2220884747, 2229273352, 2237661960, 2241856264, 2248147718, 2248147720, 2254439169, 2258633472,
+    2258633478, 2258633480, 2260730630, 2260730632, 2262827784, 2264924928, 2264924932, 2264924934, 2264924936, 2269119233, 2277507848, 2287993604,
+    2287993606, 2287993608, 2287993611, 2296382216, 2304770824, 2308965128, 2327839496, 2390754063, 2392851215, 2600469256, 2602566408, 2634023688,
+    2636120840, 3303016019, 3303016020, 3303016021, 3372222036, 3376416340, 3625977428, 3661629012, 3667920468, 4915726652, 4932503868, 4938795324,
+    5249173950, 5249173975, 6054480702, 6054480726, 6054480727, 6211767255, 6320819134, 6320819159, 6322916286, 6589254742, 6843010261, 6857690306,
+    6857690325, 6857690326, 6866078933, 7126125886, 7126125911, 7128223038, 7434407370, 7434407375, 7434407391, 7440698826, 8667533358, 14506007349,
+    14510201653, 14514395957, 14518590261, 14522784565, 14531173173, 14617156405, 14621350709, 14625545013, 14627642165, 14633933621, 16219374340, 16221471492,
+    16294871812, 16296968964, 16311649031, 16313746183, 16441672450, 16441672454, 16443769602, 16443769606, 16492004098, 16494101250, 16533947138, 16536044290,
+    16642999040, 16642999041, 16642999106, 16642999109, 16645096192, 16645096193, 16645096258, 16645096261, 16647193413, 16649290565, 16651387717, 16653484869,
+    16655582021, 16657679173, 16659776256, 16659776257, 16659776322, 16659776325, 16661873408, 16661873409, 16661873474, 16661873477, 16663970629, 16666067781,
+    16668164933, 16670262085, 16672359237, 16674456389, 16676553472, 16676553473, 16678650624, 16678650625, 16693330688, 16693330689, 16695427840, 16695427841,
+    16710107904, 16710107905, 16710107970, 16710107973, 16712205056, 16712205057, 16712205122, 16712205125, 16714302277, 16716399429, 16718496581, 16720593733,
+    16722690885, 16724788037, 16726885120, 16726885121, 16726885186, 16726885189, 16728982272, 16728982273, 16728982338, 16728982341, 16731079493, 16733176645,
+    16735273797, 16737370949, 16739468101, 16741565253, 16743662336, 16743662337, 16743662402, 16745759488, 16745759489, 16745759554, 16760439552, 16760439553,
+    16760439618, 16762536704, 16762536705, 16762536770, 16777216768, 16777216769, 16779313920, 16779313921, 16793993984, 16793993985, 16796091136, 16796091137,
+    16810771200, 16810771201, 16810771266, 16812868352, 16812868353, 16812868418, 16829645568, 16829645569, 16829645634, 16844325632, 16844325633, 16844325698,
+    16844325701, 16846422784, 16846422785, 16846422850, 16846422853, 16848520005, 16850617157, 16852714309, 16854811461, 16856908613, 16859005765, 16861102848,
+    16861102849, 16861102914, 16861102917, 16863200000, 16863200001, 16863200066, 16863200069, 16865297221, 16867394373, 16869491525, 16871588677, 16873685829,
+    16875782981, 16877880133, 16886268741, 16903045957, 17024680773, 17043555072, 17043555073, 17043555138, 17058235205, 17158898501, 17175675648, 17175675649,
+    17175675714, 18018730808, 18022925112, 18027119416, 18152948536, 18157142840, 18161337144, 18259903288, 18270389048, 18276680504, 18327012152, 18331206456,
+    18379440952, 18394121016, 18398315320, 18404606776, 18415092536, 18457035576, 18463327032, 18465424184, 18492687160, 18494784312, 18501075768, 18503172920,
+    18509464376, 18511561528, 18513658680, 18515755832, 18526241592, 18528338744, 18534630200, 18536727352, 18557698872, 18559796024, 18593350456, 18605933368,
+    18608030520, 18612224824, 18626904888, 18629002040, 18631099192, 18633196344, 25916616857, 25927102617, 25931296921, 25935491225, 25939685529, 25943879833,
+    25948074137, 25952268441, 25956462745, 25960657049, 25964851353, 25969045657, 25973239961, 25979531417, 25983725721, 25987920025, 26002600089, 26002600090,
+    26008891545, 26008891546, 26015183001, 26015183002, 26021474457, 26021474458, 26027765913, 26027765914, 26099069081, 26117943449, 26128429209, 26132623513,
+    26136817817, 26141012121, 26145206425, 26149400729, 26153595033, 26157789337, 26161983641, 26166177945, 26170372249, 26174566553, 26180858009, 26185052313,
+    26189246617, 26203926681, 26203926682, 26210218137, 26210218138, 26216509593, 26216509594, 26222801049, 26222801050, 26229092505, 26229092506, 26271035545,
+    26273132697, 26275229849, 26277327001, 26300395673, 146349822138, 146354016442, 146374987962, 146668589351, 146670686503, 147788469054, 147788469079, 148564415664,
+    148564415674, 148564415677, 149099189679, 149101286831, 150971947312,
+};
+static const uint32_t UNI_COMPOSE_VALS[] = {
+    8814, 8800, 8815, 192, 193, 194, 195, 256, 258, 550, 196, 7842,
+    197, 461, 512, 514, 7840, 7680, 260, 7682, 7684, 7686, 262, 264,
+    266, 268, 199, 7690, 270, 7692, 7696, 7698, 7694, 200, 201, 202,
+    7868, 274, 276, 278, 203, 7866, 282, 516, 518, 7864, 552, 280,
+    7704, 7706, 7710, 500, 284, 7712, 286, 288, 486, 290, 292, 7714,
+    7718, 542, 7716, 7720, 7722, 204, 205, 206, 296, 298, 300, 304,
+    207, 7880, 463, 520, 522, 7882, 302, 7724, 308, 7728, 488, 7730,
+    310, 7732, 313, 317, 7734, 315, 7740, 7738, 7742, 7744, 7746, 504,
+    323, 209, 7748, 327, 7750, 325, 7754, 7752, 210, 211, 212, 213,
+    332, 334, 558, 214, 7886, 336, 465, 524, 526, 416, 7884, 490,
+    7764, 7766, 340, 7768, 344, 528, 530, 7770, 342, 7774, 346, 348,
+    7776, 352, 7778, 536, 350, 7786, 356, 7788, 538, 354, 7792, 7790,
+    217, 218, 219, 360, 362, 364, 220, 7910, 366, 368, 467, 532,
+    534, 431, 7908, 7794, 370, 7798, 7796, 7804, 7806, 7808, 7810, 372,
+    7814, 7812, 7816, 7818, 7820, 7922, 221, 374, 7928, 562, 7822, 376,
+    7926, 7924, 377, 7824, 379, 381, 7826, 7828, 224, 225, 226, 227,
+    257, 259, 551, 228, 7843, 229, 462, 513, 515, 7841, 7681, 261,
+    7683, 7685, 7687, 263, 265, 267, 269, 231, 7691, 271, 7693, 7697,
+    7699, 7695, 232, 233, 234, 7869, 275, 277, 279, 235, 7867, 283,
+    517, 519, 7865, 553, 281, 7705, 7707, 7711, 501, 285, 7713, 287,
+    289, 487, 291, 293, 7715, 7719, 543, 7717, 7721, 7723, 7830, 236,
+    237, 238, 297, 299, 301, 239, 7881, 464, 521, 523, 7883, 303,
+    7725, 309, 496, 7729, 489, 7731, 311, 7733, 314, 318, 7735, 316,
+    7741, 7739, 7743, 7745, 7747, 505, 324, 241, 7749, 328, 7751, 326,
+    7755, 7753, 242, 243, 244, 245, 333, 335, 559, 246, 7887, 337,
+    466, 525, 527, 417, 7885, 491, 7765, 7767, 341, 7769, 345, 529,
+    531, 7771, 343, 7775, 347, 349, 7777, 353, 7779, 537, 351, 7787,
+    7831, 357, 7789, 539, 355, 7793, 7791, 249, 250, 251, 361, 363,
+    365, 252, 7911, 367, 369, 468, 533, 535, 432, 7909, 7795, 371,
+    7799, 7797, 7805, 7807, 7809, 7811, 373, 7815, 7813, 7832, 7817, 7819,
+    7821, 7923, 253, 375, 7929, 563, 7823, 255, 7927, 7833, 7925, 378,
+    7825, 380, 382, 7827, 7829, 8173, 901, 8129, 7846, 7844, 7850, 7848,
+    478, 506, 508, 482, 7688, 7872, 7870, 7876, 7874, 7726, 7890, 7888,
+    7894, 7892, 7756, 556, 7758, 554, 510, 475, 471, 469, 473, 7847,
+    7845, 7851, 7849, 479, 507, 509, 483, 7689, 7873, 7871, 7877, 7875,
+    7727, 7891, 7889, 7895, 7893, 7757, 557, 7759, 555, 511, 476, 472,
+    470, 474, 7856, 7854, 7860, 7858, 7857, 7855, 7861, 7859, 7700, 7702,
+    7701, 7703, 7760, 7762, 7761, 7763, 7780, 7781, 7782, 7783, 7800, 7801,
+    7802, 7803, 7835, 7900, 7898, 7904, 7902, 7906, 7901, 7899, 7905, 7903,
+    7907, 7914, 7912, 7918, 7916, 7920, 7915, 7913, 7919, 7917, 7921, 494,
+    492, 493, 480, 481, 7708, 7709, 560, 561, 495, 8122, 902, 8121,
+    8120, 7944, 7945, 8124, 8136, 904, 7960, 7961, 8138, 905, 7976, 7977,
+    8140, 8154, 906, 8153, 8152, 938, 7992, 7993, 8184, 908, 8008, 8009,
+    8172, 8170, 910, 8169, 8168, 939, 8025, 8186, 911, 8040, 8041, 8188,
+    8116, 8132, 8048, 940, 8113, 8112, 7936, 7937, 8118, 8115, 8050, 941,
+    7952, 7953, 8052, 942, 7968, 7969, 8134, 8131, 8054, 943, 8145, 8144,
+    970, 7984, 7985, 8150, 8056, 972, 8000, 8001, 8164, 8165, 8058, 973,
+    8161, 8160, 971, 8016, 8017, 8166, 8060, 974, 8032, 8033, 8182, 8179,
+    8146, 912, 8151, 8162, 944, 8167, 8180, 979, 980, 1031, 1232, 1234,
+    1027, 1024, 1238, 1025, 1217, 1244, 1246, 1037, 1250, 1049, 1252, 1036,
+    1254, 1262, 1038, 1264, 1266, 1268, 1272, 1260, 1233, 1235, 1107, 1104,
+    1239, 1105, 1218, 1245, 1247, 1117, 1251, 1081, 1253, 1116, 1255, 1263,
+    1118, 1265, 1267, 1269, 1273, 1261, 1111, 1142, 1143, 1242, 1243, 1258,
+    1259, 1570, 1571, 1573, 1572, 1574, 1730, 1747, 1728, 2345, 2353, 2356,
+    2507, 2508, 2891, 2888, 2892, 2964, 3018, 3020, 3019, 3144, 3264, 3274,
+    3271, 3272, 3275, 3402, 3404, 3403, 3546, 3548, 3550, 3549, 4134, 6918,
+    6920, 6922, 6924, 6926, 6930, 6971, 6973, 6976, 6977, 6979, 7736, 7737,
+    7772, 7773, 7784, 7785, 7852, 7862, 7853, 7863, 7878, 7879, 7896, 7897,
+    7938, 7940, 7942, 8064, 7939, 7941, 7943, 8065, 8066, 8067, 8068, 8069,
+    8070, 8071, 7946, 7948, 7950, 8072, 7947, 7949, 7951, 8073, 8074, 8075,
+    8076, 8077, 8078, 8079, 7954, 7956, 7955, 7957, 7962, 7964, 7963, 7965,
+    7970, 7972, 7974, 8080, 7971, 7973, 7975, 8081, 8082, 8083, 8084, 8085,
+    8086, 8087, 7978, 7980, 7982, 8088, 7979, 7981, 7983, 8089, 8090, 8091,
+    8092, 8093, 8094, 8095, 7986, 7988, 7990, 7987, 7989, 7991, 7994, 7996,
+    7998, 7995, 7997, 7999, 8002, 8004, 8003, 8005, 8010, 8012, 8011, 8013,
+    8018, 8020, 8022, 8019, 8021, 8023, 8027, 8029, 8031, 8034, 8036, 8038,
+    8096, 8035, 8037, 8039, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8042,
+    8044, 8046, 8104, 8043, 8045, 8047, 8105, 8106, 8107, 8108, 8109, 8110,
+    8111, 8114, 8130, 8178, 8119, 8141, 8142, 8143, 8135, 8183, 8157, 8158,
+    8159, 8602, 8603, 8622, 8653, 8655, 8654, 8708, 8713, 8716, 8740, 8742,
+    8769, 8772, 8775, 8777, 8813, 8802, 8816, 8817, 8820, 8821, 8824, 8825,
+    8832, 8833, 8928, 8929, 8836, 8837, 8840, 8841, 8930, 8931, 8876, 8877,
+    8878, 8879, 8938, 8939, 8940, 8941, 12436, 12364, 12366, 12368, 12370, 12372,
+    12374, 12376, 12378, 12380, 12382, 12384, 12386, 12389, 12391, 12393, 12400, 12401,
+    12403, 12404, 12406, 12407, 12409, 12410, 12412, 12413, 12446, 12532, 12460, 12462,
+    12464, 12466, 12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12485, 12487,
+    12489, 12496, 12497, 12499, 12500, 12502, 12503, 12505, 12506, 12508, 12509, 12535,
+    12536, 12537, 12538, 12542, 69786, 69788, 69803, 69934, 69935, 70475, 70476, 70844,
+    70843, 70846, 71098, 71099, 71992,
+};
+
+// Canonical combining classes, (first, last, class) for non-zero classes
+static const size_t UNI_CCC_SIZE = 382;
+static const uint32_t UNI_CCC[] = {
+    768, 788, 230, 789, 789, 232, 790, 793, 220, 794, 794, 232,
+    795, 795, 216, 796, 800, 220, 801, 802, 202, 803, 806, 220,
+    807, 808, 202, 809, 819, 220, 820, 824, 1, 825, 828, 220,
+    829, 836, 230, 837, 837, 240, 838, 838, 230, 839, 841, 220,
+    842, 844, 230, 845, 846, 220, 848, 850, 230, 851, 854, 220,
+    855, 855, 230, 856, 856, 232, 857, 858, 220, 859, 859, 230,
+    860, 860, 233, 861, 862, 234, 863, 863, 233, 864, 865, 234,
+    866, 866, 233, 867, 879, 230, 1155, 1159, 230, 1425, 1425, 220,
+    1426, 1429, 230, 1430, 1430, 220, 1431, 1433, 230, 1434, 1434, 222,
+    1435, 1435, 220, 1436, 1441, 230, 1442, 1447, 220, 1448, 1449, 230,
+    1450, 1450, 220, 1451, 1452, 230, 1453, 1453, 222, 1454, 1454, 228,
+    1455, 1455, 230, 1456, 1456, 10, 1457, 1457, 11, 1458, 1458, 12,
+    1459, 1459, 13, 1460, 1460, 14, 1461, 1461, 15, 1462, 1462, 16,
+    1463, 1463, 17, 1464, 1464, 18, 1465, 1466, 19, 1467, 1467, 20,
+    1468, 1468, 21, 1469, 1469, 22, 1471, 1471, 23, 1473, 1473, 24,
+    1474, 1474, 25, 1476, 1476, 230, 1477, 1477, 220, 1479, 1479, 18,
+    1552, 1559, 230, 1560, 1560, 30, 1561, 1561, 31, 1562, 1562, 32,
+    1611, 1611, 27, 1612, 1612, 28, 1613, 1613, 29, 1614, 1614, 30,
+    1615, 1615, 31, 1616, 1616, 32, 1617, 1617, 33, 1618, 1618, 34,
+    1619, 1620, 230, 1621, 1622, 220, 1623, 1627, 230, 1628, 1628, 220,
+    1629, 1630, 230, 1631, 1631, 220, 1648, 1648, 35, 1750, 1756, 230,
+    1759, 1762, 230, 1763, 1763, 220, 1764, 1764, 230, 1767, 1768, 230,
+    1770, 1770, 220, 1771, 1772, 230, 1773, 1773, 220, 1809, 1809, 36,
+    1840, 1840, 230, 1841, 1841, 220, 1842, 1843, 230, 1844, 1844, 220,
+    1845, 1846, 230, 1847, 1849, 220, 1850, 1850, 230, 1851, 1852, 220,
+    1853, 1853, 230, 1854, 1854, 220, 1855, 1857, 230, 1858, 1858, 220,
+    1859, 1859, 230, 1860, 1860, 220, 1861, 1861, 230, 1862, 1862, 220,
+    1863, 1863, 230, 1864, 1864, 220, 1865, 1866, 230, 2027, 2033, 230,
+    2034, 2034, 220, 2035, 2035, 230, 2045, 2045, 220, 2070, 2073, 230,
+    2075, 2083, 230, 2085, 2087, 230, 2089, 2093, 230, 2137, 2139, 220,
+    2200, 2200, 230, 2201, 2203, 220, 2204, 2207, 230, 2250, 2254, 230,
+    2255, 2259, 220, 2260, 2273, 230, 2275, 2275, 220, 2276, 2277, 230,
+    2278, 2278, 220, 2279, 2280, 230, 2281, 2281, 220, 2282, 2284, 230,
+    2285, 2287, 220, 2288, 2288, 27, 2289, 2289, 28, 2290, 2290, 29,
+    2291, 2293, 230, 2294, 2294, 220, 2295, 2296, 230, 2297, 2298, 220,
+    2299, 2303, 230, 2364, 2364, 7, 2381, 2381, 9, 2385, 2385, 230,
+    2386, 2386, 220, 2387, 2388, 230, 2492, 2492, 7, 2509, 2509, 9,
+    2558, 2558, 230, 2620, 2620, 7, 2637, 2637, 9, 2748, 2748, 7,
+    2765, 2765, 9, 2876, 2876, 7, 2893, 2893, 9, 3021, 3021, 9,
+    3132, 3132, 7, 3149, 3149, 9, 3157, 3157, 84, 3158, 3158, 91,
+    3260, 3260, 7, 3277, 3277, 9, 3387, 3388, 9, 3405, 3405, 9,
+    3530, 3530, 9, 3640, 3641, 103, 3642, 3642, 9, 3656, 3659, 107,
+    3768, 3769, 118, 3770, 3770, 9, 3784, 3787, 122, 3864, 3865, 220,
+    3893, 3893, 220, 3895, 3895, 220, 3897, 3897, 216, 3953, 3953, 129,
+    3954, 3954, 130, 3956, 3956, 132, 3962, 3965, 130, 3968, 3968, 130,
+    3970, 3971, 230, 3972, 3972, 9, 3974, 3975, 230, 4038, 4038, 220,
+    4151, 4151, 7, 4153, 4154, 9, 4237, 4237, 220, 4957, 4959, 230,
+    5908, 5909, 9, 5940, 5940, 9, 6098, 6098, 9, 6109, 6109, 230,
+    6313, 6313, 228, 6457, 6457, 222, 6458, 6458, 230, 6459, 6459, 220,
+    6679, 6679, 230, 6680, 6680, 220, 6752, 6752, 9, 6773, 6780, 230,
+    6783, 6783, 220, 6832, 6836, 230, 6837, 6842, 220, 6843, 6844, 230,
+    6845, 6845, 220, 6847, 6848, 220, 6849, 6850, 230, 6851, 6852, 220,
+    6853, 6857, 230, 6858, 6858, 220, 6859, 6862, 230, 6964, 6964, 7,
+    6980, 6980, 9, 7019, 7019, 230, 7020, 7020, 220, 7021, 7027, 230,
+    7082, 7083, 9, 7142, 7142, 7, 7154, 7155, 9, 7223, 7223, 7,
+    7376, 7378, 230, 7380, 7380, 1, 7381, 7385, 220, 7386, 7387, 230,
+    7388, 7391, 220, 7392, 7392, 230, 7394, 7400, 1, 7405, 7405, 220,
+    7412, 7412, 230, 7416, 7417, 230, 7616, 7617, 230, 7618, 7618, 220,
+    7619, 7625, 230, 7626, 7626, 220, 7627, 7628, 230, 7629, 7629, 234,
+    7630, 7630, 214, 7631, 7631, 220, 7632, 7632, 202, 7633, 7669, 230,
+    7670, 7670, 232, 7671, 7672, 228, 7673, 7673, 220, 7674, 7674, 218,
+    7675, 7675, 230, 7676, 7676, 233, 7677, 7677, 220, 7678, 7678, 230,
+    7679, 7679, 220, 8400, 8401, 230, 8402, 8403, 1, 8404, 8407, 230,
+    8408, 8410, 1, 8411, 8412, 230, 8417, 8417, 230, 8421, 8422, 1,
+    8423, 8423, 230, 8424, 8424, 220, 8425, 8425, 230, 8426, 8427, 1,
+    8428, 8431, 220, 8432, 8432, 230, 11503, 11505, 230, 11647, 11647, 9,
+    11744, 11775, 230, 12330, 12330, 218, 12331, 12331, 228, 12332, 12332, 232,
+    12333, 12333, 222, 12334, 12335, 224, 12441, 12442, 8, 42607, 42607, 230,
+    42612, 42621, 230, 42654, 42655, 230, 42736, 42737, 230, 43014, 43014, 9,
+    43052, 43052, 9, 43204, 43204, 9, 43232, 43249, 230, 43307, 43309, 220,
+    43347, 43347, 9, 43443, 43443, 7, 43456, 43456, 9, 43696, 43696, 230,
+    43698, 43699, 230, 43700, 43700, 220, 43703, 43704, 230, 43710, 43711, 230,
+    43713, 43713, 230, 43766, 43766, 9, 44013, 44013, 9, 64286, 64286, 26,
+    65056, 65062, 230, 65063, 65069, 220, 65070, 65071, 230, 66045, 66045, 220,
+    66272, 66272, 220, 66422, 66426, 230, 68109, 68109, 220, 68111, 68111, 230,
+    68152, 68152, 230, 68153, 68153, 1, 68154, 68154, 220, 68159, 68159, 9,
+    68325, 68325, 230, 68326, 68326, 220, 68900, 68903, 230, 69291, 69292, 230,
+    69446, 69447, 220, 69448, 69450, 230, 69451, 69451, 220, 69452, 69452, 230,
+    69453, 69456, 220, 69506, 69506, 230, 69507, 69507, 220, 69508, 69508, 230,
+    69509, 69509, 220, 69702, 69702, 9, 69744, 69744, 9, 69759, 69759, 9,
+    69817, 69817, 9, 69818, 69818, 7, 69888, 69890, 230, 69939, 69940, 9,
+    70003, 70003, 7, 70080, 70080, 9, 70090, 70090, 7, 70197, 70197, 9,
+    70198, 70198, 7, 70377, 70377, 7, 70378, 70378, 9, 70459, 70460, 7,
+    70477, 70477, 9, 70502, 70508, 230, 70512, 70516, 230, 70722, 70722, 9,
+    70726, 70726, 7, 70750, 70750, 230, 70850, 70850, 9, 70851, 70851, 7,
+    71103, 71103, 9, 71104, 71104, 7, 71231, 71231, 9, 71350, 71350, 9,
+    71351, 71351, 7, 71467, 71467, 9, 71737, 71737, 9, 71738, 71738, 7,
+    71997, 71998, 9, 72003, 72003, 7, 72160, 72160, 9, 72244, 72244, 9,
+    72263, 72263, 9, 72345, 72345, 9, 72767, 72767, 9, 73026, 73026, 7,
+    73028, 73029, 9, 73111, 73111, 9, 92912, 92916, 1, 92976, 92982, 230,
+    94192, 94193, 6, 113822, 113822, 1, 119141, 119142, 216, 119143, 119145, 1,
+    119149, 119149, 226, 119150, 119154, 216, 119163, 119170, 220, 119173, 119177, 230,
+    119178, 119179, 220, 119210, 119213, 230, 119362, 119364, 230, 122880, 122886, 230,
+    122888, 122904, 230, 122907, 122913, 230, 122915, 122916, 230, 122918, 122922, 230,
+    123184, 123190, 230, 123566, 123566, 230, 123628, 123631, 230, 125136, 125142, 220,
+    125252, 125257, 230, 125258, 125258, 7,
+};
+
+// Nonspacing marks (Mn), (first, last)
+static const size_t UNI_MN_SIZE = 336;
+static const uint32_t UNI_MN[] = {
+    768, 879, 1155, 1159, 1425, 1469, 1471, 1471, 1473, 1474, 1476, 1477,
+    1479, 1479, 1552, 1562, 1611, 1631, 1648, 1648, 1750, 1756, 1759, 1764,
+    1767, 1768, 1770, 1773, 1809, 1809, 1840, 1866, 1958, 1968, 2027, 2035,
+    2045, 2045, 2070, 2073, 2075, 2083, 2085, 2087, 2089, 2093, 2137, 2139,
+    2200, 2207, 2250, 2273, 2275, 2306, 2362, 2362, 2364, 2364, 2369, 2376,
+    2381, 2381, 2385, 2391, 2402, 2403, 2433, 2433, 2492, 2492, 2497, 2500,
+    2509, 2509, 2530, 2531, 2558, 2558, 2561, 2562, 2620, 2620, 2625, 2626,
+    2631, 2632, 2635, 2637, 2641, 2641, 2672, 2673, 2677, 2677, 2689, 2690,
+    2748, 2748, 2753, 2757, 2759, 2760, 2765, 2765, 2786, 2787, 2810, 2815,
+    2817, 2817, 2876, 2876, 2879, 2879, 2881, 2884, 2893, 2893, 2901, 2902,
+    2914, 2915, 2946, 2946, 3008, 3008, 3021, 3021, 3072, 3072, 3076, 3076,
+    3132, 3132, 3134, 3136, 3142, 3144, 3146, 3149, 3157, 3158, 3170, 3171,
+    3201, 3201, 3260, 3260, 3263, 3263, 3270, 3270, 3276, 3277, 3298, 3299,
+    3328, 3329, 3387, 3388, 3393, 3396, 3405, 3405, 3426, 3427, 3457, 3457,
+    3530, 3530, 3538, 3540, 3542, 3542, 3633, 3633, 3636, 3642, 3655, 3662,
+    3761, 3761, 3764, 3772, 3784, 3789, 3864, 3865, 3893, 3893, 3895, 3895,
+    3897, 3897, 3953, 3966, 3968, 3972, 3974, 3975, 3981, 3991, 3993, 4028,
+    4038, 4038, 4141, 4144, 4146, 4151, 4153, 4154, 4157, 4158, 4184, 4185,
+    4190, 4192, 4209, 4212, 4226, 4226, 4229, 4230, 4237, 4237, 4253, 4253,
+    4957, 4959, 5906, 5908, 5938, 5939, 5970, 5971, 6002, 6003, 6068, 6069,
+    6071, 6077, 6086, 6086, 6089, 6099, 6109, 6109, 6155, 6157, 6159, 6159,
+    6277, 6278, 6313, 6313, 6432, 6434, 6439, 6440, 6450, 6450, 6457, 6459,
+    6679, 6680, 6683, 6683, 6742, 6742, 6744, 6750, 6752, 6752, 6754, 6754,
+    6757, 6764, 6771, 6780, 6783, 6783, 6832, 6845, 6847, 6862, 6912, 6915,
+    6964, 6964, 6966, 6970, 6972, 6972, 6978, 6978, 7019, 7027, 7040, 7041,
+    7074, 7077, 7080, 7081, 7083, 7085, 7142, 7142, 7144, 7145, 7149, 7149,
+    7151, 7153, 7212, 7219, 7222, 7223, 7376, 7378, 7380, 7392, 7394, 7400,
+    7405, 7405, 7412, 7412, 7416, 7417, 7616, 7679, 8400, 8412, 8417, 8417,
+    8421, 8432, 11503, 11505, 11647, 11647, 11744, 11775, 12330, 12333, 12441, 12442,
+    42607, 42607, 42612, 42621, 42654, 42655, 42736, 42737, 43010, 43010, 43014, 43014,
+    43019, 43019, 43045, 43046, 43052, 43052, 43204, 43205, 43232, 43249, 43263, 43263,
+    43302, 43309, 43335, 43345, 43392, 43394, 43443, 43443, 43446, 43449, 43452, 43453,
+    43493, 43493, 43561, 43566, 43569, 43570, 43573, 43574, 43587, 43587, 43596, 43596,
+    43644, 43644, 43696, 43696, 43698, 43700, 43703, 43704, 43710, 43711, 43713, 43713,
+    43756, 43757, 43766, 43766, 44005, 44005, 44008, 44008, 44013, 44013, 64286, 64286,
+    65024, 65039, 65056, 65071, 66045, 66045, 66272, 66272, 66422, 66426, 68097, 68099,
+    68101, 68102, 68108, 68111, 68152, 68154, 68159, 68159, 68325, 68326, 68900, 68903,
+    69291, 69292, 69446, 69456, 69506, 69509, 69633, 69633, 69688, 69702, 69744, 69744,
+    69747, 69748, 69759, 69761, 69811, 69814, 69817, 69818, 69826, 69826, 69888, 69890,
+    69927, 69931, 69933, 69940, 70003, 70003, 70016, 70017, 70070, 70078, 70089, 70092,
+    70095, 70095, 70191, 70193, 70196, 70196, 70198, 70199, 70206, 70206, 70367, 70367,
+    70371, 70378, 70400, 70401, 70459, 70460, 70464, 70464, 70502, 70508, 70512, 70516,
+    70712, 70719, 70722, 70724, 70726, 70726, 70750, 70750, 70835, 70840, 70842, 70842,
+    70847, 70848, 70850, 70851, 71090, 71093, 71100, 71101, 71103, 71104, 71132, 71133,
+    71219, 71226, 71229, 71229, 71231, 71232, 71339, 71339, 71341, 71341, 71344, 71349,
+    71351, 71351, 71453, 71455, 71458, 71461, 71463, 71467, 71727, 71735, 71737, 71738,
+    71995, 71996, 71998, 71998, 72003, 72003, 72148, 72151, 72154, 72155, 72160, 72160,
+    72193, 72202, 72243, 72248, 72251, 72254, 72263, 72263, 72273, 72278, 72281, 72283,
+    72330, 72342, 72344, 72345, 72752, 72758, 72760, 72765, 72767, 72767, 72850, 72871,
+    72874, 72880, 72882, 72883, 72885, 72886, 73009, 73014, 73018, 73018, 73020, 73021,
+    73023, 73029, 73031, 73031, 73104, 73105, 73109, 73109, 73111, 73111, 73459, 73460,
+    92912, 92916, 92976, 92982, 94031, 94031, 94095, 94098, 94180, 94180, 113821, 113822,
+    118528, 118573, 118576, 118598, 119143, 119145, 119163, 119170, 119173, 119179, 119210, 119213,
+    119362, 119364, 121344, 121398, 121403, 121452, 121461, 121461, 121476, 121476, 121499, 121503,
+    121505, 121519, 122880, 122886, 122888, 122904, 122907, 122913, 122915, 122916, 122918, 122922,
+    123184, 123190, 123566, 123566, 123628, 123631, 125136, 125142, 125252, 125258, 917760, 917999,
+};
+
+// Control and format characters (Cc, Cf) except tab, LF and CR, (first, last)
+static const size_t UNI_CONTROL_SIZE = 25;
+static const uint32_t UNI_CONTROL[] = {
+    0, 8, 11, 12, 14, 31, 127, 159, 173, 173, 1536, 1541,
+    1564, 1564, 1757, 1757, 1807, 1807, 2192, 2193, 2274, 2274, 6158, 6158,
+    8203, 8207, 8234, 8238, 8288, 8292, 8294, 8303, 65279, 65279, 65529, 65531,
+    69821, 69821, 69837, 69837, 78896, 78904, 113824, 113827, 119155, 119162, 917505, 917505,
+    917536, 917631,
+};
+
+// Decimal digits (Nd), (first, last, code point - digit value)
+static const size_t UNI_DIGIT_SIZE = 66;
+static const uint32_t UNI_DIGIT[] = {
+    48, 57, 48, 1632, 1641, 1632, 1776, 1785, 1776, 1984, 1993, 1984,
+    2406, 2415, 2406, 2534, 2543, 2534, 2662, 2671, 2662, 2790, 2799, 2790,
+    2918, 2927, 2918, 3046, 3055, 3046, 3174, 3183, 3174, 3302, 3311, 3302,
+    3430, 3439, 3430, 3558, 3567, 3558, 3664, 3673, 3664, 3792, 3801, 3792,
+    3872, 3881, 3872, 4160, 4169, 4160, 4240, 4249, 4240, 6112, 6121, 6112,
+    6160, 6169, 6160, 6470, 6479, 6470, 6608, 6617, 6608, 6784, 6793, 6784,
+    6800, 6809, 6800, 6992, 7001, 6992, 7088, 7097, 7088, 7232, 7241, 7232,
+    7248, 7257, 7248, 42528, 42537, 42528, 43216, 43225, 43216, 43264, 43273, 43264,
+    43472, 43481, 43472, 43504, 43513, 43504, 43600, 43609, 43600, 44016, 44025, 44016,
+    65296, 65305, 65296, 66720, 66729, 66720, 68912, 68921, 68912, 69734, 69743, 69734,
+    69872, 69881, 69872, 69942, 69951, 69942, 70096, 70105, 70096, 70384, 70393, 70384,
+    70736, 70745, 70736, 70864, 70873, 70864, 71248, 71257, 71248, 71360, 71369, 71360,
+    71472, 71481, 71472, 71904, 71913, 71904, 72016, 72025, 72016, 72784, 72793, 72784,
+    73040, 73049, 73040, 73120, 73129, 73120, 92768, 92777, 92768, 92864, 92873, 92864,
+    93008, 93017, 93008, 120782, 120791, 120782, 120792, 120801, 120792, 120802, 120811, 120802,
+    120812, 120821, 120812, 120822, 120831, 120822, 123200, 123209, 123200, 123632, 123641, 123632,
+    125264, 125273, 125264, 130032, 130041, 130032,
+};
+
+#endif
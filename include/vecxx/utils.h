@@ -9,6 +9,8 @@
 #include <unordered_map>
 #include <algorithm>
 #include <functional>
+#include <tuple>
+#include "vecxx/flat.h"
 
 typedef uint32_t Index_T;
 
@@ -16,13 +18,38 @@ typedef std::vector<std::string> TokenList_T;
 typedef std::vector<std::vector<std::string> > ListTokenList_T;
 typedef std::unordered_map<std::string, std::string> TokenMap_T;
 typedef std::vector<TokenMap_T > TokenMapList_T;
+typedef std::vector<TokenMapList_T> ListTokenMapList_T;
+// A batch of sequences given as columns, see VocabMapVectorizer
+typedef std::vector<ListTokenList_T> ListColumns_T;
 typedef std::map<std::string, int> Counter_T;
 typedef std::unordered_map<std::string, uint32_t> SpecialVocab_T;
 typedef std::vector<int> VecList_T;
 typedef std::function<std::string(std::string)> Transform_T;
 
+/*
+ * Run a transform for code that is generic in its type.  The
+ * TransformPipeline overload returns a reference and may not copy
+ */
+inline std::string apply_transform(const Transform_T& transform, const std::string& s) {
+    return transform(s);
+}
+
 const std::string WHITESPACE = " \n\r\t\f\v";
 
+/*
+ * Special and extra tokens are stored in the vocab table itself, with this
+ * bit set on their id, so that one probe both classifies and resolves a
+ * token.  Stores skip flagged entries when iterating, reversing or compiling
+ */
+const Index_T SPECIAL_TOKEN_FLAG = 0x80000000;
+
+inline bool is_special_id(Index_T x) {
+    return (x & SPECIAL_TOKEN_FLAG) != 0;
+}
+inline Index_T special_id(Index_T x) {
+    return x & ~SPECIAL_TOKEN_FLAG;
+}
+
 class MapStrStr
 {
 public:
@@ -43,18 +70,61 @@ public:
     virtual bool exists(const std::string& key) const = 0;
     virtual size_t size() const = 0;
     virtual size_t max_size() const = 0;
+    /*!
+     * Visit every (key, id) pair.  The default walks the id space with
+     * rfind, which suits stores whose ids are dense below size()
+     */
+    virtual void for_each(const std::function<void(const std::string&, Index_T)>& fn) const {
+	for (size_t i = 0; i < size(); ++i) {
+	    bool found;
+	    std::string key;
+	    std::tie(found, key) = rfind((Index_T)i);
+	    if (found && !key.empty()) {
+		fn(key, (Index_T)i);
+	    }
+	}
+    }
+    /*!
+     * One past the largest regular (not special) id.  The default visits
+     * every entry, so stores that know their id range should override it
+     */
+    virtual Index_T id_bound() const {
+	Index_T bound = 0;
+	for_each([&bound](const std::string&, Index_T v) {
+		if (!is_special_id(v)) {
+		    bound = std::max<Index_T>(bound, v + 1);
+		}
+	    });
+	return bound;
+    }
 };
 
+/*!
+ * Is this a regular (not special) token of the vocab.  The vocab is a
+ * MapStrInt, or anything else with its find (see StaticMap)
+ */
+template<typename Map_T>
+inline bool in_vocab(const Map_T& vocab, const std::string& key) {
+    bool found;
+    Index_T x;
+    std::tie(found, x) = vocab.find(key);
+    return found && !is_special_id(x);
+}
 
+/*
+ * The in-memory maps used for uncompiled vocabs and codes.  They are backed
+ * by FlatHashMap (see flat.h) rather than std::unordered_map, and also take
+ * StringView_T keys for lookups
+ */
 class UnorderedMapStrStr : public MapStrStr
 {
-    std::unordered_map<std::string, std::string> _m;
+    FlatHashMap<std::string> _m;
 public:
-    typedef typename std::unordered_map<std::string, std::string>::const_iterator const_iterator;
+    typedef typename FlatHashMap<std::string>::const_iterator const_iterator;
     UnorderedMapStrStr() {
     }
     ~UnorderedMapStrStr() {}
-    std::string& operator[](const std::string& key) {
+    std::string& operator[](StringView_T key) {
 	return _m[key];
     }
     const_iterator begin() const {
@@ -63,16 +133,31 @@ public:
     const_iterator end() const {
 	return _m.end();
     }
+    void reserve(size_t n, size_t key_bytes=0) {
+	_m.reserve(n, key_bytes);
+    }
+    static uint64_t hash(StringView_T key) {
+	return FlatHashMap<std::string>::hash(key);
+    }
+    std::pair<std::string*, bool> try_emplace(StringView_T key, uint64_t hash, const std::string& value) {
+	return _m.try_emplace(key, hash, value);
+    }
     bool exists(const std::string& key) const {
-	auto it = _m.find(key);
-	return (it != _m.end());
+	return _m.find(key) != NULL;
+    }
+    bool exists(StringView_T key) const {
+	return _m.find(key) != NULL;
     }
     std::tuple<bool, std::string> find(const std::string& key) const {
-	auto it = _m.find(key);
-	if (it == _m.end()) {
+	auto v = _m.find(key);
+	if (v == NULL) {
 	    return std::make_tuple(false, "");
 	}
-	return std::make_tuple(true, it->second);
+	return std::make_tuple(true, *v);
+    }
+    // Returns NULL if the key is missing, avoiding a copy of the value
+    const std::string* find(StringView_T key) const {
+	return _m.find(key);
     }
     bool empty() const { return _m.empty(); }
     size_t size() const { return _m.size(); }
@@ -82,14 +167,15 @@ public:
 
 class UnorderedMapStrInt : public MapStrInt
 {
-    std::unordered_map<std::string, Index_T> _m;
+    FlatHashMap<Index_T> _m;
     mutable std::unordered_map<Index_T, std::string> _mr;
 public:
-    typedef typename std::unordered_map<std::string, Index_T>::const_iterator const_iterator;
+    typedef typename FlatHashMap<Index_T>::const_iterator const_iterator;
     UnorderedMapStrInt() {
     }
     ~UnorderedMapStrInt() {}
-    Index_T& operator[](const std::string& key) {
+    Index_T& operator[](StringView_T key) {
+	_mr.clear();
 	return _m[key];
     }
     const_iterator begin() const {
@@ -98,19 +184,44 @@ public:
     const_iterator end() const {
 	return _m.end();
     }
+    void reserve(size_t n, size_t key_bytes=0) {
+	_m.reserve(n, key_bytes);
+    }
+    static uint64_t hash(StringView_T key) {
+	return FlatHashMap<Index_T>::hash(key);
+    }
+    std::pair<Index_T*, bool> try_emplace(StringView_T key, uint64_t hash, Index_T value) {
+	_mr.clear();
+	return _m.try_emplace(key, hash, value);
+    }
+    void for_each(const std::function<void(const std::string&, Index_T)>& fn) const {
+	for (size_t i = 0; i < _m.size(); ++i) {
+	    if (!is_special_id(_m.value_at(i))) {
+		fn(_m.key_at(i), _m.value_at(i));
+	    }
+	}
+    }
     std::tuple<bool, Index_T> find(const std::string& key) const {
-	auto it = _m.find(key);
-	if (it == _m.end()) {
+	auto v = _m.find(key);
+	if (v == NULL) {
   	    return std::make_tuple(false, 0);
 	}
-	return std::make_tuple(true, it->second);
+	return std::make_tuple(true, *v);
+    }
+    std::tuple<bool, Index_T> find(StringView_T key) const {
+	auto v = _m.find(key);
+	if (v == NULL) {
+  	    return std::make_tuple(false, 0);
+	}
+	return std::make_tuple(true, *v);
     }
     std::tuple<bool, std::string> rfind(const Index_T indx) const {
         if (_mr.empty()) {
-            std::for_each(_m.begin(), _m.end(),
-                    [this] (const std::pair<std::string, Index_T>& p) {
-                        this->_mr[p.second] = p.first;
-                    });
+            for (size_t i = 0; i < _m.size(); ++i) {
+                if (!is_special_id(_m.value_at(i))) {
+                    _mr[_m.value_at(i)] = _m.key_at(i);
+                }
+            }
         }
         auto it = _mr.find(indx);
         if (it == _mr.end()) {
@@ -119,8 +230,10 @@ public:
         return std::make_tuple(true, it->second);
     }
     bool exists(const std::string& key) const {
-	auto it = _m.find(key);
-	return (it != _m.end());
+	return _m.find(key) != NULL;
+    }
+    bool exists(StringView_T key) const {
+	return _m.find(key) != NULL;
     }
 
     bool empty() const { return _m.empty(); }
@@ -172,6 +285,72 @@ bool starts_with(const std::string & s, const std::string & match)
             return false;
     return sLen >= mLen;
 }
+/*!
+ * True if none of the bytes has the high bit set.  Checks 16 bytes at a
+ * time with SSE2, then 8 at a time, so typical words take one or two steps
+ */
+inline bool is_ascii(const char* p, size_t n) {
+    size_t i = 0;
+#ifdef VECXX_HAVE_SSE2
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 16 <= n; i += 16) {
+	acc = _mm_or_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+    }
+    if (_mm_movemask_epi8(acc) != 0) {
+	return false;
+    }
+#endif
+    uint64_t acc8 = 0;
+    for (; i + 8 <= n; i += 8) {
+	uint64_t w;
+	memcpy(&w, p + i, 8);
+	acc8 |= w;
+    }
+    for (; i < n; ++i) {
+	acc8 |= (unsigned char)p[i];
+    }
+    return (acc8 & UINT64_C(0x8080808080808080)) == 0;
+}
+
+inline bool is_ascii(const std::string& s) {
+    return is_ascii(s.data(), s.size());
+}
+
+/*!
+ * Lowercase ASCII text in place, 16 bytes at a time with SSE2, otherwise 8
+ * at a time in a register.  The bytes must all be ASCII (see is_ascii)
+ */
+inline void ascii_lower(char* p, size_t n) {
+    size_t i = 0;
+#ifdef VECXX_HAVE_SSE2
+    const __m128i before_a = _mm_set1_epi8('A' - 1);
+    const __m128i after_z = _mm_set1_epi8('Z' + 1);
+    const __m128i bit = _mm_set1_epi8(0x20);
+    for (; i + 16 <= n; i += 16) {
+	__m128i* q = reinterpret_cast<__m128i*>(p + i);
+	__m128i x = _mm_loadu_si128(q);
+	__m128i upper = _mm_and_si128(_mm_cmpgt_epi8(x, before_a), _mm_cmplt_epi8(x, after_z));
+	_mm_storeu_si128(q, _mm_or_si128(x, _mm_and_si128(upper, bit)));
+    }
+#endif
+    const uint64_t ones = UINT64_C(0x0101010101010101);
+    for (; i + 8 <= n; i += 8) {
+	uint64_t w;
+	memcpy(&w, p + i, 8);
+	// The high bit of each byte is set from 'A' up, and from past 'Z' up,
+	// which cannot carry since every byte is below 0x80
+	uint64_t from_a = w + ones * (0x80 - 'A');
+	uint64_t past_z = w + ones * (0x80 - 'Z' - 1);
+	w |= ((from_a ^ past_z) & (ones * 0x80)) >> 2;
+	memcpy(p + i, &w, 8);
+    }
+    for (; i < n; ++i) {
+	if (p[i] >= 'A' && p[i] <= 'Z') {
+	    p[i] += 'a' - 'A';
+	}
+    }
+}
+
 void lower(std::string& data)
 {
     std::transform(data.begin(), data.end(), data.begin(),
@@ -12,9 +12,18 @@
 #include <algorithm>
 #include <functional>
 #include <exception>
+#include <memory>
+#include <atomic>
+#include <limits>
+#include <mutex>
 
 #include "vecxx/utils.h"
 #include "vecxx/bpe.h"
+#include "vecxx/count.h"
+#include "vecxx/scan.h"
+#include "vecxx/unicode.h"
+#include "vecxx/transform.h"
+#include "vecxx/pool.h"
 
 /*!
  *  Create a memory-mapped perfect hash map, no offset can be applied
@@ -23,30 +32,182 @@
  *
  */
 MapStrInt* read_vocab_mmap(const std::string& dir) {
-    auto c = new PerfectHashMapStrInt(file_in_dir(dir, "ph-vocab"));
+    auto c = open_perfect_hash_str_int(file_in_dir(dir, "ph-vocab"));
+    auto delta_dir = file_in_dir(dir, "ph-vocab-delta");
+    if (file_exists(delta_dir)) {
+	auto overlay = new OverlayMapStrInt(c);
+	overlay->load_delta(delta_dir);
+	return overlay;
+    }
     return c;
 }
-MapStrInt* read_vocab_file(const std::string& infile, int offset=4)
+
+/*!
+ *  Get the overlay for a vocab, wrapping it on first use, so that tokens
+ *  can be appended without touching the (possibly memory-mapped) base.
+ *  Appended ids start at min_id or later (see OverlayMapStrInt::reserve_ids)
+ */
+OverlayMapStrInt* overlay_vocab(MapStrInt*& vocab, Index_T min_id=0) {
+    auto overlay = dynamic_cast<OverlayMapStrInt*>(vocab);
+    if (overlay == NULL) {
+	overlay = new OverlayMapStrInt(vocab);
+	vocab = overlay;
+    }
+    overlay->reserve_ids(min_id);
+    return overlay;
+}
+
+void compile_vocab_delta(const MapStrInt* vocab, const std::string& target_dir) {
+    auto overlay = dynamic_cast<const OverlayMapStrInt*>(vocab);
+    if (overlay == NULL || overlay->num_appended() == 0) {
+	throw std::logic_error("No appended tokens to compile");
+    }
+    if (!file_exists(target_dir)) {
+	make_dir(target_dir);
+    }
+    overlay->compile_delta(file_in_dir(target_dir, "ph-vocab-delta"));
+}
+
+/*!
+ *  Store the special tokens in the vocab table with SPECIAL_TOKEN_FLAG set.
+ *  A compiled vocab gets them in its overlay, so the memory-mapped base is
+ *  never touched.  So does an in-memory one that also lists a special
+ *  token as a regular entry (a vocab file with an <UNK> line): the special
+ *  token shadows it for lookups, but its id can still be looked up in
+ *  reverse, and compile_vocab keeps it
+ */
+void add_special_tokens(MapStrInt*& vocab, const SpecialVocab_T& special_tokens) {
+    for (auto& kv : special_tokens) {
+	Index_T x = kv.second | SPECIAL_TOKEN_FLAG;
+	auto um = dynamic_cast<UnorderedMapStrInt*>(vocab);
+	if (um != NULL && !in_vocab(*um, kv.first)) {
+	    (*um)[kv.first] = x;
+	}
+	else {
+	    overlay_vocab(vocab)->add(kv.first, x);
+	}
+    }
+}
+
+/*!
+ *  Look up a token in a vocab holding special tokens.  The raw token is
+ *  probed once, and if it is special we are done.  Otherwise the
+ *  transformed token is used, which only costs a second probe if the
+ *  transform changed it.  A transformed token that hits a special entry
+ *  is unknown, special tokens are only matched verbatim.  The vocab is a
+ *  MapStrInt, or a StaticMap over one
+ */
+template<typename Map_T, typename TransformFn>
+Index_T lookup_token(const Map_T& vocab, const std::string& s, const TransformFn& transform, Index_T unk) {
+    bool found;
+    Index_T x;
+    std::tie(found, x) = vocab.find(s);
+    if (found && is_special_id(x)) {
+	return special_id(x);
+    }
+    const std::string& t = apply_transform(transform, s);
+    if (&t != &s && t != s) {
+	std::tie(found, x) = vocab.find(t);
+    }
+    if (!found || is_special_id(x)) {
+	return unk;
+    }
+    return x;
+}
+
+template<typename Map_T>
+bool is_special_token(const Map_T& vocab, const std::string& s) {
+    bool found;
+    Index_T x;
+    std::tie(found, x) = vocab.find(s);
+    return found && is_special_id(x);
+}
+
+/*!
+ *  Transform each token that is not special, leaving special tokens as is
+ */
+template<typename Map_T, typename TransformFn>
+TokenList_T apply_tokens(const Map_T& vocab, const TokenList_T& tokens, const TransformFn& transform) {
+    TokenList_T output;
+    output.reserve(tokens.size());
+    for (auto& s : tokens) {
+	if (is_special_token(vocab, s)) {
+	    output.push_back(s);
+	}
+	else {
+	    output.push_back(apply_transform(transform, s));
+	}
+    }
+    return output;
+}
+
+/*!
+ *  Fold the appended-token delta of a compiled vocab directory into a new
+ *  base, writing a fresh compiled directory.  BPE codes, if present, are
+ *  copied over unchanged
+ */
+void compact_vocab(const std::string& dir, const std::string& target_dir) {
+    if (!file_exists(target_dir)) {
+	make_dir(target_dir);
+    }
+    MapStrInt* vocab = read_vocab_mmap(dir);
+    compile_str_int(*vocab, file_in_dir(target_dir, "ph-vocab"));
+    delete vocab;
+    for (auto store : {"ph-codes", "ph-rcodes"}) {
+	auto src = file_in_dir(dir, store);
+	if (file_exists(src)) {
+	    copy_compiled(src, file_in_dir(target_dir, store));
+	}
+    }
+}
+/*!
+ *  Read a vocab file with one token per line, where the token is the first
+ *  space-separated field (so fastBPE "token count" lines work as well).
+ *  The file is memory-mapped and, when large, split into line-aligned
+ *  chunks that are parsed and hashed in parallel, then inserted in file
+ *  order into a table reserved up front.  The id of a token is its line
+ *  number plus offset
+ */
+MapStrInt* read_vocab_file(const std::string& infile, int offset=4, size_t num_threads=0)
 {
     if (is_dir(infile)) {
 	return read_vocab_mmap(infile);
     }
-    std::ifstream f(infile.c_str());
-    if (!f.is_open()) {
-        throw std::runtime_error(std::string("No file: ") + infile);
+    struct Entry {
+	StringView_T token;
+	uint64_t hash;
+    };
+    MappedFile f(infile);
+    std::vector<std::vector<Entry> > chunks(num_threads ? num_threads : default_num_threads());
+    parallel_line_chunks(f.data(), f.size(), chunks.size(),
+			 [&chunks](size_t c, const char* p, const char* end) {
+	auto& out = chunks[c];
+	out.reserve(count_newlines(p, end) + 1);
+	StringView_T fields[1];
+	while (p < end) {
+	    const char* eol = find_newline(p, end);
+	    if (split_fields(p, eol, fields, 1) > 0) {
+		out.push_back({fields[0], UnorderedMapStrInt::hash(fields[0])});
+	    }
+	    p = (eol < end) ? eol + 1 : end;
+	}
+    });
+    size_t total = 0;
+    for (auto& chunk : chunks) {
+	total += chunk.size();
     }
-    std::string line;
-    int i = 0;
     UnorderedMapStrInt* vocab = new UnorderedMapStrInt();
-    while (getline(f, line)) {
-	auto vecs = split(line);
-	auto token = vecs[0];
-	(*vocab)[token] = i + offset;
-	++i;
-
-	
+    vocab->reserve(total, f.size());
+    Index_T i = 0;
+    for (auto& chunk : chunks) {
+	for (auto& e : chunk) {
+	    auto r = vocab->try_emplace(e.token, e.hash, i + offset);
+	    if (!r.second) {
+		*r.first = i + offset;
+	    }
+	    ++i;
+	}
     }
-    f.close();
     return vocab;
 }
 
@@ -91,6 +252,7 @@ public:
 	return counter;
     }
 
+    virtual std::tuple<VecList_T, VecList_T> convert_to_ids_stack(const ListTokenMapList_T& list_tokens, long unsigned int len) const = 0;
 };
 
 std::string map_token_to_str(const TokenMap_T& token, const TokenList_T& fields, const std::string& delim) {
@@ -113,11 +275,68 @@ std::string map_token_to_str(const TokenMap_T& token, const TokenList_T& fields,
 
 class Vocab
 {
+    mutable std::mutex _shared_lock;
+    // Compiled copies made by shared_dir(), oldest first, see _shared_dir
+    mutable std::vector<std::string> _temp_dirs;
+    mutable size_t _temp_size;
+protected:
+    // The compiled directory this was read from, if it was, and its size then
+    std::string _compiled_dir;
+    size_t _compiled_size;
+
+    /*!
+     * shared_dir() for a vocab held in table: the directory it was read
+     * from, unless tokens were added since, or else a copy compiled into a
+     * temporary directory on first use (and again after tokens are added).
+     * Every copy is the whole vocab, so only the current one and the one
+     * before it are kept, for a pickle or handle that may still be on its
+     * way to another process.  Anything that has mapped a copy keeps it
+     * readable once it is removed (but see remove_dir on Windows)
+     */
+    std::string _shared_dir(const MapStrInt& table) const {
+	if (!_compiled_dir.empty() && table.size() == _compiled_size) {
+	    return _compiled_dir;
+	}
+	std::lock_guard<std::mutex> guard(_shared_lock);
+	if (_temp_dirs.empty() || _temp_size != table.size()) {
+	    auto dir = make_temp_dir("vecxx-");
+	    try {
+		QuietCompile quiet;
+		compile_vocab(dir);
+	    }
+	    catch (...) {
+		remove_dir(dir);
+		throw;
+	    }
+	    _temp_dirs.push_back(dir);
+	    _temp_size = table.size();
+	    if (_temp_dirs.size() > 2) {
+		remove_dir(_temp_dirs.front());
+		_temp_dirs.erase(_temp_dirs.begin());
+	    }
+	}
+	return _temp_dirs.back();
+    }
 public:
-    Vocab() {}
-    virtual ~Vocab() {}
+    Vocab() : _temp_size(0), _compiled_size(0) {}
+    virtual ~Vocab() {
+	for (auto& dir : _temp_dirs) {
+	    remove_dir(dir);
+	}
+    }
     virtual Index_T lookup(const std::string& s, const Transform_T& transform) const = 0;
     virtual TokenList_T apply(const TokenList_T& tokens, const Transform_T& transform) const = 0;
+    /*!
+     * The same, with a TransformPipeline, which the vectorizers use.  The
+     * default calls the pipeline through a Transform_T, vocabs override
+     * these to run it without copying
+     */
+    virtual Index_T lookup(const std::string& s, const TransformPipeline& transform) const {
+	return lookup(s, Transform_T(std::cref(transform)));
+    }
+    virtual TokenList_T apply(const TokenList_T& tokens, const TransformPipeline& transform) const {
+	return apply(tokens, Transform_T(std::cref(transform)));
+    }
     virtual Index_T pad_id() const = 0;
     virtual Index_T start_id() const = 0;
     virtual Index_T end_id() const = 0;
@@ -126,8 +345,45 @@ public:
     virtual std::string start_str() const = 0;
     virtual std::string end_str() const = 0;
     virtual std::string unk_str() const = 0;
-    virtual void compile_vocab(const std::string& target_dir) const = 0;
+    /*!
+     * Compile the vocab into target_dir.  The offset width of the stores
+     * is picked from their size unless given (4 or 8 bytes)
+     */
+    virtual void compile_vocab(const std::string& target_dir, uint32_t offset_width=0) const = 0;
     virtual std::string rlookup(const Index_T&) const = 0;
+    virtual void add_tokens(const TokenList_T& tokens) = 0;
+    virtual void compile_delta(const std::string& target_dir) const = 0;
+    virtual const SpecialVocab_T& get_special_tokens() const = 0;
+    /*!
+     * A compiled directory holding this vocab, so that another process (a
+     * data loader worker, say) can map the same pages instead of building
+     * its own copy.  Load it with the same special tokens (see extra_tokens)
+     */
+    virtual std::string shared_dir() const = 0;
+    // The special tokens other than pad, start, end and unk, in id order
+    TokenList_T extra_tokens() const {
+	std::vector<std::pair<Index_T, std::string> > extra;
+	for (auto& kv : get_special_tokens()) {
+	    if (kv.first != pad_str() && kv.first != start_str() && kv.first != end_str() && kv.first != unk_str()) {
+		extra.push_back(std::make_pair(kv.second, kv.first));
+	    }
+	}
+	std::sort(extra.begin(), extra.end());
+	TokenList_T tokens;
+	for (auto& e : extra) {
+	    tokens.push_back(e.second);
+	}
+	return tokens;
+    }
+    /*!
+     * Pin the current version of this vocab.  A vectorizer takes one
+     * snapshot per call and uses it throughout, so a reload (see
+     * ReloadableVocab) can never mix two versions in one result.  Plain
+     * vocabs never change, so they return themselves without ownership
+     */
+    virtual std::shared_ptr<const Vocab> snapshot() const {
+	return std::shared_ptr<const Vocab>(std::shared_ptr<const Vocab>(), this);
+    }
 
 };
 class WordVocab : public Vocab
@@ -144,6 +400,7 @@ protected:
     std::string _unk_str;
 public:
     MapStrInt* vocab;
+    // For reference only, lookups use the flagged copies held in vocab
     SpecialVocab_T special_tokens;
     WordVocab(std::string vocab_file,
 	      Index_T pad = 0,
@@ -174,6 +431,11 @@ public:
 	}
 	   
 	vocab = read_vocab_file(vocab_file, _offset);
+	add_special_tokens(vocab, special_tokens);
+	if (is_dir(vocab_file)) {
+	    _compiled_dir = vocab_file;
+	    _compiled_size = vocab->size();
+	}
     }
     WordVocab(const TokenList_T& vocab_list,
 	      Index_T pad = 0,
@@ -210,6 +472,7 @@ public:
 	    ++_offset;
 	}
 	vocab = v;
+	add_special_tokens(vocab, special_tokens);
 	
     }
 
@@ -250,15 +513,80 @@ public:
 	    }
 	}
 	vocab = v;
+	add_special_tokens(vocab, special_tokens);
 	
     }
 
+    /*!
+     * Build from native corpus counts.  Tokens are kept if seen more than
+     * min_freq times, and if max_size is set, only that many of the most
+     * frequent ones.  Ids are assigned most frequent first
+     */
+    WordVocab(const CorpusCounter& counter,
+	      Index_T pad = 0,
+	      Index_T start = 1,
+	      Index_T end = 2,
+	      Index_T unk = 3,
+	      std::string pad_str = "<PAD>",
+	      std::string start_str = "<GO>",
+	      std::string end_str = "<EOS>",
+	      std::string unk_str = "<UNK>",
+	      const TokenList_T& extra_tokens = TokenList_T(),
+	      int min_freq=0,
+	      size_t max_size=0):
+	_pad_id(pad),
+	_start_id(start),
+	_end_id(end),
+	_unk_id(unk),
+	_pad_str(pad_str),
+	_start_str(start_str),
+	_end_str(end_str),
+	_unk_str(unk_str) {
+	special_tokens[_pad_str] = _pad_id;
+	special_tokens[_start_str] = _start_id;
+	special_tokens[_end_str] = _end_id;
+	special_tokens[_unk_str] = _unk_id;
+	_offset = std::max<uint32_t>({pad, start, end, unk}) + 1;
+	for (auto token : extra_tokens) {
+	    special_tokens[token] = _offset;
+	    ++_offset;
+	}
+	auto tokens = counter.top_k(max_size, min_freq);
+	auto v = new UnorderedMapStrInt();
+	v->reserve(tokens.size());
+	for (auto& token : tokens) {
+	    (*v)[token] = _offset;
+	    ++_offset;
+	}
+	vocab = v;
+	add_special_tokens(vocab, special_tokens);
+    }
+
     virtual ~WordVocab() {
 	delete vocab;
     }
-    virtual void compile_vocab(const std::string& target_dir) const
+    virtual void compile_vocab(const std::string& target_dir, uint32_t offset_width=0) const
     {
-	compile_str_int( (UnorderedMapStrInt&)(*vocab), join_path(target_dir, "ph-vocab"));
+	if (!file_exists(target_dir)) {
+	    make_dir(target_dir);
+	}
+	compile_str_int(*vocab, join_path(target_dir, "ph-vocab"), 80, 4, offset_width);
+    }
+    virtual void add_tokens(const TokenList_T& tokens) {
+	// _offset is past the special and extra tokens
+	auto overlay = overlay_vocab(vocab, _offset);
+	for (auto& token : tokens) {
+	    overlay->add(token);
+	}
+    }
+    virtual void compile_delta(const std::string& target_dir) const {
+	compile_vocab_delta(vocab, target_dir);
+    }
+    virtual const SpecialVocab_T& get_special_tokens() const {
+	return special_tokens;
+    }
+    virtual std::string shared_dir() const {
+	return _shared_dir(*vocab);
     }
 
     virtual Index_T pad_id() const { return _pad_id; }
@@ -271,35 +599,18 @@ public:
     virtual std::string unk_str() const { return _unk_str; }
     
     virtual Index_T lookup(const std::string& s, const Transform_T& transform) const {
-	auto p = special_tokens.find(s);
-	if (p != special_tokens.end()) {
-	    return p->second;
-	}
-	auto t = transform(s);
-	bool found;
-	Index_T x;
-	std::tie(found, x) = vocab->find(t);
-	if (!found) {
-	    return _unk_id;
-	}
-
-	return x;
+	return lookup_token(*vocab, s, transform, _unk_id);
+    }
+    virtual Index_T lookup(const std::string& s, const TransformPipeline& transform) const {
+	return lookup_token(*vocab, s, transform, _unk_id);
     }
 
 
     virtual TokenList_T apply(const TokenList_T& tokens, const Transform_T& transform) const {
-	TokenList_T output;
-	for (auto s : tokens) {
-	    auto p = special_tokens.find(s);
-	    if (p != special_tokens.end()) {
-		output.push_back(s);
-	    }
-	    else {
-		
-		output.push_back(transform(s));
-	    }
-	}
-	return output;
+	return apply_tokens(*vocab, tokens, transform);
+    }
+    virtual TokenList_T apply(const TokenList_T& tokens, const TransformPipeline& transform) const {
+	return apply_tokens(*vocab, tokens, transform);
     }
 
     virtual std::string rlookup(const Index_T& id) const {
@@ -314,6 +625,8 @@ class BPEVocab : public Vocab
 protected:
     Codes_T* _codes;
     RevCodes_T* _reversed_codes;
+    // The compiled directory the codes were read from, if they were
+    std::string _codes_dir;
     Index_T _pad_id;
     Index_T _start_id;
     Index_T _end_id;
@@ -325,6 +638,7 @@ protected:
     std::string _unk_str;
 public:
     MapStrInt* vocab;
+    // For reference only, lookups use the flagged copies held in vocab
     SpecialVocab_T special_tokens;
     BPEVocab(std::string vocab_file,
 	     std::string codes_file,
@@ -355,7 +669,15 @@ public:
 	    ++_offset;
 	}
 	vocab = read_vocab_file(vocab_file, _offset);
+	add_special_tokens(vocab, special_tokens);
 	read_codes_file(codes_file, _codes, _reversed_codes);
+	if (is_dir(codes_file)) {
+	    _codes_dir = codes_file;
+	}
+	if (is_dir(vocab_file) && vocab_file == codes_file) {
+	    _compiled_dir = vocab_file;
+	    _compiled_size = vocab->size();
+	}
     }
     virtual ~BPEVocab() {
 	delete vocab;
@@ -371,36 +693,48 @@ public:
     virtual std::string end_str() const { return _end_str; }
     virtual std::string unk_str() const { return _unk_str; }
     
-    virtual void compile_vocab(const std::string& target_dir) const
+    virtual void compile_vocab(const std::string& target_dir, uint32_t offset_width=0) const
     {
 	if (!file_exists(target_dir)) {
 	    make_dir(target_dir);
 	}
 	auto vocab_file = join_path(target_dir, "ph-vocab");
-	compile_str_int((UnorderedMapStrInt&)(*vocab),
-			vocab_file);
+	compile_str_int(*vocab, vocab_file, 80, 4, offset_width);
 	auto codes_file = join_path(target_dir, "ph-codes");
-	
-	compile_str_int((const UnorderedMapStrInt&)(*_codes),
-			codes_file);
 	auto rcodes_file = join_path(target_dir, "ph-rcodes");
+	if (!_codes_dir.empty()) {
+	    // Memory-mapped codes are already compiled
+	    copy_compiled(join_path(_codes_dir, "ph-codes"), codes_file);
+	    copy_compiled(join_path(_codes_dir, "ph-rcodes"), rcodes_file);
+	    return;
+	}
+	compile_str_int(*_codes, codes_file, 80, 4, offset_width);
 	compile_str_str((const UnorderedMapStrStr&)(*_reversed_codes),
-			rcodes_file);
+			rcodes_file, 80, 4, offset_width);
     }
-    virtual Index_T lookup(const std::string& s, const Transform_T& transform) const {
-	auto p = special_tokens.find(s);
-	if (p != special_tokens.end()) {
-	    return p->second;
+    virtual void add_tokens(const TokenList_T& tokens) {
+	// _offset is past the special and extra tokens
+	auto overlay = overlay_vocab(vocab, _offset);
+	for (auto& token : tokens) {
+	    overlay->add(token);
 	}
-	auto t = transform(s);
-	bool found;
-	Index_T x;
-	std::tie(found, x) = vocab->find(t);
-	if (!found) {
-	    return _unk_id;
-	}
-
-	return x;	
+    }
+    virtual void compile_delta(const std::string& target_dir) const {
+	compile_vocab_delta(vocab, target_dir);
+    }
+    virtual const SpecialVocab_T& get_special_tokens() const {
+	return special_tokens;
+    }
+    virtual std::string shared_dir() const {
+	return _shared_dir(*vocab);
+    }
+    const Codes_T& codes() const { return *_codes; }
+    const RevCodes_T& reversed_codes() const { return *_reversed_codes; }
+    virtual Index_T lookup(const std::string& s, const Transform_T& transform) const {
+	return lookup_token(*vocab, s, transform, _unk_id);
+    }
+    virtual Index_T lookup(const std::string& s, const TransformPipeline& transform) const {
+	return lookup_token(*vocab, s, transform, _unk_id);
     }
 
     virtual std::string rlookup(const Index_T& idx) const {
@@ -419,83 +753,400 @@ public:
 				 *_codes,
 				 *_reversed_codes,
 				 *vocab,
-				 special_tokens,
 				 transform);
 	
     }
+    virtual TokenList_T apply(const TokenList_T& tokens, const TransformPipeline& transform) const {
+	return _apply_bpe_single(tokens,
+				 *_codes,
+				 *_reversed_codes,
+				 *vocab,
+				 transform);
+    }
+};
+
+/*!
+ *  A vocab that can be swapped for a new version while it is in use, for
+ *  long-running servers picking up a retrained model.
+ *
+ *  The current version is held in a shared_ptr that is read and replaced
+ *  atomically (read-copy-update): a reload builds the new vocab off to the
+ *  side, typically mapping a compiled directory from a background thread,
+ *  and then publishes it with one atomic store.  Encodes already running
+ *  hold a snapshot, so they finish on the old version, which is freed when
+ *  the last of them lets go.
+ *
+ *  It is a BPEVocab if a codes file is given, otherwise a WordVocab, and
+ *  every version is loaded with the same special tokens
+ */
+class ReloadableVocab : public Vocab
+{
+protected:
+    std::shared_ptr<Vocab> _current;
+    std::atomic<size_t> _version;
+    Index_T _pad_id;
+    Index_T _start_id;
+    Index_T _end_id;
+    Index_T _unk_id;
+    std::string _pad_str;
+    std::string _start_str;
+    std::string _end_str;
+    std::string _unk_str;
+    TokenList_T _extra_tokens;
+    SpecialVocab_T _special_tokens;
+
+    Vocab* _load(const std::string& vocab_file, const std::string& codes_file) const {
+	if (codes_file.empty()) {
+	    return new WordVocab(vocab_file, _pad_id, _start_id, _end_id, _unk_id,
+				 _pad_str, _start_str, _end_str, _unk_str, _extra_tokens);
+	}
+	return new BPEVocab(vocab_file, codes_file, _pad_id, _start_id, _end_id, _unk_id,
+			    _pad_str, _start_str, _end_str, _unk_str, _extra_tokens);
+    }
+    std::shared_ptr<Vocab> _get() const {
+	return std::atomic_load(&_current);
+    }
+public:
+    ReloadableVocab(std::string vocab_file,
+		    std::string codes_file = "",
+		    Index_T pad = 0,
+		    Index_T start = 1,
+		    Index_T end = 2,
+		    Index_T unk = 3,
+		    std::string pad_str = "<PAD>",
+		    std::string start_str = "<GO>",
+		    std::string end_str = "<EOS>",
+		    std::string unk_str = "<UNK>",
+		    const TokenList_T& extra_tokens = TokenList_T() ):
+	_version(0),
+	_pad_id(pad),
+	_start_id(start),
+	_end_id(end),
+	_unk_id(unk),
+	_pad_str(pad_str),
+	_start_str(start_str),
+	_end_str(end_str),
+	_unk_str(unk_str),
+	_extra_tokens(extra_tokens) {
+	_current.reset(_load(vocab_file, codes_file));
+	_special_tokens = _current->get_special_tokens();
+    }
+    virtual ~ReloadableVocab() {}
+
+    /*!
+     * Load a new version and swap it in.  Lookups carry on against the
+     * current version while the new one loads.  If loading fails, the
+     * current version is kept and the error is thrown
+     */
+    void reload(const std::string& vocab_file, const std::string& codes_file = "") {
+	std::shared_ptr<Vocab> next(_load(vocab_file, codes_file));
+	std::atomic_store(&_current, next);
+	++_version;
+    }
+    // How many times this has been reloaded
+    size_t version() const { return _version; }
+
+    virtual std::shared_ptr<const Vocab> snapshot() const {
+	return _get();
+    }
+
+    virtual Index_T lookup(const std::string& s, const Transform_T& transform) const {
+	return _get()->lookup(s, transform);
+    }
+    virtual TokenList_T apply(const TokenList_T& tokens, const Transform_T& transform) const {
+	return _get()->apply(tokens, transform);
+    }
+    virtual Index_T lookup(const std::string& s, const TransformPipeline& transform) const {
+	return _get()->lookup(s, transform);
+    }
+    virtual TokenList_T apply(const TokenList_T& tokens, const TransformPipeline& transform) const {
+	return _get()->apply(tokens, transform);
+    }
+    virtual std::string rlookup(const Index_T& id) const {
+	return _get()->rlookup(id);
+    }
+    virtual Index_T pad_id() const { return _pad_id; }
+    virtual Index_T start_id() const { return _start_id; }
+    virtual Index_T end_id() const { return _end_id; }
+    virtual Index_T unk_id() const { return _unk_id; }
+    virtual std::string pad_str() const { return _pad_str; }
+    virtual std::string start_str() const { return _start_str; }
+    virtual std::string end_str() const { return _end_str; }
+    virtual std::string unk_str() const { return _unk_str; }
+    virtual const SpecialVocab_T& get_special_tokens() const {
+	return _special_tokens;
+    }
+    virtual void compile_vocab(const std::string& target_dir, uint32_t offset_width=0) const {
+	_get()->compile_vocab(target_dir, offset_width);
+    }
+    // The current version's
+    virtual std::string shared_dir() const {
+	return _get()->shared_dir();
+    }
+    // True if the versions are BPEVocabs
+    bool is_bpe() const {
+	return dynamic_cast<const BPEVocab*>(_get().get()) != NULL;
+    }
+    // Appended tokens only live in the current version, a reload drops them
+    virtual void add_tokens(const TokenList_T& tokens) {
+	_get()->add_tokens(tokens);
+    }
+    virtual void compile_delta(const std::string& target_dir) const {
+	_get()->compile_delta(target_dir);
+    }
 };
 
 class VocabVectorizer : public Vectorizer
 {
 protected:
     Vocab* _vocab;
-    Transform_T _transform;
+    TransformPipeline _transform;
     TokenList_T _emit_begin_tok;
     TokenList_T _emit_end_tok;
+    // Splits raw text for encode_text, keeping the vocab's special tokens
+    PreTokenizer _pretokenizer;
+    // Threads to split batches over, see set_num_threads
+    RowThreads _threads;
+
+    /*!
+     * Run fn(begin, end) over the rows of a batch, in parallel chunks when
+     * that is allowed.  A Python or JS transform has to be called from the
+     * calling thread, so only native transforms go to the pool
+     */
+    template<typename Fn>
+    void _for_rows(size_t n, Fn fn) const {
+	_threads.for_rows(n, _transform.is_native(), fn);
+    }
+
+    // The tokens of row i of a batch, which may be split into the scratch list
+    typedef std::function<const TokenList_T&(size_t, TokenList_T&)> RowTokens_T;
+
+    /*!
+     * Run encode(i, scratch, row) for each of n rows in parallel, with an
+     * empty scratch list, then lay the rows out as convert_to_ids_ragged
+     * does
+     */
+    template<typename Encode>
+    void _ragged(size_t n, VecList_T& ids, VecList_T& offsets, Encode encode) const {
+	std::vector<VecList_T> rows(n);
+	_for_rows(n, [&](size_t begin, size_t end) {
+	    TokenList_T scratch;
+	    for (size_t i = begin; i < end; ++i) {
+		scratch.clear();
+		encode(i, scratch, rows[i]);
+	    }
+	});
+	size_t total = 0;
+	for (auto& row : rows) {
+	    total += row.size();
+	}
+	if (total > (size_t)std::numeric_limits<int>::max()) {
+	    throw std::runtime_error("Too many ids for 32-bit offsets");
+	}
+	ids.clear();
+	ids.reserve(total);
+	offsets.assign(1, 0);
+	offsets.reserve(n + 1);
+	for (auto& row : rows) {
+	    ids.insert(ids.end(), row.begin(), row.end());
+	    offsets.push_back((int)ids.size());
+	}
+    }
+
+    /*!
+     * Encode n rows without padding, at most max_len ids each, all on one
+     * snapshot of the vocab.  The specialized vectorizers override this
+     */
+    virtual void _ragged_rows(size_t n, const RowTokens_T& row_tokens, long unsigned int max_len, VecList_T& ids, VecList_T& offsets) const {
+	auto vocab = _vocab->snapshot();
+	_ragged(n, ids, offsets, [&](size_t i, TokenList_T& scratch, VecList_T& row) {
+	    TokenList_T pieces = _convert_to_pieces(*vocab, row_tokens(i, scratch));
+	    row.resize(max_len ? std::min<size_t>(max_len, pieces.size()) : pieces.size());
+	    for (size_t j = 0; j < row.size(); ++j) {
+		row[j] = vocab->lookup(pieces[j], _transform);
+	    }
+	});
+    }
+
+    /*!
+     * Encode n rows into a stack of len ids each, laid out as
+     * convert_to_ids_stack_into does, all on one snapshot of the vocab.
+     * The specialized vectorizers override this
+     */
+    virtual void _stack_rows(size_t n, const RowTokens_T& row_tokens, long unsigned int len, int* ids, int* lengths) const {
+	auto vocab = _vocab->snapshot();
+	const int pad = vocab->pad_id();
+	_for_rows(n, [&](size_t begin, size_t end) {
+	    TokenList_T scratch;
+	    for (size_t i = begin; i < end; ++i) {
+		scratch.clear();
+		TokenList_T pieces = _convert_to_pieces(*vocab, row_tokens(i, scratch));
+		auto insz = std::min<long unsigned int>(len, pieces.size());
+		lengths[i] = (int)insz;
+		int* row = ids + i * len;
+		for (size_t j = 0; j < insz; ++j) {
+		    row[j] = vocab->lookup(pieces[j], _transform);
+		}
+		std::fill(row + insz, row + len, pad);
+	    }
+	});
+    }
 public:
     VocabVectorizer(Vocab* vocab,
 		    const Transform_T& transform,
 		    const TokenList_T& emit_begin_tok = TokenList_T(),
 		    const TokenList_T& emit_end_tok = TokenList_T()
-	) : _vocab(vocab), _transform(transform), _emit_begin_tok(emit_begin_tok), _emit_end_tok(emit_end_tok) {
+	) : _vocab(vocab), _transform(transform), _emit_begin_tok(emit_begin_tok), _emit_end_tok(emit_end_tok),
+	    _pretokenizer(vocab->get_special_tokens()) {
 
     }
 
     VocabVectorizer(Vocab* vocab,
+		    const TransformPipeline& transform,
 		    const TokenList_T& emit_begin_tok = TokenList_T(),
 		    const TokenList_T& emit_end_tok = TokenList_T()
-	) :  _vocab(vocab), _emit_begin_tok(emit_begin_tok), _emit_end_tok(emit_end_tok) {
-	_transform = [](std::string s) -> std::string { return s; };
+	) : _vocab(vocab), _transform(transform), _emit_begin_tok(emit_begin_tok), _emit_end_tok(emit_end_tok),
+	    _pretokenizer(vocab->get_special_tokens()) {
+
+    }
+
+    VocabVectorizer(Vocab* vocab,
+		    const TokenList_T& emit_begin_tok = TokenList_T(),
+		    const TokenList_T& emit_end_tok = TokenList_T()
+	) :  _vocab(vocab), _emit_begin_tok(emit_begin_tok), _emit_end_tok(emit_end_tok),
+	     _pretokenizer(vocab->get_special_tokens()) {
     }
     virtual ~VocabVectorizer() {}
     
     virtual int piece_to_id(const std::string& s) const {
 	return _vocab->lookup(s, _transform);
     }
-    
-    virtual TokenList_T convert_to_pieces(const TokenList_T& tokens) const {
-	auto pieces = _vocab->apply(tokens, _transform);
+
+    // Everything below works on one snapshot of the vocab (see Vocab::snapshot)
+    TokenList_T _convert_to_pieces(const Vocab& vocab, const TokenList_T& tokens) const {
+	auto pieces = vocab.apply(tokens, _transform);
 	pieces.insert(pieces.begin(), _emit_begin_tok.begin(), _emit_begin_tok.end());
 	pieces.insert(pieces.end(), _emit_end_tok.begin(), _emit_end_tok.end());
 	return pieces;
+    }
 
+    virtual TokenList_T convert_to_pieces(const TokenList_T& tokens) const {
+	auto vocab = _vocab->snapshot();
+	return _convert_to_pieces(*vocab, tokens);
     }
     virtual std::tuple<VecList_T, long unsigned int> convert_to_ids(const TokenList_T& tokens, long unsigned int max_len=0) const {
 
-    	TokenList_T pieces = convert_to_pieces(tokens);
+	auto vocab = _vocab->snapshot();
+    	TokenList_T pieces = _convert_to_pieces(*vocab, tokens);
 	auto insz = pieces.size();
 	if (max_len <= 0) {
 	    max_len = insz;
 	}
 	auto sz = std::min<long unsigned int>(insz, max_len);
-	VecList_T ids(max_len, _vocab->pad_id());
+	VecList_T ids(max_len, vocab->pad_id());
         for (auto i = 0; i < sz; ++i) {
-	    ids[i] = piece_to_id(pieces[i]);
+	    ids[i] = vocab->lookup(pieces[i], _transform);
 	}
 	return std::make_tuple(ids, sz);
 	
     }
+    /*!
+     * Rows are encoded in parallel (see set_num_threads), each into its
+     * own slice of the output, so the result is the same however the rows
+     * are split
+     */
     virtual std::tuple<VecList_T, VecList_T> convert_to_ids_stack(const ListTokenList_T& list_tokens, long unsigned int len) const {
 
 	auto n = list_tokens.size();
-	VecList_T ids(len * n, _vocab->pad_id());
-	VecList_T lengths(n, 0);
-	for (auto i = 0; i < n; ++i) {
-	    TokenList_T pieces = convert_to_pieces(list_tokens[i]);
-	    auto insz = std::min<long unsigned int>(len, pieces.size());
-	    lengths[i] = (int)insz;
-	    for (auto j = 0; j < insz; ++j) {
-		ids[i * len + j] = piece_to_id(pieces[j]);
-	    }
-	}
+	VecList_T ids(len * n);
+	VecList_T lengths(n);
+	convert_to_ids_stack_into(list_tokens, len, ids.data(), lengths.data());
+	return std::make_tuple(ids, lengths);
+    }
+
+    /*!
+     * convert_to_ids_stack into buffers the caller owns, such as a NumPy
+     * array: ids holds list_tokens.size() rows of len, and lengths one
+     * entry per row.  Every entry is written, with the pad id after the
+     * end of each row
+     */
+    virtual void convert_to_ids_stack_into(const ListTokenList_T& list_tokens, long unsigned int len, int* ids, int* lengths) const {
+	_stack_rows(list_tokens.size(), [&list_tokens](size_t i, TokenList_T&) -> const TokenList_T& {
+		return list_tokens[i];
+	    }, len, ids, lengths);
+    }
+
+    /*!
+     * Encode rows without padding them, as an Arrow list array lays them
+     * out: the ids of row i go from ids[offsets[i]] to ids[offsets[i + 1]],
+     * at most max_len of them (0 for no limit).  Rows are encoded in
+     * parallel like convert_to_ids_stack
+     */
+    void convert_to_ids_ragged(const ListTokenList_T& list_tokens, long unsigned int max_len, VecList_T& ids, VecList_T& offsets) const {
+	_ragged_rows(list_tokens.size(), [&list_tokens](size_t i, TokenList_T&) -> const TokenList_T& {
+		return list_tokens[i];
+	    }, max_len, ids, offsets);
+    }
+
+    /*!
+     * Split batches over num_threads threads: 0 (the default) for the
+     * ThreadPool shared by the process, with a thread per core, and 1 to
+     * stay on the calling thread.  Set this before the vectorizer is used
+     * from more than one thread
+     */
+    void set_num_threads(size_t num_threads) { _threads.set_num_threads(num_threads); }
+    size_t num_threads() const { return _threads.num_threads(); }
+
+    Vocab* vocab() const { return _vocab; }
+    const TransformPipeline& transform() const { return _transform; }
+    const TokenList_T& emit_begin_tok() const { return _emit_begin_tok; }
+    const TokenList_T& emit_end_tok() const { return _emit_end_tok; }
+    const PreTokenizer& pretokenizer() const { return _pretokenizer; }
+    void set_pretokenizer(const PreTokenizer& pretokenizer) { _pretokenizer = pretokenizer; }
+
+    /*!
+     * Encode a whole sentence of raw UTF-8 text, split by the pretokenizer.
+     * By default this is the same as convert_to_ids on the text split on
+     * whitespace, except that special tokens are found even when they are
+     * not separated from the text around them
+     */
+    std::tuple<VecList_T, long unsigned int> encode_text(const std::string& text, long unsigned int max_len=0) const {
+	return convert_to_ids(_pretokenizer.tokenize(text), max_len);
+    }
+
+    /*!
+     * Encode a batch of raw sentences into a stack, one row of len ids
+     * each, as convert_to_ids_stack does with tokens
+     */
+    std::tuple<VecList_T, VecList_T> encode_text_stack(const TokenList_T& texts, long unsigned int len) const {
+	auto n = texts.size();
+	VecList_T ids(len * n);
+	VecList_T lengths(n);
+	encode_text_stack_into(texts, len, ids.data(), lengths.data());
 	return std::make_tuple(ids, lengths);
     }
+    // encode_text_stack into the caller's buffers, each text split on the thread encoding it
+    void encode_text_stack_into(const TokenList_T& texts, long unsigned int len, int* ids, int* lengths) const {
+	_stack_rows(texts.size(), [this, &texts](size_t i, TokenList_T& scratch) -> const TokenList_T& {
+		_pretokenizer.tokenize(texts[i], scratch);
+		return scratch;
+	    }, len, ids, lengths);
+    }
+
+    // convert_to_ids_ragged on raw sentences, each split by the pretokenizer on the thread encoding it
+    void encode_text_ragged(const TokenList_T& texts, long unsigned int max_len, VecList_T& ids, VecList_T& offsets) const {
+	_ragged_rows(texts.size(), [this, &texts](size_t i, TokenList_T& scratch) -> const TokenList_T& {
+		_pretokenizer.tokenize(texts[i], scratch);
+		return scratch;
+	    }, max_len, ids, offsets);
+    }
 
     std::string decode(const VecList_T& ids) const {
         // reverse look up each ids
+        auto vocab = _vocab->snapshot();
         std::vector<std::string> tokens;
         for (const auto & id : ids) {
-            tokens.push_back(this->_vocab->rlookup(id));
+            tokens.push_back(vocab->rlookup(id));
         }
         std::string rv;
         std::string separator = "@@";
@@ -512,15 +1163,260 @@ public:
     }
 };
 
+/*
+ * The concrete maps behind a vocab, for VocabVectorizerT: in-memory tables
+ * for a vocab read from text files, and memory-mapped perfect hashes (with
+ * 32-bit offsets) for a compiled one
+ */
+struct InMemoryMaps {
+    typedef StaticMap<UnorderedMapStrInt> vocab_map;
+    typedef StaticMap<UnorderedMapStrInt> codes_map;
+    typedef StaticMap<UnorderedMapStrStr> rev_codes_map;
+};
+struct CompiledMaps {
+    typedef StaticOverlayMap<PerfectHashMapStrInt> vocab_map;
+    typedef StaticMap<PerfectHashMapStrInt> codes_map;
+    typedef StaticMap<PerfectHashMapStrStr> rev_codes_map;
+};
+
+/*!
+ *  The maps of a WordVocab or BPEVocab, bound as MapType's types
+ */
+template<typename MapType>
+struct VocabMaps {
+    typename MapType::vocab_map vocab;
+    typename MapType::codes_map codes;
+    typename MapType::rev_codes_map reversed_codes;
+
+    // False if the vocab is not held in MapType's maps
+    bool bind(const WordVocab& v) {
+	return vocab.bind(v.vocab);
+    }
+    bool bind(const BPEVocab& v) {
+	return vocab.bind(v.vocab) && codes.bind(&v.codes()) && reversed_codes.bind(&v.reversed_codes());
+    }
+};
+
+/*!
+ *  A VocabVectorizer with the vocab type, its maps and the transform fixed
+ *  at compile time, so that the per-token work inlines instead of going
+ *  through Vocab::lookup, MapStrInt::find and the transform's steps.
+ *
+ *  VocabType is WordVocab or BPEVocab, MapType is InMemoryMaps or
+ *  CompiledMaps, and TransformPolicy is IdentityTransform or
+ *  LowerTransform.  The types are checked on each call against the vocab
+ *  snapshot it works on.  When they do not hold (after a reload to a
+ *  different kind of vocab, or add_tokens on an in-memory one), the call
+ *  takes the generic VocabVectorizer path, which gives the same results.
+ *  See make_vocab_vectorizer for picking one
+ */
+template<typename VocabType, typename MapType, typename TransformPolicy>
+class VocabVectorizerT : public VocabVectorizer
+{
+protected:
+    TransformPolicy _policy;
+
+    static const VocabType* _bind(const Vocab& vocab, VocabMaps<MapType>& maps) {
+	auto v = dynamic_cast<const VocabType*>(&vocab);
+	return (v != NULL && maps.bind(*v)) ? v : NULL;
+    }
+    TokenList_T _apply(const WordVocab&, const VocabMaps<MapType>& maps, const TokenList_T& tokens) const {
+	return apply_tokens(maps.vocab, tokens, _policy);
+    }
+    TokenList_T _apply(const BPEVocab&, const VocabMaps<MapType>& maps, const TokenList_T& tokens) const {
+	return _apply_bpe_single(tokens, maps.codes, maps.reversed_codes, maps.vocab, _policy);
+    }
+    TokenList_T _convert_to_pieces(const VocabType& vocab, const VocabMaps<MapType>& maps, const TokenList_T& tokens) const {
+	auto pieces = _apply(vocab, maps, tokens);
+	pieces.insert(pieces.begin(), _emit_begin_tok.begin(), _emit_begin_tok.end());
+	pieces.insert(pieces.end(), _emit_end_tok.begin(), _emit_end_tok.end());
+	return pieces;
+    }
+    virtual void _ragged_rows(size_t n, const RowTokens_T& row_tokens, long unsigned int max_len, VecList_T& ids, VecList_T& offsets) const {
+	auto vocab = _vocab->snapshot();
+	VocabMaps<MapType> maps;
+	auto v = _bind(*vocab, maps);
+	if (v == NULL) {
+	    VocabVectorizer::_ragged_rows(n, row_tokens, max_len, ids, offsets);
+	    return;
+	}
+	const Index_T unk = v->unk_id();
+	_ragged(n, ids, offsets, [&](size_t i, TokenList_T& scratch, VecList_T& row) {
+	    TokenList_T pieces = _convert_to_pieces(*v, maps, row_tokens(i, scratch));
+	    row.resize(max_len ? std::min<size_t>(max_len, pieces.size()) : pieces.size());
+	    for (size_t j = 0; j < row.size(); ++j) {
+		row[j] = lookup_token(maps.vocab, pieces[j], _policy, unk);
+	    }
+	});
+    }
+    virtual void _stack_rows(size_t n, const RowTokens_T& row_tokens, long unsigned int len, int* ids, int* lengths) const {
+	auto vocab = _vocab->snapshot();
+	VocabMaps<MapType> maps;
+	auto v = _bind(*vocab, maps);
+	if (v == NULL) {
+	    VocabVectorizer::_stack_rows(n, row_tokens, len, ids, lengths);
+	    return;
+	}
+	const Index_T unk = v->unk_id();
+	const int pad = v->pad_id();
+	_for_rows(n, [&](size_t begin, size_t end) {
+	    TokenList_T scratch;
+	    for (size_t i = begin; i < end; ++i) {
+		scratch.clear();
+		TokenList_T pieces = _convert_to_pieces(*v, maps, row_tokens(i, scratch));
+		auto insz = std::min<long unsigned int>(len, pieces.size());
+		lengths[i] = (int)insz;
+		int* row = ids + i * len;
+		for (size_t j = 0; j < insz; ++j) {
+		    row[j] = lookup_token(maps.vocab, pieces[j], _policy, unk);
+		}
+		std::fill(row + insz, row + len, pad);
+	    }
+	});
+    }
+public:
+    VocabVectorizerT(Vocab* vocab,
+		     const TokenList_T& emit_begin_tok = TokenList_T(),
+		     const TokenList_T& emit_end_tok = TokenList_T()
+	) : VocabVectorizer(vocab, TransformPolicy::pipeline(), emit_begin_tok, emit_end_tok) {
+    }
+    virtual ~VocabVectorizerT() {}
+
+    // True if calls on the vocab as it is now take the specialized path
+    static bool accepts(const Vocab& vocab) {
+	VocabMaps<MapType> maps;
+	return _bind(*vocab.snapshot(), maps) != NULL;
+    }
+
+    virtual int piece_to_id(const std::string& s) const {
+	auto vocab = _vocab->snapshot();
+	VocabMaps<MapType> maps;
+	auto v = _bind(*vocab, maps);
+	if (v == NULL) {
+	    return VocabVectorizer::piece_to_id(s);
+	}
+	return lookup_token(maps.vocab, s, _policy, v->unk_id());
+    }
+
+    virtual TokenList_T convert_to_pieces(const TokenList_T& tokens) const {
+	auto vocab = _vocab->snapshot();
+	VocabMaps<MapType> maps;
+	auto v = _bind(*vocab, maps);
+	if (v == NULL) {
+	    return VocabVectorizer::_convert_to_pieces(*vocab, tokens);
+	}
+	return _convert_to_pieces(*v, maps, tokens);
+    }
+
+    virtual std::tuple<VecList_T, long unsigned int> convert_to_ids(const TokenList_T& tokens, long unsigned int max_len=0) const {
+	auto vocab = _vocab->snapshot();
+	VocabMaps<MapType> maps;
+	auto v = _bind(*vocab, maps);
+	if (v == NULL) {
+	    return VocabVectorizer::convert_to_ids(tokens, max_len);
+	}
+	TokenList_T pieces = _convert_to_pieces(*v, maps, tokens);
+	auto insz = pieces.size();
+	if (max_len <= 0) {
+	    max_len = insz;
+	}
+	auto sz = std::min<long unsigned int>(insz, max_len);
+	const Index_T unk = v->unk_id();
+	VecList_T ids(max_len, v->pad_id());
+	for (size_t i = 0; i < sz; ++i) {
+	    ids[i] = lookup_token(maps.vocab, pieces[i], _policy, unk);
+	}
+	return std::make_tuple(ids, sz);
+    }
+};
+
+template<typename VocabType, typename MapType>
+VocabVectorizer* _make_vocab_vectorizer(Vocab* vocab,
+					const TransformPipeline& transform,
+					const TokenList_T& emit_begin_tok,
+					const TokenList_T& emit_end_tok) {
+    if (IdentityTransform::matches(transform)) {
+	return new VocabVectorizerT<VocabType, MapType, IdentityTransform>(vocab, emit_begin_tok, emit_end_tok);
+    }
+    if (LowerTransform::matches(transform)) {
+	return new VocabVectorizerT<VocabType, MapType, LowerTransform>(vocab, emit_begin_tok, emit_end_tok);
+    }
+    return new VocabVectorizer(vocab, transform, emit_begin_tok, emit_end_tok);
+}
+
+template<typename VocabType>
+VocabVectorizer* _make_vocab_vectorizer(const VocabType& current,
+					Vocab* vocab,
+					const TransformPipeline& transform,
+					const TokenList_T& emit_begin_tok,
+					const TokenList_T& emit_end_tok) {
+    VocabMaps<CompiledMaps> compiled;
+    if (compiled.bind(current)) {
+	return _make_vocab_vectorizer<VocabType, CompiledMaps>(vocab, transform, emit_begin_tok, emit_end_tok);
+    }
+    VocabMaps<InMemoryMaps> in_memory;
+    if (in_memory.bind(current)) {
+	return _make_vocab_vectorizer<VocabType, InMemoryMaps>(vocab, transform, emit_begin_tok, emit_end_tok);
+    }
+    return new VocabVectorizer(vocab, transform, emit_begin_tok, emit_end_tok);
+}
+
+/*!
+ *  A new VocabVectorizer, specialized at compile time (see
+ *  VocabVectorizerT) when the vocab is a WordVocab or BPEVocab, compiled
+ *  or not, and the transform is the identity or "lower".  Anything else
+ *  gets the generic VocabVectorizer.  The caller owns the result
+ */
+VocabVectorizer* make_vocab_vectorizer(Vocab* vocab,
+				       const TransformPipeline& transform = TransformPipeline(),
+				       const TokenList_T& emit_begin_tok = TokenList_T(),
+				       const TokenList_T& emit_end_tok = TokenList_T()) {
+    auto current = vocab->snapshot();
+    auto bpe = dynamic_cast<const BPEVocab*>(current.get());
+    if (bpe != NULL) {
+	return _make_vocab_vectorizer(*bpe, vocab, transform, emit_begin_tok, emit_end_tok);
+    }
+    auto word = dynamic_cast<const WordVocab*>(current.get());
+    if (word != NULL) {
+	return _make_vocab_vectorizer(*word, vocab, transform, emit_begin_tok, emit_end_tok);
+    }
+    return new VocabVectorizer(vocab, transform, emit_begin_tok, emit_end_tok);
+}
+
 class VocabMapVectorizer : public MapVectorizer
 {
 protected:
     Vocab* _vocab;
-    Transform_T _transform;
+    TransformPipeline _transform;
     TokenList_T _emit_begin_tok;
     TokenList_T _emit_end_tok;
     TokenList_T _fields;
     std::string _delim;
+    // Threads to split batches over, see set_num_threads
+    RowThreads _threads;
+
+    /*!
+     * Encode n rows into rows of len in ids, padded, with the length of
+     * each in lengths, where pieces(vocab, i) gives the pieces of row i.
+     * The rows are split over threads as VocabVectorizer splits a stack
+     */
+    template<typename Pieces>
+    void _stack_into(size_t n, long unsigned int len, int* ids, int* lengths, Pieces pieces) const {
+	auto vocab = _vocab->snapshot();
+	const int pad = vocab->pad_id();
+	_threads.for_rows(n, _transform.is_native(), [&](size_t begin, size_t end) {
+	    for (size_t i = begin; i < end; ++i) {
+		TokenList_T row_pieces = pieces(*vocab, i);
+		auto insz = std::min<long unsigned int>(len, row_pieces.size());
+		lengths[i] = (int)insz;
+		int* row = ids + i * len;
+		for (size_t j = 0; j < insz; ++j) {
+		    row[j] = vocab->lookup(row_pieces[j], _transform);
+		}
+		std::fill(row + insz, row + len, pad);
+	    }
+	});
+    }
 public:
     VocabMapVectorizer(Vocab* vocab,
 		       const Transform_T& transform,
@@ -535,13 +1431,25 @@ public:
 
     }
 
+    VocabMapVectorizer(Vocab* vocab,
+		       const TransformPipeline& transform,
+		       const TokenList_T& emit_begin_tok = TokenList_T(),
+		       const TokenList_T& emit_end_tok = TokenList_T(),
+		       const TokenList_T& fields = TokenList_T(),
+		       std::string delim="~~"
+	) : _vocab(vocab), _transform(transform), _emit_begin_tok(emit_begin_tok), _emit_end_tok(emit_end_tok), _fields(fields), _delim(delim) {
+	if (_fields.empty()) {
+	    _fields.push_back("text");
+	}
+
+    }
+
     VocabMapVectorizer(Vocab* vocab,
 		       const TokenList_T& emit_begin_tok = TokenList_T(),
 		       const TokenList_T& emit_end_tok = TokenList_T(),
 		       const TokenList_T& fields = TokenList_T(),
 		       std::string delim="~~"
 	) :  _vocab(vocab), _emit_begin_tok(emit_begin_tok), _emit_end_tok(emit_end_tok), _fields(fields), _delim(delim) {
-	_transform = [](std::string s) -> std::string { return s; };
 	if (_fields.empty()) {
 	    _fields.push_back("text");
 	}
@@ -561,31 +1469,129 @@ public:
 	}
 
     }
-    
-    virtual TokenList_T convert_to_pieces(const TokenMapList_T& tokens) const {
-	TokenList_T token_list;
-	_convert_to_tokens(tokens, token_list);
-	auto pieces = _vocab->apply(token_list, _transform);
+
+    /*!
+     * The same tokens as _convert_to_tokens, from columns laid out as a
+     * struct of arrays: columns[j][i] is field j (in _fields order) of
+     * token i.  Each token is joined in one reused buffer, with no map
+     */
+    void _join_columns(const ListTokenList_T& columns, TokenList_T& token_list) const {
+	if (columns.size() != _fields.size()) {
+	    throw std::runtime_error("Expected a column for each of the " + std::to_string(_fields.size()) + " fields");
+	}
+	size_t n = columns.empty() ? 0 : columns[0].size();
+	for (auto& column : columns) {
+	    if (column.size() != n) {
+		throw std::runtime_error("The columns must all be the same length");
+	    }
+	}
+	token_list.reserve(token_list.size() + n);
+	std::string buffer;
+	for (size_t i = 0; i < n; ++i) {
+	    buffer.assign(columns[0][i]);
+	    for (size_t j = 1; j < columns.size(); ++j) {
+		buffer.append(_delim);
+		buffer.append(columns[j][i]);
+	    }
+	    token_list.push_back(buffer);
+	}
+    }
+
+    TokenList_T _tokens_to_pieces(const Vocab& vocab, const TokenList_T& token_list) const {
+	auto pieces = vocab.apply(token_list, _transform);
 	pieces.insert(pieces.begin(), _emit_begin_tok.begin(), _emit_begin_tok.end());
 	pieces.insert(pieces.end(), _emit_end_tok.begin(), _emit_end_tok.end());
 	return pieces;
-
     }
-    virtual std::tuple<VecList_T, long unsigned int> convert_to_ids(const TokenMapList_T& tokens, long unsigned int max_len=0) const {
 
-    	TokenList_T pieces = convert_to_pieces(tokens);
+    std::tuple<VecList_T, long unsigned int> _pieces_to_ids(const Vocab& vocab, const TokenList_T& pieces, long unsigned int max_len) const {
 	auto insz = pieces.size();
 	if (max_len <= 0) {
 	    max_len = insz;
 	}
 	auto sz = std::min<long unsigned int>(insz, max_len);
-	VecList_T ids(max_len, _vocab->pad_id());
-        for (auto i = 0; i < sz; ++i) {
-	    ids[i] = piece_to_id(pieces[i]);
+	VecList_T ids(max_len, vocab.pad_id());
+	for (size_t i = 0; i < sz; ++i) {
+	    ids[i] = vocab.lookup(pieces[i], _transform);
 	}
 	return std::make_tuple(ids, sz);
-	
     }
+
+    TokenList_T _convert_to_pieces(const Vocab& vocab, const TokenMapList_T& tokens) const {
+	TokenList_T token_list;
+	_convert_to_tokens(tokens, token_list);
+	return _tokens_to_pieces(vocab, token_list);
+    }
+
+    TokenList_T _convert_to_pieces_columns(const Vocab& vocab, const ListTokenList_T& columns) const {
+	TokenList_T token_list;
+	_join_columns(columns, token_list);
+	return _tokens_to_pieces(vocab, token_list);
+    }
+
+    virtual TokenList_T convert_to_pieces(const TokenMapList_T& tokens) const {
+	auto vocab = _vocab->snapshot();
+	return _convert_to_pieces(*vocab, tokens);
+    }
+    virtual std::tuple<VecList_T, long unsigned int> convert_to_ids(const TokenMapList_T& tokens, long unsigned int max_len=0) const {
+
+	auto vocab = _vocab->snapshot();
+	return _pieces_to_ids(*vocab, _convert_to_pieces(*vocab, tokens), max_len);
+    }
+
+    /*!
+     * convert_to_pieces for a sequence given as one column per field (see
+     * _join_columns), which gives the same pieces as the maps would
+     */
+    TokenList_T convert_to_pieces_columns(const ListTokenList_T& columns) const {
+	auto vocab = _vocab->snapshot();
+	return _convert_to_pieces_columns(*vocab, columns);
+    }
+    // convert_to_ids for columns, see convert_to_pieces_columns
+    std::tuple<VecList_T, long unsigned int> convert_to_ids_columns(const ListTokenList_T& columns, long unsigned int max_len=0) const {
+	auto vocab = _vocab->snapshot();
+	return _pieces_to_ids(*vocab, _convert_to_pieces_columns(*vocab, columns), max_len);
+    }
+
+    /*!
+     * Encode a batch of sequences into rows of len ids, padded, as
+     * VocabVectorizer::convert_to_ids_stack does, with rows in parallel
+     */
+    virtual std::tuple<VecList_T, VecList_T> convert_to_ids_stack(const ListTokenMapList_T& list_tokens, long unsigned int len) const {
+	auto n = list_tokens.size();
+	VecList_T ids(len * n);
+	VecList_T lengths(n);
+	convert_to_ids_stack_into(list_tokens, len, ids.data(), lengths.data());
+	return std::make_tuple(ids, lengths);
+    }
+
+    // convert_to_ids_stack into buffers the caller owns, see VocabVectorizer
+    void convert_to_ids_stack_into(const ListTokenMapList_T& list_tokens, long unsigned int len, int* ids, int* lengths) const {
+	_stack_into(list_tokens.size(), len, ids, lengths, [&](const Vocab& vocab, size_t i) {
+	    return _convert_to_pieces(vocab, list_tokens[i]);
+	});
+    }
+
+    // convert_to_ids_stack for sequences given as columns, see convert_to_pieces_columns
+    std::tuple<VecList_T, VecList_T> convert_to_ids_columns_stack(const ListColumns_T& list_columns, long unsigned int len) const {
+	auto n = list_columns.size();
+	VecList_T ids(len * n);
+	VecList_T lengths(n);
+	convert_to_ids_columns_stack_into(list_columns, len, ids.data(), lengths.data());
+	return std::make_tuple(ids, lengths);
+    }
+
+    void convert_to_ids_columns_stack_into(const ListColumns_T& list_columns, long unsigned int len, int* ids, int* lengths) const {
+	_stack_into(list_columns.size(), len, ids, lengths, [&](const Vocab& vocab, size_t i) {
+	    return _convert_to_pieces_columns(vocab, list_columns[i]);
+	});
+    }
+
+    // See VocabVectorizer::set_num_threads
+    void set_num_threads(size_t num_threads) { _threads.set_num_threads(num_threads); }
+    size_t num_threads() const { return _threads.num_threads(); }
+
+    const TransformPipeline& transform() const { return _transform; }
 };
 
 
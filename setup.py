@@ -43,7 +43,15 @@ setup(
         'vecxx': [
             'include/vecxx/vecxx.h',
             'include/vecxx/bpe.h',
-            'include/vecxx/utils.h'
+            'include/vecxx/utils.h',
+            'include/vecxx/flat.h',
+            'include/vecxx/count.h',
+            'include/vecxx/scan.h',
+            'include/vecxx/unicode.h',
+            'include/vecxx/unicode_tables.h',
+            'include/vecxx/transform.h',
+            'include/vecxx/pool.h',
+            'include/vecxx/arrow.h'
         ]
     },
     include_package_data=True,
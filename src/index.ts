@@ -4,16 +4,86 @@ const vecxx = bindings('vecxx');
 const {
     Vocab: VocabBinding,
     VocabVectorizer: VocabVectorizerBinding,
-    VocabMapVectorizer: VocabMapVectorizerBinding
+    VocabMapVectorizer: VocabMapVectorizerBinding,
+    SpecialTokenScanner: SpecialTokenScannerBinding,
+    countCorpus: countCorpusBinding
 } = vecxx;
 
 export type Token = string;
 export type Tokens = Token[];
-export type TokenIds = { ids: number[]; size: number };
+/**
+ * The ids of a sequence, padded out to maxLength, and how many of them are real
+ */
+export type TokenIds = { ids: Int32Array; size: number };
+/**
+ * The ids of a batch of sequences, flattened into rows of maxLength, and how many of each row are real
+ */
+export type StackedIds = { ids: Int32Array; lengths: Int32Array };
 export type Counter = Record<string, number>;
 
-export type TokenTransform = (s: Token) => Token;
-const identityTransform: TokenTransform = (s: Token) => s;
+/**
+ * The transforms that run natively, without calling back into JS for each token
+ */
+export type NativeTransform =
+    | 'identity'
+    | 'lower'
+    | 'casefold'
+    | 'nfc'
+    | 'nfd'
+    | 'nfkc'
+    | 'nfkd'
+    | 'strip_accents'
+    | 'remove_control'
+    | 'ascii_digits';
+/**
+ * Native transforms chained with '+', run in one pass, e.g. 'nfkc+casefold'
+ */
+export type TransformPipelineSpec = NativeTransform | `${NativeTransform}+${string}`;
+export type TokenTransform = ((s: Token) => Token) | TransformPipelineSpec;
+const identityTransform: TokenTransform = 'identity';
+export const nativeTransformNames: NativeTransform[] = vecxx.nativeTransformNames;
+
+export interface CorpusOptions {
+    splitter?: string;
+    /** A JS function is called on the main thread, so counting is then single-threaded */
+    transform?: TokenTransform;
+    /** Defaults to the number of cores */
+    numThreads?: number;
+}
+
+export interface CorpusVocabOptions extends CorpusOptions {
+    /** Keep tokens seen more than minFreq times */
+    minFreq?: number;
+    /** Keep at most this many of the most frequent tokens */
+    maxSize?: number;
+}
+
+/**
+ * Count the tokens in some text files natively
+ */
+export function countCorpus(files: string[], options?: CorpusOptions): Counter {
+    return countCorpusBinding(files, options ?? {}) as Counter;
+}
+
+/**
+ * What a worker thread needs to open a vocab made on another thread (see Vocab.handle).
+ * It is a plain object, so it can be passed through postMessage or workerData
+ */
+export interface VocabHandle {
+    /** A compiled directory, which every thread maps rather than copies */
+    dir: string;
+    bpe: boolean;
+    reloadable: boolean;
+    pad: number;
+    start: number;
+    end: number;
+    unk: number;
+    padStr: string;
+    startStr: string;
+    endStr: string;
+    unkStr: string;
+    extraTokens: Tokens;
+}
 
 export abstract class Vocab {
     protected constructor(public readonly binding: any) {}
@@ -21,6 +91,39 @@ export abstract class Vocab {
     public lookup(token: string, transform?: TokenTransform): number {
         return this.binding.lookup(token, transform ?? identityTransform);
     }
+
+    /** The token for an id.  A WordVocab cannot do this, and throws */
+    public rlookup(id: number): Token {
+        return this.binding.rlookup(id);
+    }
+
+    /** Write the vocab out as perfect hashes, which load by memory mapping (see the README) */
+    public compileVocab(targetDir: string): void {
+        this.binding.compileVocab(targetDir);
+    }
+
+    /**
+     * A handle to open this vocab from a worker thread with Vocab.fromHandle.  A vocab read from a
+     * compiled directory passes on that directory.  Otherwise it is compiled into a temporary
+     * directory the first time, which is removed along with this vocab
+     */
+    public handle(): VocabHandle {
+        return this.binding.handle();
+    }
+
+    /**
+     * Open a vocab from a handle made on another thread.  It maps the same files, so N threads
+     * share one copy of the vocab.  A reloadable vocab is reloaded separately on each thread
+     */
+    public static fromHandle(handle: VocabHandle): Vocab {
+        return new SharedVocab(handle);
+    }
+}
+
+class SharedVocab extends Vocab {
+    constructor(handle: VocabHandle) {
+        super(new VocabBinding('handle', handle));
+    }
 }
 
 export class BPEVocab extends Vocab {
@@ -29,41 +132,139 @@ export class BPEVocab extends Vocab {
     }
 }
 
+/**
+ * A vocab that can be swapped for a new version while vectorizers are using it.
+ * It is a BPE vocab if a codes file is given, otherwise a word vocab
+ */
+export class ReloadableVocab extends Vocab {
+    constructor(vocabFile: string, codesFile?: string) {
+        super(new VocabBinding('reloadable', vocabFile, codesFile ?? ''));
+    }
+
+    /**
+     * Load a new version (typically a compiled directory) in the background and swap it in.
+     * Encodes in flight finish on the old version.  Resolves to the new version number
+     */
+    public reload(vocabFile: string, codesFile?: string): Promise<number> {
+        return this.binding.reload(vocabFile, codesFile ?? '');
+    }
+
+    public get version(): number {
+        return this.binding.version();
+    }
+}
+
+export type CorpusSource = { corpus: string[]; options?: CorpusVocabOptions };
+
+const isCorpusSource = (vocab: any): vocab is CorpusSource => Array.isArray(vocab?.corpus);
+
 export class WordVocab extends Vocab {
     /**
-     * @param vocab can be a filename, an array of Tokens or a Counter record
+     * @param vocab can be a filename, an array of Tokens, a Counter record or a list of corpus files to count
      */
-    constructor(vocab: string | Tokens | Counter) {
+    constructor(vocab: string | Tokens | Counter | CorpusSource) {
         super(
-            new VocabBinding(
-                Array.isArray(vocab) ? 'word-tokens' : typeof vocab === 'string' ? 'word-file' : 'word-counter',
-                vocab
-            )
+            isCorpusSource(vocab)
+                ? new VocabBinding('word-corpus', vocab.corpus, vocab.options ?? {})
+                : new VocabBinding(
+                      Array.isArray(vocab) ? 'word-tokens' : typeof vocab === 'string' ? 'word-file' : 'word-counter',
+                      vocab
+                  )
         );
     }
+
+    /**
+     * Build a vocab by counting the tokens in some text files natively, most frequent first
+     */
+    public static fromCorpus(files: string[], options?: CorpusVocabOptions): WordVocab {
+        return new WordVocab({ corpus: files, options });
+    }
+}
+
+export type TextSpan = { text: string; special: boolean };
+
+/**
+ * Finds special tokens in raw text natively, so they are kept whole when it is tokenized
+ */
+export class SpecialTokenScanner {
+    private proxy: any;
+
+    /**
+     * @param tokens a Vocab, to use its special and extra tokens, or a list of tokens
+     */
+    constructor(tokens: Vocab | Tokens) {
+        this.proxy = new SpecialTokenScannerBinding(Array.isArray(tokens) ? tokens : tokens.binding);
+    }
+
+    /**
+     * Split the text into special and ordinary spans
+     */
+    public scan(text: string): TextSpan[] {
+        return this.proxy.scan(text) as TextSpan[];
+    }
+
+    /**
+     * Split the text into tokens, keeping special tokens whole and splitting the rest on whitespace
+     */
+    public tokenize(text: string): Tokens {
+        return this.proxy.tokenize(text) as Tokens;
+    }
 }
 
 export interface Vectorizer {
     convertToPieces(tokens: Tokens): Tokens;
 
-    convertToIds(tokens: Tokens, maxLength?: number): TokenIds;
+    convertToIds(tokens: Tokens, maxLength?: number, out?: Int32Array): TokenIds;
 }
 
 interface VocabVectorizerOptions {
     transform?: TokenTransform;
     emitBeginToken?: Tokens;
     emitEndToken?: Tokens;
+    /**
+     * Cache the results of a JS transform, for at most this many tokens, so it is
+     * called once per distinct token rather than once per occurrence
+     */
+    memoize?: number;
+}
+
+/**
+ * How encodeText splits raw text: special tokens are kept whole, the rest is split on
+ * whitespace, and each punctuation character becomes a token of its own
+ */
+export interface PreTokenizerOptions {
+    /** Defaults to ASCII whitespace */
+    whitespace?: string;
+    /** Defaults to none */
+    punctuation?: string;
+    /** Defaults to true */
+    keepSpecialTokens?: boolean;
+}
+
+interface VocabTextVectorizerOptions extends VocabVectorizerOptions {
+    pretokenizer?: PreTokenizerOptions;
+}
+
+export interface TransformCacheStats {
+    hits: number;
+    misses: number;
+    evictions: number;
+    size: number;
+    capacity: number;
+    hitRate: number;
 }
 
 export class VocabVectorizer implements Vectorizer {
     private proxy: any;
 
-    constructor(private readonly vocab: Vocab, private readonly options?: VocabVectorizerOptions) {
+    constructor(private readonly vocab: Vocab, private readonly options?: VocabTextVectorizerOptions) {
         this.proxy = new VocabVectorizerBinding(
             vocab.binding,
             options?.transform ?? identityTransform,
             options?.emitBeginToken ?? [],
-            options?.emitEndToken ?? []
+            options?.emitEndToken ?? [],
+            options?.memoize ?? 0,
+            options?.pretokenizer ?? {}
         );
     }
 
@@ -71,8 +272,64 @@ export class VocabVectorizer implements Vectorizer {
         return this.proxy.convertToPieces(tokens);
     }
 
-    public convertToIds(tokens: Tokens, maxLength = 0): TokenIds {
-        return this.proxy.convertToIds(tokens, maxLength) as TokenIds;
+    /**
+     * @param out an Int32Array to write the ids into, rather than a new one.  If maxLength is 0
+     * the ids are padded out to its length
+     */
+    public convertToIds(tokens: Tokens, maxLength = 0, out?: Int32Array): TokenIds {
+        return this.proxy.convertToIds(tokens, maxLength, out) as TokenIds;
+    }
+
+    /**
+     * Convert a batch of sequences to rows of maxLength ids in one flat Int32Array
+     * @param out an Int32Array to write the ids into, rather than a new one.  If maxLength is 0
+     * the rows split it evenly
+     */
+    public convertToIdsStack(tokensList: Tokens[], maxLength = 0, out?: Int32Array): StackedIds {
+        return this.proxy.convertToIdsStack(tokensList, maxLength, out) as StackedIds;
+    }
+
+    /** Split a whole sentence natively (see PreTokenizerOptions) and convert it to ids */
+    public encodeText(text: string, maxLength = 0, out?: Int32Array): TokenIds {
+        return this.proxy.encodeText(text, maxLength, out) as TokenIds;
+    }
+
+    /** encodeText for a batch of sentences, laid out like convertToIdsStack */
+    public encodeTextStack(texts: string[], maxLength = 0, out?: Int32Array): StackedIds {
+        return this.proxy.encodeTextStack(texts, maxLength, out) as StackedIds;
+    }
+
+    /**
+     * convertToIds on a libuv worker thread, so the event loop keeps running.  The async methods need a
+     * native transform, since a JS function can only be called from the main thread
+     */
+    public convertToIdsAsync(tokens: Tokens, maxLength = 0): Promise<TokenIds> {
+        return this.proxy.convertToIdsAsync(tokens, maxLength);
+    }
+
+    /** convertToIdsStack on a libuv worker thread (see convertToIdsAsync) */
+    public convertToIdsStackAsync(tokensList: Tokens[], maxLength: number): Promise<StackedIds> {
+        return this.proxy.convertToIdsStackAsync(tokensList, maxLength);
+    }
+
+    /** The text for some ids, without special tokens and with BPE pieces joined back up */
+    public decode(ids: Int32Array | number[]): string {
+        return this.proxy.decode(ids);
+    }
+
+    /** How many times each piece occurs in the tokens */
+    public countPieces(tokens: Tokens): Counter {
+        return this.proxy.countPieces(tokens) as Counter;
+    }
+
+    /** encodeTextStack on a libuv worker thread (see convertToIdsAsync) */
+    public encodeTextStackAsync(texts: string[], maxLength: number): Promise<StackedIds> {
+        return this.proxy.encodeTextStackAsync(texts, maxLength);
+    }
+
+    /** How well the memoized transform cache is doing, or null without one */
+    public transformCacheStats(): TransformCacheStats | null {
+        return this.proxy.transformCacheStats();
     }
 }
 
@@ -81,7 +338,7 @@ export type TokenMap = Record<string, Token>;
 export interface MapVectorizer {
     convertToPieces(tokenMaps: TokenMap[]): Tokens;
 
-    convertToIds(tokenMaps: TokenMap[], maxLength?: number): TokenIds;
+    convertToIds(tokenMaps: TokenMap[], maxLength?: number, out?: Int32Array): TokenIds;
 }
 
 interface VocabMapVectorizerOptions extends VocabVectorizerOptions {
@@ -99,7 +356,8 @@ export class VocabMapVectorizer implements MapVectorizer {
             options?.emitBeginToken ?? [],
             options?.emitEndToken ?? [],
             options?.fields ?? ['text'],
-            options?.delim ?? '~~'
+            options?.delim ?? '~~',
+            options?.memoize ?? 0
         );
     }
 
@@ -107,7 +365,40 @@ export class VocabMapVectorizer implements MapVectorizer {
         return this.proxy.convertToPieces(tokenMaps);
     }
 
-    public convertToIds(tokenMaps: TokenMap[], maxLength = 0): TokenIds {
-        return this.proxy.convertToIds(tokenMaps, maxLength) as TokenIds;
+    public convertToIds(tokenMaps: TokenMap[], maxLength = 0, out?: Int32Array): TokenIds {
+        return this.proxy.convertToIds(tokenMaps, maxLength, out) as TokenIds;
+    }
+
+    /**
+     * convertToPieces for tokens given as one array per field, in the order of the fields,
+     * e.g. [words, tags] for fields ['text', 'pos'].  It gives the same pieces as the maps would
+     */
+    public convertToPiecesColumns(columns: Tokens[]): Tokens {
+        return this.proxy.convertToPiecesColumns(columns);
+    }
+
+    /** convertToIds for tokens given as one array per field (see convertToPiecesColumns) */
+    public convertToIdsColumns(columns: Tokens[], maxLength = 0, out?: Int32Array): TokenIds {
+        return this.proxy.convertToIdsColumns(columns, maxLength, out) as TokenIds;
+    }
+
+    /** Convert a batch of sequences to rows of maxLength ids, laid out like VocabVectorizer.convertToIdsStack */
+    public convertToIdsStack(tokenMapsList: TokenMap[][], maxLength = 0, out?: Int32Array): StackedIds {
+        return this.proxy.convertToIdsStack(tokenMapsList, maxLength, out) as StackedIds;
+    }
+
+    /** convertToIdsStack for a batch of sequences each given as columns (see convertToPiecesColumns) */
+    public convertToIdsColumnsStack(columnsList: Tokens[][], maxLength = 0, out?: Int32Array): StackedIds {
+        return this.proxy.convertToIdsColumnsStack(columnsList, maxLength, out) as StackedIds;
+    }
+
+    /** How many times each piece occurs in the tokens */
+    public countPieces(tokenMaps: TokenMap[]): Counter {
+        return this.proxy.countPieces(tokenMaps) as Counter;
+    }
+
+    /** How well the memoized transform cache is doing, or null without one */
+    public transformCacheStats(): TransformCacheStats | null {
+        return this.proxy.transformCacheStats();
     }
 }
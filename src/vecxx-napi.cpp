@@ -2,6 +2,10 @@
 #include <string>
 #include "vecxx/vecxx.h"
 
+/*
+ * Calls a JS transform.  The vectorizers keep one of these for their whole
+ * life, so the env is held by value, and the function must outlive it
+ */
 class TransformWrapper {
 public:
     TransformWrapper(const Napi::FunctionReference& ref, const Napi::Env& env) : ref(ref), env(env) {}
@@ -13,9 +17,85 @@ public:
 
 private:
     const Napi::FunctionReference& ref;
-    const Napi::Env& env;
+    Napi::Env env;
 };
 
+/*
+ * A transform given by name runs natively and never calls back into JS.
+ * Names can be chained with '+' ("nfkc+casefold", see TransformPipeline).
+ * Otherwise the JS function is wrapped, and if there is a cache, it is
+ * only called for tokens that are not already in it
+ */
+TransformPipeline toTransform(const Napi::FunctionReference &ref, const TransformPipeline &native, const Napi::Env &env,
+                              const std::shared_ptr<TransformCache> &cache = std::shared_ptr<TransformCache>()) {
+    if (ref.IsEmpty()) {
+        return native;
+    }
+    const TransformWrapper transformer(ref, env);
+    Transform_T transform = std::bind(&TransformWrapper::transform, transformer, std::placeholders::_1);
+    if (cache) {
+        transform = MemoizedTransform(transform, cache);
+    }
+    return TransformPipeline(transform);
+}
+
+/*
+ * A cache for a JS transform, if a capacity was given for one
+ */
+std::shared_ptr<TransformCache> toTransformCache(const Napi::Value &capacity) {
+    if (!capacity.IsNumber() || capacity.As<Napi::Number>().Int64Value() <= 0) {
+        return std::shared_ptr<TransformCache>();
+    }
+    return std::make_shared<TransformCache>((size_t)capacity.As<Napi::Number>().Int64Value());
+}
+
+Napi::Value fromTransformCacheStats(const std::shared_ptr<TransformCache> &cache, const Napi::Env &env) {
+    if (!cache) {
+        return env.Null();
+    }
+    TransformCacheStats stats = cache->stats();
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("hits", Napi::Number::New(env, (double)stats.hits));
+    obj.Set("misses", Napi::Number::New(env, (double)stats.misses));
+    obj.Set("evictions", Napi::Number::New(env, (double)stats.evictions));
+    obj.Set("size", Napi::Number::New(env, (double)stats.size));
+    obj.Set("capacity", Napi::Number::New(env, (double)stats.capacity));
+    obj.Set("hitRate", Napi::Number::New(env, stats.hit_rate()));
+    return obj;
+}
+
+/*
+ * Check a transform argument before it is built: a JS function, or native
+ * steps joined with '+' (see nativeTransformNames).  Anything else throws a
+ * TypeError, rather than letting TransformPipeline throw through N-API
+ */
+bool checkTransform(const Napi::Env &env, const Napi::Value &value) {
+    if (value.IsFunction()) {
+        return true;
+    }
+    if (!value.IsString()) {
+        Napi::TypeError::New(env, "A transform must be a function or a native transform name").ThrowAsJavaScriptException();
+        return false;
+    }
+    std::string spec = value.ToString();
+    TokenList_T names = native_transform_names();
+    size_t start = 0;
+    for (size_t i = 0; i <= spec.size(); ++i) {
+        if (i == spec.size() || spec[i] == '+') {
+            if (std::find(names.begin(), names.end(), spec.substr(start, i - start)) == names.end()) {
+                Napi::TypeError::New(env, "Unknown transform '" + spec + "', expected names from nativeTransformNames joined with '+'").ThrowAsJavaScriptException();
+                return false;
+            }
+            start = i + 1;
+        }
+    }
+    return true;
+}
+
+TransformPipeline toNativeTransform(const Napi::Value &value) {
+    return value.IsString() ? TransformPipeline((std::string) value.ToString()) : TransformPipeline();
+}
+
 TokenList_T toTokenList(const Napi::Array &arr) {
     auto length = arr.Length();
     TokenList_T vec(length);
@@ -52,16 +132,183 @@ Napi::Array fromTokenList(const TokenList_T &vec, const Napi::Env &env) {
     return arr;
 }
 
-Napi::Array fromIdsList(const VecList_T &vec, const Napi::Env &env) {
-    Napi::Array arr = Napi::Array::New(env, vec.size());
-    int i = 0;
-    for (auto it = std::begin(vec); it != std::end(vec); ++it) {
-        Napi::HandleScope scope(env);
-        arr[i++] = Napi::Number::New(env, *it);
+ListTokenList_T toListTokenList(const Napi::Array &arr) {
+    auto length = arr.Length();
+    ListTokenList_T vec(length);
+    for (auto i = 0; i < length; ++i) {
+        vec[i] = toTokenList(static_cast<Napi::Value>(arr[i]).As<Napi::Array>());
+    }
+    return vec;
+}
+
+/*
+ * An Int32Array over the ids, which are moved into an external ArrayBuffer
+ * that frees them when it is collected.  Where external buffers are not
+ * allowed, they are copied into an ordinary one
+ */
+Napi::Int32Array fromIds(VecList_T &&ids, const Napi::Env &env) {
+    size_t length = ids.size();
+    if (length > 0) {
+        auto owned = new VecList_T(std::move(ids));
+        napi_value buffer;
+        napi_status status = napi_create_external_arraybuffer(
+            env, owned->data(), length * sizeof(int),
+            [](napi_env, void*, void* hint) { delete (VecList_T*)hint; }, owned, &buffer);
+        if (status == napi_ok) {
+            return Napi::Int32Array::New(env, length, Napi::ArrayBuffer(env, buffer), 0);
+        }
+        ids = std::move(*owned);
+        delete owned;
     }
+    Napi::Int32Array arr = Napi::Int32Array::New(env, length);
+    std::copy(ids.begin(), ids.end(), arr.Data());
     return arr;
 }
 
+bool isInt32Array(const Napi::Value &value) {
+    return value.IsTypedArray() && value.As<Napi::TypedArray>().TypedArrayType() == napi_int32_array;
+}
+
+/*
+ * Check the Int32Array (if any) that a caller passed to fill with numRows
+ * rows of maxLength ids.  A maxLength of 0 means rows that fill all of it.
+ * Throws and returns false if it is not an Int32Array or is too short
+ */
+bool checkOut(const Napi::Env &env, const Napi::Value &out, size_t numRows, long unsigned int &maxLength) {
+    if (out.IsUndefined() || out.IsNull()) {
+        return true;
+    }
+    if (!isInt32Array(out)) {
+        Napi::TypeError::New(env, "The output must be an Int32Array").ThrowAsJavaScriptException();
+        return false;
+    }
+    size_t length = out.As<Napi::Int32Array>().ElementLength();
+    if (maxLength == 0 && numRows > 0) {
+        maxLength = length / numRows;
+    }
+    if (maxLength * numRows > length) {
+        Napi::RangeError::New(env, "The output Int32Array is too short").ThrowAsJavaScriptException();
+        return false;
+    }
+    return true;
+}
+
+/*
+ * {ids, size} for a row, with the ids written to the front of out if the
+ * caller passed one (see checkOut)
+ */
+Napi::Object fromIdsResult(std::tuple<VecList_T, long unsigned int> &&result, const Napi::Value &out, const Napi::Env &env) {
+    VecList_T &ids = std::get<0>(result);
+    Napi::Object obj = Napi::Object::New(env);
+    if (isInt32Array(out)) {
+        Napi::Int32Array arr = out.As<Napi::Int32Array>();
+        std::copy(ids.begin(), ids.end(), arr.Data());
+        obj.Set("ids", arr);
+    }
+    else {
+        obj.Set("ids", fromIds(std::move(ids), env));
+    }
+    obj.Set("size", Napi::Number::New(env, std::get<1>(result)));
+    return obj;
+}
+
+/*
+ * {ids, lengths} for numRows rows of maxLength ids, flattened into one
+ * Int32Array (the caller's, if it passed one), which fill writes straight into
+ */
+template<typename Fn>
+Napi::Value fromStack(const Napi::Env &env, const Napi::Value &out, size_t numRows, long unsigned int maxLength, Fn fill) {
+    if (!checkOut(env, out, numRows, maxLength)) {
+        return env.Null();
+    }
+    if (maxLength == 0 && numRows > 0) {
+        Napi::TypeError::New(env, "You must supply a maxLength or an Int32Array to fill").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    Napi::Int32Array ids = isInt32Array(out) ? out.As<Napi::Int32Array>() : Napi::Int32Array::New(env, numRows * maxLength);
+    Napi::Int32Array lengths = Napi::Int32Array::New(env, numRows);
+    fill(maxLength, ids.Data(), lengths.Data());
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("ids", ids);
+    obj.Set("lengths", lengths);
+    return obj;
+}
+
+Napi::Object fromCounter(const Counter_T &counts, const Napi::Env &env) {
+    Napi::Object obj = Napi::Object::New(env);
+    for (auto& kv : counts) {
+        Napi::HandleScope scope(env);
+        obj.Set(kv.first, Napi::Number::New(env, kv.second));
+    }
+    return obj;
+}
+
+/*
+ * Ids from an Int32Array or an Array of numbers
+ */
+VecList_T toIds(const Napi::Value &value) {
+    if (isInt32Array(value)) {
+        Napi::Int32Array arr = value.As<Napi::Int32Array>();
+        return VecList_T(arr.Data(), arr.Data() + arr.ElementLength());
+    }
+    Napi::Array arr = value.As<Napi::Array>();
+    auto length = arr.Length();
+    VecList_T ids(length);
+    for (auto i = 0; i < length; ++i) {
+        ids[i] = static_cast<Napi::Value>(arr[i]).ToNumber().Int32Value();
+    }
+    return ids;
+}
+
+/*
+ * Count the tokens in the files using the options {splitter, numThreads, transform}.
+ * A JS transform can only be called on this thread, so it forces a single thread
+ */
+CorpusCounter countFiles(const Napi::Env &env, const TokenList_T &files, const Napi::Object &options) {
+    std::string splitter = options.Has("splitter") ? (std::string)options.Get("splitter").ToString() : " ";
+    size_t numThreads = options.Has("numThreads") ? (size_t)options.Get("numThreads").ToNumber().Int64Value() : 0;
+    if (options.Has("transform") && options.Get("transform").IsString()) {
+        CorpusCounter counter(splitter, Transform_T(toNativeTransform(options.Get("transform"))), numThreads);
+        counter.count(files);
+        return counter;
+    }
+    if (options.Has("transform") && options.Get("transform").IsFunction()) {
+        Napi::FunctionReference func = Napi::Weak(options.Get("transform").As<Napi::Function>());
+        const TransformWrapper transformer(func, env);
+        Transform_T transform = std::bind(&TransformWrapper::transform, transformer, std::placeholders::_1);
+        CorpusCounter counter(splitter, transform, 1);
+        counter.count(files);
+        return counter;
+    }
+    CorpusCounter counter(splitter, Transform_T(), numThreads);
+    counter.count(files);
+    return counter;
+}
+
+// The corpus options may leave the transform out
+bool checkCorpusOptions(const Napi::Env &env, const Napi::Object &options) {
+    return !options.Has("transform") || options.Get("transform").IsUndefined() || checkTransform(env, options.Get("transform"));
+}
+
+Napi::Value countCorpus(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "You must supply a list of files").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    TokenList_T files = toTokenList(info[0].As<Napi::Array>());
+    Napi::Object options = info.Length() > 1 && info[1].IsObject() ? info[1].ToObject() : Napi::Object::New(env);
+    if (!checkCorpusOptions(env, options)) {
+        return env.Null();
+    }
+    // A file that is missing or cannot be mapped throws
+    try {
+        return fromCounter(countFiles(env, files, options).counts(), env);
+    } catch (const std::exception &e) {
+        Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+}
 
 class VocabWrapper : public Napi::ObjectWrap<VocabWrapper> {
 public:
@@ -69,18 +316,123 @@ public:
     VocabWrapper(const Napi::CallbackInfo &info);
     ~VocabWrapper();
     Vocab *getValue() { return this->value; }
+    static bool isVocab(const Napi::Value &value);
 private:
     Vocab *value = NULL;
     Napi::Value lookup(const Napi::CallbackInfo &info);
+    Napi::Value rlookup(const Napi::CallbackInfo &info);
+    Napi::Value compileVocab(const Napi::CallbackInfo &info);
+    Napi::Value handle(const Napi::CallbackInfo &info);
+    Napi::Value reload(const Napi::CallbackInfo &info);
+    Napi::Value version(const Napi::CallbackInfo &info);
 };
 
 Napi::Object VocabWrapper::Init(Napi::Env env, Napi::Object exports) {
-    exports.Set("Vocab", DefineClass(env, "Vocab", {
+    Napi::Function func = DefineClass(env, "Vocab", {
             InstanceMethod<&VocabWrapper::lookup>("lookup"),
-    }));
+            InstanceMethod<&VocabWrapper::rlookup>("rlookup"),
+            InstanceMethod<&VocabWrapper::compileVocab>("compileVocab"),
+            InstanceMethod<&VocabWrapper::handle>("handle"),
+            InstanceMethod<&VocabWrapper::reload>("reload"),
+            InstanceMethod<&VocabWrapper::version>("version"),
+    });
+    // Kept per env, since each worker thread loads its own copy of the addon
+    env.SetInstanceData<Napi::FunctionReference>(new Napi::FunctionReference(Napi::Persistent(func)));
+    exports.Set("Vocab", func);
     return exports;
 }
 
+/*
+ * Unwrap trusts its argument, so check that a value really is one of our
+ * vocabs before unwrapping it
+ */
+bool VocabWrapper::isVocab(const Napi::Value &value) {
+    Napi::FunctionReference *ctor = value.Env().GetInstanceData<Napi::FunctionReference>();
+    return value.IsObject() && value.As<Napi::Object>().InstanceOf(ctor->Value());
+}
+
+/*
+ * Loads the new version of a ReloadableVocab on a worker thread, resolving
+ * the promise once it has been swapped in.  The JS vocab object is held for
+ * the duration so it cannot be collected mid-load
+ */
+class ReloadWorker : public Napi::AsyncWorker {
+public:
+    ReloadWorker(const Napi::Env &env, const Napi::Object &self, ReloadableVocab *vocab,
+                 const std::string &vocabFile, const std::string &codesFile)
+        : Napi::AsyncWorker(env), self(Napi::Persistent(self)), vocab(vocab),
+          vocabFile(vocabFile), codesFile(codesFile), deferred(Napi::Promise::Deferred::New(env)) {}
+
+    Napi::Promise promise() { return this->deferred.Promise(); }
+
+    void Execute() override {
+        try {
+            this->vocab->reload(this->vocabFile, this->codesFile);
+        } catch (const std::exception &e) {
+            SetError(e.what());
+        }
+    }
+    void OnOK() override {
+        this->deferred.Resolve(Napi::Number::New(Env(), this->vocab->version()));
+    }
+    void OnError(const Napi::Error &e) override {
+        this->deferred.Reject(e.Value());
+    }
+
+private:
+    Napi::ObjectReference self;
+    ReloadableVocab *vocab;
+    std::string vocabFile;
+    std::string codesFile;
+    Napi::Promise::Deferred deferred;
+};
+
+/*
+ * A handle is what a worker thread needs to open the same vocab: its
+ * compiled directory (see Vocab::shared_dir), which every thread maps
+ * rather than copies, and its special tokens.  It is a plain object, so
+ * it can go through postMessage or workerData
+ */
+Napi::Object toHandle(const Napi::Env &env, const Vocab &vocab) {
+    auto reloadable = dynamic_cast<const ReloadableVocab*>(&vocab);
+    bool bpe = reloadable ? reloadable->is_bpe() : dynamic_cast<const BPEVocab*>(&vocab) != NULL;
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("dir", vocab.shared_dir());
+    obj.Set("bpe", bpe);
+    obj.Set("reloadable", reloadable != NULL);
+    obj.Set("pad", Napi::Number::New(env, vocab.pad_id()));
+    obj.Set("start", Napi::Number::New(env, vocab.start_id()));
+    obj.Set("end", Napi::Number::New(env, vocab.end_id()));
+    obj.Set("unk", Napi::Number::New(env, vocab.unk_id()));
+    obj.Set("padStr", vocab.pad_str());
+    obj.Set("startStr", vocab.start_str());
+    obj.Set("endStr", vocab.end_str());
+    obj.Set("unkStr", vocab.unk_str());
+    obj.Set("extraTokens", fromTokenList(vocab.extra_tokens(), env));
+    return obj;
+}
+
+Vocab *fromHandle(const Napi::Object &handle) {
+    std::string dir = handle.Get("dir").ToString();
+    bool bpe = handle.Get("bpe").ToBoolean();
+    Index_T pad = handle.Get("pad").ToNumber();
+    Index_T start = handle.Get("start").ToNumber();
+    Index_T end = handle.Get("end").ToNumber();
+    Index_T unk = handle.Get("unk").ToNumber();
+    std::string padStr = handle.Get("padStr").ToString();
+    std::string startStr = handle.Get("startStr").ToString();
+    std::string endStr = handle.Get("endStr").ToString();
+    std::string unkStr = handle.Get("unkStr").ToString();
+    TokenList_T extraTokens = toTokenList(handle.Get("extraTokens").As<Napi::Array>());
+    if (handle.Get("reloadable").ToBoolean()) {
+        return new ReloadableVocab(dir, bpe ? dir : "", pad, start, end, unk, padStr, startStr, endStr, unkStr, extraTokens);
+    }
+    if (bpe) {
+        return new BPEVocab(dir, dir, pad, start, end, unk, padStr, startStr, endStr, unkStr, extraTokens);
+    }
+    return new WordVocab(dir, pad, start, end, unk, padStr, startStr, endStr, unkStr, extraTokens);
+}
+
 VocabWrapper::VocabWrapper(const Napi::CallbackInfo &info) : Napi::ObjectWrap<VocabWrapper>(info) {
     if (info.Length() < 2) {
         Napi::TypeError::New(info.Env(), "You must supply at least 2 arguments").ThrowAsJavaScriptException();
@@ -105,12 +457,42 @@ VocabWrapper::VocabWrapper(const Napi::CallbackInfo &info) : Napi::ObjectWrap<Vo
         }
         this->value = new WordVocab(counter);
     }
+    else if (vocabType == "word-corpus") {
+        TokenList_T files = toTokenList(info[1].As<Napi::Array>());
+        Napi::Object options = info.Length() > 2 && info[2].IsObject() ? info[2].ToObject() : Napi::Object::New(info.Env());
+        if (!checkCorpusOptions(info.Env(), options)) {
+            return;
+        }
+        int minFreq = options.Has("minFreq") ? (int)options.Get("minFreq").ToNumber() : 0;
+        size_t maxSize = options.Has("maxSize") ? (size_t)options.Get("maxSize").ToNumber().Int64Value() : 0;
+        try {
+            CorpusCounter counter = countFiles(info.Env(), files, options);
+            this->value = new WordVocab(counter, 0, 1, 2, 3, "<PAD>", "<GO>", "<EOS>", "<UNK>", TokenList_T(), minFreq, maxSize);
+        } catch (const std::exception &e) {
+            Napi::Error::New(info.Env(), e.what()).ThrowAsJavaScriptException();
+        }
+    }
+    else if (vocabType == "reloadable") {
+        std::string codesFile = info.Length() > 2 ? (std::string) info[2].ToString() : "";
+        try {
+            this->value = new ReloadableVocab((std::string) info[1].ToString(), codesFile);
+        } catch (const std::exception &e) {
+            Napi::Error::New(info.Env(), e.what()).ThrowAsJavaScriptException();
+        }
+    }
     else if (vocabType == "bpe") {
         if (info.Length() < 3) {
             Napi::TypeError::New(info.Env(), "You must supply 2 filenames to create BPEVocab").ThrowAsJavaScriptException();
             return;
         }
         this->value = new BPEVocab((std::string) info[1].ToString(), (std::string) info[2].ToString());
+    }
+    else if (vocabType == "handle") {
+        try {
+            this->value = fromHandle(info[1].As<Napi::Object>());
+        } catch (const std::exception &e) {
+            Napi::Error::New(info.Env(), e.what()).ThrowAsJavaScriptException();
+        }
     } else {
         Napi::TypeError::New(info.Env(), "Invalid vocab type specified").ThrowAsJavaScriptException();
     }
@@ -130,12 +512,213 @@ Napi::Value VocabWrapper::lookup(const Napi::CallbackInfo &info) {
         return env.Null();
     }
     std::string token = (std::string) info[0].ToString();
-    Napi::FunctionReference func = Napi::Weak(info[1].As<Napi::Function>());
-    const TransformWrapper transformer(func, env);
-    Transform_T transform = std::bind(&TransformWrapper::transform, transformer, std::placeholders::_1);
+    if (!checkTransform(env, info[1])) {
+        return env.Null();
+    }
+    TransformPipeline native = toNativeTransform(info[1]);
+    Napi::FunctionReference func;
+    if (!info[1].IsString()) {
+        func = Napi::Weak(info[1].As<Napi::Function>());
+    }
+    TransformPipeline transform = toTransform(func, native, env);
     return Napi::Number::New(env, this->value->lookup(token, transform));
 }
 
+Napi::Value VocabWrapper::rlookup(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 1) {
+        Napi::TypeError::New(env, "Must supply 1 argument").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    try {
+        return Napi::String::New(env, this->value->rlookup(info[0].ToNumber().Int32Value()));
+    } catch (const std::exception &e) {
+        Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+}
+
+Napi::Value VocabWrapper::compileVocab(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 1) {
+        Napi::TypeError::New(env, "You must supply a target directory").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    try {
+        this->value->compile_vocab((std::string) info[0].ToString());
+    } catch (const std::exception &e) {
+        Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    }
+    return env.Undefined();
+}
+
+Napi::Value VocabWrapper::handle(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    try {
+        return toHandle(env, *this->value);
+    } catch (const std::exception &e) {
+        Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+}
+
+Napi::Value VocabWrapper::reload(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    ReloadableVocab *vocab = dynamic_cast<ReloadableVocab*>(this->value);
+    if (vocab == NULL) {
+        Napi::TypeError::New(env, "This vocab is not reloadable").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "You must supply a vocab file").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    std::string codesFile = info.Length() > 1 ? (std::string) info[1].ToString() : "";
+    ReloadWorker *worker = new ReloadWorker(env, info.This().ToObject(), vocab, (std::string) info[0].ToString(), codesFile);
+    Napi::Promise promise = worker->promise();
+    worker->Queue();
+    return promise;
+}
+
+Napi::Value VocabWrapper::version(const Napi::CallbackInfo &info) {
+    ReloadableVocab *vocab = dynamic_cast<ReloadableVocab*>(this->value);
+    return Napi::Number::New(info.Env(), vocab ? vocab->version() : 0);
+}
+
+class SpecialTokenScannerWrapper : public Napi::ObjectWrap<SpecialTokenScannerWrapper> {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+    SpecialTokenScannerWrapper(const Napi::CallbackInfo &info);
+    ~SpecialTokenScannerWrapper();
+    Napi::Value scan(const Napi::CallbackInfo &info);
+    Napi::Value tokenize(const Napi::CallbackInfo &info);
+private:
+    SpecialTokenScanner *value = NULL;
+};
+
+Napi::Object SpecialTokenScannerWrapper::Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("SpecialTokenScanner", DefineClass(env, "SpecialTokenScanner", {
+            InstanceMethod<&SpecialTokenScannerWrapper::scan>("scan"),
+            InstanceMethod<&SpecialTokenScannerWrapper::tokenize>("tokenize"),
+    }));
+    return exports;
+}
+
+SpecialTokenScannerWrapper::SpecialTokenScannerWrapper(const Napi::CallbackInfo &info) : Napi::ObjectWrap<SpecialTokenScannerWrapper>(info) {
+    if (info.Length() < 1) {
+        Napi::TypeError::New(info.Env(), "You must supply a vocab or a list of tokens").ThrowAsJavaScriptException();
+        return;
+    }
+    if (info[0].IsArray()) {
+        this->value = new SpecialTokenScanner(toTokenList(info[0].As<Napi::Array>()));
+    } else if (VocabWrapper::isVocab(info[0])) {
+        VocabWrapper* vocab = Napi::ObjectWrap<VocabWrapper>::Unwrap(info[0].As<Napi::Object>());
+        this->value = new SpecialTokenScanner(vocab->getValue()->get_special_tokens());
+    } else {
+        Napi::TypeError::New(info.Env(), "You must supply a vocab or a list of tokens").ThrowAsJavaScriptException();
+    }
+}
+
+SpecialTokenScannerWrapper::~SpecialTokenScannerWrapper() {
+    if (this->value) {
+        delete this->value;
+    }
+}
+
+Napi::Value SpecialTokenScannerWrapper::scan(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 1) {
+        Napi::TypeError::New(env, "Must supply 1 argument").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    std::string text = (std::string) info[0].ToString();
+    TextSpanList_T spans = this->value->spans(text);
+    Napi::Array arr = Napi::Array::New(env, spans.size());
+    for (size_t i = 0; i < spans.size(); ++i) {
+        Napi::HandleScope scope(env);
+        Napi::Object obj = Napi::Object::New(env);
+        obj.Set("text", Napi::String::New(env, text.data() + spans[i].begin, spans[i].end - spans[i].begin));
+        obj.Set("special", Napi::Boolean::New(env, spans[i].special));
+        arr[i] = obj;
+    }
+    return arr;
+}
+
+Napi::Value SpecialTokenScannerWrapper::tokenize(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 1) {
+        Napi::TypeError::New(env, "Must supply 1 argument").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    return fromTokenList(this->value->tokenize((std::string) info[0].ToString()), env);
+}
+
+
+/*
+ * Encodes on a libuv worker thread, so a big batch does not hold up the
+ * event loop, and resolves the promise with {ids, size} for a row or
+ * {ids, lengths} for a stack.  The arguments are copied in on the main
+ * thread, and the JS vectorizer is held so it cannot be collected
+ * mid-encode.  Only a native transform can run off the main thread
+ */
+class EncodeWorker : public Napi::AsyncWorker {
+public:
+    enum Mode { IDS, IDS_STACK, TEXT_STACK };
+
+    EncodeWorker(const Napi::Env &env, const Napi::Object &self, const VocabVectorizer *vec, Mode mode,
+                 ListTokenList_T &&listTokens, TokenList_T &&texts, long unsigned int maxLength)
+        : Napi::AsyncWorker(env), self(Napi::Persistent(self)), vec(vec), mode(mode),
+          listTokens(std::move(listTokens)), texts(std::move(texts)), maxLength(maxLength),
+          deferred(Napi::Promise::Deferred::New(env)) {}
+
+    Napi::Promise promise() { return this->deferred.Promise(); }
+
+    void Execute() override {
+        try {
+            if (this->mode == IDS) {
+                std::tuple<VecList_T, long unsigned int> result = this->vec->convert_to_ids(this->listTokens[0], this->maxLength);
+                this->ids = std::move(std::get<0>(result));
+                this->lengths.assign(1, (int)std::get<1>(result));
+                return;
+            }
+            size_t numRows = this->mode == IDS_STACK ? this->listTokens.size() : this->texts.size();
+            this->ids.resize(numRows * this->maxLength);
+            this->lengths.resize(numRows);
+            if (this->mode == IDS_STACK) {
+                this->vec->convert_to_ids_stack_into(this->listTokens, this->maxLength, this->ids.data(), this->lengths.data());
+            } else {
+                this->vec->encode_text_stack_into(this->texts, this->maxLength, this->ids.data(), this->lengths.data());
+            }
+        } catch (const std::exception &e) {
+            SetError(e.what());
+        }
+    }
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::Object obj = Napi::Object::New(env);
+        obj.Set("ids", fromIds(std::move(this->ids), env));
+        if (this->mode == IDS) {
+            obj.Set("size", Napi::Number::New(env, this->lengths[0]));
+        } else {
+            obj.Set("lengths", fromIds(std::move(this->lengths), env));
+        }
+        this->deferred.Resolve(obj);
+    }
+    void OnError(const Napi::Error &e) override {
+        this->deferred.Reject(e.Value());
+    }
+
+private:
+    Napi::ObjectReference self;
+    const VocabVectorizer *vec;
+    Mode mode;
+    ListTokenList_T listTokens;
+    TokenList_T texts;
+    long unsigned int maxLength;
+    VecList_T ids;
+    VecList_T lengths;
+    Napi::Promise::Deferred deferred;
+};
 
 class VocabVectorizerWrapper : public Napi::ObjectWrap<VocabVectorizerWrapper> {
 public:
@@ -143,17 +726,41 @@ public:
     VocabVectorizerWrapper(const Napi::CallbackInfo &info);
     Napi::Value convertToPieces(const Napi::CallbackInfo &info);
     Napi::Value convertToIds(const Napi::CallbackInfo &info);
+    Napi::Value convertToIdsStack(const Napi::CallbackInfo &info);
+    Napi::Value encodeText(const Napi::CallbackInfo &info);
+    Napi::Value encodeTextStack(const Napi::CallbackInfo &info);
+    Napi::Value convertToIdsAsync(const Napi::CallbackInfo &info);
+    Napi::Value convertToIdsStackAsync(const Napi::CallbackInfo &info);
+    Napi::Value encodeTextStackAsync(const Napi::CallbackInfo &info);
+    Napi::Value decode(const Napi::CallbackInfo &info);
+    Napi::Value countPieces(const Napi::CallbackInfo &info);
+    Napi::Value transformCacheStats(const Napi::CallbackInfo &info);
 private:
+    Napi::Value queueEncode(const Napi::CallbackInfo &info, EncodeWorker::Mode mode);
     VocabWrapper* vocab;
+    // Keeps the JS vocab alive as long as this vectorizer
+    Napi::ObjectReference vocabRef;
+    // A JS transform, which vec calls back into
     Napi::FunctionReference transform;
-    Napi::Reference<Napi::Array> emitBeginToken;
-    Napi::Reference<Napi::Array> emitEndToken;
+    // Only set for a memoized JS transform
+    std::shared_ptr<TransformCache> transformCache;
+    // Built once, with the transform, begin and end tokens and pretokenizer
+    std::unique_ptr<VocabVectorizer> vec;
 };
 
 Napi::Object VocabVectorizerWrapper::Init(Napi::Env env, Napi::Object exports) {
     exports.Set("VocabVectorizer", DefineClass(env, "VocabVectorizer", {
             InstanceMethod<&VocabVectorizerWrapper::convertToPieces>("convertToPieces"),
             InstanceMethod<&VocabVectorizerWrapper::convertToIds>("convertToIds"),
+            InstanceMethod<&VocabVectorizerWrapper::convertToIdsStack>("convertToIdsStack"),
+            InstanceMethod<&VocabVectorizerWrapper::encodeText>("encodeText"),
+            InstanceMethod<&VocabVectorizerWrapper::encodeTextStack>("encodeTextStack"),
+            InstanceMethod<&VocabVectorizerWrapper::convertToIdsAsync>("convertToIdsAsync"),
+            InstanceMethod<&VocabVectorizerWrapper::convertToIdsStackAsync>("convertToIdsStackAsync"),
+            InstanceMethod<&VocabVectorizerWrapper::encodeTextStackAsync>("encodeTextStackAsync"),
+            InstanceMethod<&VocabVectorizerWrapper::decode>("decode"),
+            InstanceMethod<&VocabVectorizerWrapper::countPieces>("countPieces"),
+            InstanceMethod<&VocabVectorizerWrapper::transformCacheStats>("transformCacheStats"),
     }));
     return exports;
 }
@@ -164,9 +771,36 @@ VocabVectorizerWrapper::VocabVectorizerWrapper(const Napi::CallbackInfo &info) :
         return;
     }
     vocab = Napi::ObjectWrap<VocabWrapper>::Unwrap(info[0].ToObject());
-    transform = Napi::Persistent(info[1].As<Napi::Function>());
-    emitBeginToken = Napi::Persistent(info[2].As<Napi::Array>());
-    emitEndToken = Napi::Persistent(info[3].As<Napi::Array>());
+    vocabRef = Napi::Persistent(info[0].ToObject());
+    if (!checkTransform(info.Env(), info[1])) {
+        return;
+    }
+    TransformPipeline nativeTransform = toNativeTransform(info[1]);
+    if (!info[1].IsString()) {
+        transform = Napi::Persistent(info[1].As<Napi::Function>());
+        if (info.Length() > 4) {
+            transformCache = toTransformCache(info[4]);
+        }
+    }
+    TransformPipeline transformProxy = toTransform(this->transform, nativeTransform, info.Env(), this->transformCache);
+    TokenList_T beginTokens = toTokenList(info[2].As<Napi::Array>());
+    TokenList_T endTokens = toTokenList(info[3].As<Napi::Array>());
+    vec.reset(make_vocab_vectorizer(vocab->getValue(), transformProxy, beginTokens, endTokens));
+    // Pretokenizer options {whitespace, punctuation, keepSpecialTokens}
+    Napi::Object options = info.Length() > 5 && info[5].IsObject() ? info[5].ToObject() : Napi::Object::New(info.Env());
+    std::string whitespace = options.Has("whitespace") ? (std::string)options.Get("whitespace").ToString() : WHITESPACE;
+    std::string punctuation = options.Has("punctuation") ? (std::string)options.Get("punctuation").ToString() : "";
+    bool keepSpecialTokens = options.Has("keepSpecialTokens") ? options.Get("keepSpecialTokens").ToBoolean().Value() : true;
+    if (keepSpecialTokens) {
+        vec->set_pretokenizer(PreTokenizer(vocab->getValue()->get_special_tokens(), whitespace, punctuation));
+    }
+    else {
+        vec->set_pretokenizer(PreTokenizer(TokenList_T(), whitespace, punctuation));
+    }
+}
+
+Napi::Value VocabVectorizerWrapper::transformCacheStats(const Napi::CallbackInfo &info) {
+    return fromTransformCacheStats(this->transformCache, info.Env());
 }
 
 Napi::Value VocabVectorizerWrapper::convertToPieces(const Napi::CallbackInfo &info) {
@@ -177,39 +811,141 @@ Napi::Value VocabVectorizerWrapper::convertToPieces(const Napi::CallbackInfo &in
         return env.Null();
     }
 
-    const TransformWrapper transformer(this->transform, env);
-    Transform_T transformProxy = std::bind(&TransformWrapper::transform, transformer, std::placeholders::_1);
-    TokenList_T beginTokens = toTokenList(this->emitBeginToken.Value());
-    TokenList_T endTokens = toTokenList(this->emitEndToken.Value());
-    VocabVectorizer vec(this->vocab->getValue(), transformProxy, beginTokens, endTokens);
-
     TokenList_T tokens = toTokenList(info[0].As<Napi::Array>());
-    TokenList_T pieces = vec.convert_to_pieces(tokens);
+    TokenList_T pieces = this->vec->convert_to_pieces(tokens);
     return fromTokenList(pieces, env);
 }
 
 Napi::Value VocabVectorizerWrapper::convertToIds(const Napi::CallbackInfo &info) {
     Napi::Env env = info.Env();
     auto numArgs = info.Length();
-    if (numArgs != 2) {
+    if (numArgs < 2 || numArgs > 3) {
+        Napi::TypeError::New(env, "Must supply 2 or 3 arguments").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    TokenList_T tokens = toTokenList(info[0].As<Napi::Array>());
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    Napi::Value out = numArgs > 2 ? info[2] : env.Undefined();
+    if (!checkOut(env, out, 1, maxLength)) {
+        return env.Null();
+    }
+    return fromIdsResult(this->vec->convert_to_ids(tokens, maxLength), out, env);
+}
+
+Napi::Value VocabVectorizerWrapper::convertToIdsStack(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    auto numArgs = info.Length();
+    if (numArgs < 2 || numArgs > 3) {
+        Napi::TypeError::New(env, "Must supply 2 or 3 arguments").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    ListTokenList_T listTokens = toListTokenList(info[0].As<Napi::Array>());
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    return fromStack(env, numArgs > 2 ? info[2] : env.Undefined(), listTokens.size(), maxLength,
+                     [&](long unsigned int len, int *ids, int *lengths) {
+                         this->vec->convert_to_ids_stack_into(listTokens, len, ids, lengths);
+                     });
+}
+
+Napi::Value VocabVectorizerWrapper::encodeText(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    auto numArgs = info.Length();
+    if (numArgs < 2 || numArgs > 3) {
+        Napi::TypeError::New(env, "Must supply 2 or 3 arguments").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string text = (std::string) info[0].ToString();
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    Napi::Value out = numArgs > 2 ? info[2] : env.Undefined();
+    if (!checkOut(env, out, 1, maxLength)) {
+        return env.Null();
+    }
+    return fromIdsResult(this->vec->encode_text(text, maxLength), out, env);
+}
+
+Napi::Value VocabVectorizerWrapper::encodeTextStack(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    auto numArgs = info.Length();
+    if (numArgs < 2 || numArgs > 3) {
+        Napi::TypeError::New(env, "Must supply 2 or 3 arguments").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    TokenList_T texts = toTokenList(info[0].As<Napi::Array>());
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    return fromStack(env, numArgs > 2 ? info[2] : env.Undefined(), texts.size(), maxLength,
+                     [&](long unsigned int len, int *ids, int *lengths) {
+                         this->vec->encode_text_stack_into(texts, len, ids, lengths);
+                     });
+}
+
+Napi::Value VocabVectorizerWrapper::queueEncode(const Napi::CallbackInfo &info, EncodeWorker::Mode mode) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 2) {
         Napi::TypeError::New(env, "Must supply 2 arguments").ThrowAsJavaScriptException();
         return env.Null();
     }
+    if (!this->vec->transform().is_native()) {
+        Napi::TypeError::New(env, "Encoding off the main thread needs a native transform").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    ListTokenList_T listTokens;
+    TokenList_T texts;
+    if (mode == EncodeWorker::IDS) {
+        listTokens.push_back(toTokenList(info[0].As<Napi::Array>()));
+    } else if (mode == EncodeWorker::IDS_STACK) {
+        listTokens = toListTokenList(info[0].As<Napi::Array>());
+    } else {
+        texts = toTokenList(info[0].As<Napi::Array>());
+    }
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    if (mode != EncodeWorker::IDS && maxLength == 0 && (listTokens.size() + texts.size()) > 0) {
+        Napi::TypeError::New(env, "You must supply a maxLength").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    EncodeWorker *worker = new EncodeWorker(env, info.This().ToObject(), this->vec.get(), mode,
+                                            std::move(listTokens), std::move(texts), maxLength);
+    Napi::Promise promise = worker->promise();
+    worker->Queue();
+    return promise;
+}
 
-    const TransformWrapper transformer(this->transform, env);
-    Transform_T transformProxy = std::bind(&TransformWrapper::transform, transformer, std::placeholders::_1);
-    TokenList_T beginTokens = toTokenList(this->emitBeginToken.Value());
-    TokenList_T endTokens = toTokenList(this->emitEndToken.Value());
-    VocabVectorizer vec(this->vocab->getValue(), transformProxy, beginTokens, endTokens);
+Napi::Value VocabVectorizerWrapper::convertToIdsAsync(const Napi::CallbackInfo &info) {
+    return queueEncode(info, EncodeWorker::IDS);
+}
 
-    TokenList_T tokens = toTokenList(info[0].As<Napi::Array>());
-    auto maxLength = info[1].As<Napi::Number>();
-    std::tuple<VecList_T, long unsigned int> result = vec.convert_to_ids(tokens, maxLength.Int64Value());
+Napi::Value VocabVectorizerWrapper::convertToIdsStackAsync(const Napi::CallbackInfo &info) {
+    return queueEncode(info, EncodeWorker::IDS_STACK);
+}
 
-    Napi::Object obj = Napi::Object::New(env);
-    obj.Set("ids", fromIdsList(std::get<0>(result), env));
-    obj.Set("size", Napi::Number::New(env, std::get<1>(result)));
-    return obj;
+Napi::Value VocabVectorizerWrapper::encodeTextStackAsync(const Napi::CallbackInfo &info) {
+    return queueEncode(info, EncodeWorker::TEXT_STACK);
+}
+
+Napi::Value VocabVectorizerWrapper::decode(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 1) {
+        Napi::TypeError::New(env, "Must supply 1 argument").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    try {
+        return Napi::String::New(env, this->vec->decode(toIds(info[0])));
+    } catch (const std::exception &e) {
+        Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+}
+
+Napi::Value VocabVectorizerWrapper::countPieces(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 1) {
+        Napi::TypeError::New(env, "Must supply 1 argument").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    return fromCounter(this->vec->count_pieces(toTokenList(info[0].As<Napi::Array>())), env);
 }
 
 class VocabMapVectorizerWrapper : public Napi::ObjectWrap<VocabMapVectorizerWrapper> {
@@ -218,13 +954,22 @@ public:
     VocabMapVectorizerWrapper(const Napi::CallbackInfo &info);
     Napi::Value convertToPieces(const Napi::CallbackInfo &info);
     Napi::Value convertToIds(const Napi::CallbackInfo &info);
+    Napi::Value convertToPiecesColumns(const Napi::CallbackInfo &info);
+    Napi::Value convertToIdsColumns(const Napi::CallbackInfo &info);
+    Napi::Value convertToIdsStack(const Napi::CallbackInfo &info);
+    Napi::Value convertToIdsColumnsStack(const Napi::CallbackInfo &info);
+    Napi::Value countPieces(const Napi::CallbackInfo &info);
+    Napi::Value transformCacheStats(const Napi::CallbackInfo &info);
 private:
     VocabWrapper* vocab;
+    // Keeps the JS vocab alive as long as this vectorizer
+    Napi::ObjectReference vocabRef;
+    // A JS transform, which vec calls back into
     Napi::FunctionReference transform;
-    Napi::Reference<Napi::Array> emitBeginToken;
-    Napi::Reference<Napi::Array> emitEndToken;
-    Napi::Reference<Napi::Array> fields;
-    std::string delim;
+    // Only set for a memoized JS transform
+    std::shared_ptr<TransformCache> transformCache;
+    // Built once, with the transform, begin and end tokens, fields and delim
+    std::unique_ptr<VocabMapVectorizer> vec;
 };
 
 
@@ -232,6 +977,12 @@ Napi::Object VocabMapVectorizerWrapper::Init(Napi::Env env, Napi::Object exports
     exports.Set("VocabMapVectorizer", DefineClass(env, "VocabMapVectorizer", {
             InstanceMethod<&VocabMapVectorizerWrapper::convertToPieces>("convertToPieces"),
             InstanceMethod<&VocabMapVectorizerWrapper::convertToIds>("convertToIds"),
+            InstanceMethod<&VocabMapVectorizerWrapper::convertToPiecesColumns>("convertToPiecesColumns"),
+            InstanceMethod<&VocabMapVectorizerWrapper::convertToIdsColumns>("convertToIdsColumns"),
+            InstanceMethod<&VocabMapVectorizerWrapper::convertToIdsStack>("convertToIdsStack"),
+            InstanceMethod<&VocabMapVectorizerWrapper::convertToIdsColumnsStack>("convertToIdsColumnsStack"),
+            InstanceMethod<&VocabMapVectorizerWrapper::countPieces>("countPieces"),
+            InstanceMethod<&VocabMapVectorizerWrapper::transformCacheStats>("transformCacheStats"),
     }));
     return exports;
 }
@@ -242,11 +993,27 @@ VocabMapVectorizerWrapper::VocabMapVectorizerWrapper(const Napi::CallbackInfo &i
         return;
     }
     vocab = Napi::ObjectWrap<VocabWrapper>::Unwrap(info[0].ToObject());
-    transform = Napi::Persistent(info[1].As<Napi::Function>());
-    emitBeginToken = Napi::Persistent(info[2].As<Napi::Array>());
-    emitEndToken = Napi::Persistent(info[3].As<Napi::Array>());
-    fields = Napi::Persistent(info[4].As<Napi::Array>());
-    delim = (std::string)info[5].ToString();
+    vocabRef = Napi::Persistent(info[0].ToObject());
+    if (!checkTransform(info.Env(), info[1])) {
+        return;
+    }
+    TransformPipeline nativeTransform = toNativeTransform(info[1]);
+    if (!info[1].IsString()) {
+        transform = Napi::Persistent(info[1].As<Napi::Function>());
+        if (info.Length() > 6) {
+            transformCache = toTransformCache(info[6]);
+        }
+    }
+    TransformPipeline transformProxy = toTransform(this->transform, nativeTransform, info.Env(), this->transformCache);
+    TokenList_T beginTokens = toTokenList(info[2].As<Napi::Array>());
+    TokenList_T endTokens = toTokenList(info[3].As<Napi::Array>());
+    TokenList_T fields = toTokenList(info[4].As<Napi::Array>());
+    std::string delim = (std::string)info[5].ToString();
+    vec.reset(new VocabMapVectorizer(vocab->getValue(), transformProxy, beginTokens, endTokens, fields, delim));
+}
+
+Napi::Value VocabMapVectorizerWrapper::transformCacheStats(const Napi::CallbackInfo &info) {
+    return fromTransformCacheStats(this->transformCache, info.Env());
 }
 
 Napi::Value VocabMapVectorizerWrapper::convertToPieces(const Napi::CallbackInfo &info) {
@@ -257,45 +1024,135 @@ Napi::Value VocabMapVectorizerWrapper::convertToPieces(const Napi::CallbackInfo
         return env.Null();
     }
 
-    const TransformWrapper transformer(this->transform, env);
-    Transform_T transformProxy = std::bind(&TransformWrapper::transform, transformer, std::placeholders::_1);
-    TokenList_T beginTokens = toTokenList(this->emitBeginToken.Value());
-    TokenList_T endTokens = toTokenList(this->emitEndToken.Value());
-    VocabMapVectorizer vec(this->vocab->getValue(), transformProxy, beginTokens, endTokens);
-
     TokenMapList_T tokenMap = toTokenMapList(info[0].As<Napi::Array>());
-    TokenList_T pieces = vec.convert_to_pieces(tokenMap);
+    TokenList_T pieces = this->vec->convert_to_pieces(tokenMap);
     return fromTokenList(pieces, env);
 }
 
 Napi::Value VocabMapVectorizerWrapper::convertToIds(const Napi::CallbackInfo &info) {
     Napi::Env env = info.Env();
     auto numArgs = info.Length();
-    if (numArgs != 2) {
-        Napi::TypeError::New(env, "Must supply 2 arguments").ThrowAsJavaScriptException();
+    if (numArgs < 2 || numArgs > 3) {
+        Napi::TypeError::New(env, "Must supply 2 or 3 arguments").ThrowAsJavaScriptException();
         return env.Null();
     }
 
-    const TransformWrapper transformer(this->transform, env);
-    Transform_T transformProxy = std::bind(&TransformWrapper::transform, transformer, std::placeholders::_1);
-    TokenList_T beginTokens = toTokenList(this->emitBeginToken.Value());
-    TokenList_T endTokens = toTokenList(this->emitEndToken.Value());
-    VocabMapVectorizer vec(this->vocab->getValue(), transformProxy, beginTokens, endTokens);
-
     TokenMapList_T tokenMaps = toTokenMapList(info[0].As<Napi::Array>());
-    auto maxLength = info[1].As<Napi::Number>();
-    std::tuple<VecList_T, long unsigned int> result = vec.convert_to_ids(tokenMaps, maxLength.Int64Value());
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    Napi::Value out = numArgs > 2 ? info[2] : env.Undefined();
+    if (!checkOut(env, out, 1, maxLength)) {
+        return env.Null();
+    }
+    return fromIdsResult(this->vec->convert_to_ids(tokenMaps, maxLength), out, env);
+}
 
-    Napi::Object obj = Napi::Object::New(env);
-    obj.Set("ids", fromIdsList(std::get<0>(result), env));
-    obj.Set("size", Napi::Number::New(env, std::get<1>(result)));
-    return obj;
+/*
+ * The columnar calls take one array per field, in the order of the fields,
+ * rather than an object per token
+ */
+Napi::Value VocabMapVectorizerWrapper::convertToPiecesColumns(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 1) {
+        Napi::TypeError::New(env, "Must supply 1 argument").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    ListTokenList_T columns = toListTokenList(info[0].As<Napi::Array>());
+    try {
+        return fromTokenList(this->vec->convert_to_pieces_columns(columns), env);
+    } catch (const std::exception &e) {
+        Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+}
+
+Napi::Value VocabMapVectorizerWrapper::convertToIdsColumns(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    auto numArgs = info.Length();
+    if (numArgs < 2 || numArgs > 3) {
+        Napi::TypeError::New(env, "Must supply 2 or 3 arguments").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    ListTokenList_T columns = toListTokenList(info[0].As<Napi::Array>());
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    Napi::Value out = numArgs > 2 ? info[2] : env.Undefined();
+    if (!checkOut(env, out, 1, maxLength)) {
+        return env.Null();
+    }
+    try {
+        return fromIdsResult(this->vec->convert_to_ids_columns(columns, maxLength), out, env);
+    } catch (const std::exception &e) {
+        Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+}
+
+/*
+ * A batch of sequences, stacked into one Int32Array of rows padded to
+ * maxLength, as VocabVectorizer.convertToIdsStack does
+ */
+Napi::Value VocabMapVectorizerWrapper::convertToIdsStack(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    auto numArgs = info.Length();
+    if (numArgs < 2 || numArgs > 3) {
+        Napi::TypeError::New(env, "Must supply 2 or 3 arguments").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Array arr = info[0].As<Napi::Array>();
+    ListTokenMapList_T listTokenMaps(arr.Length());
+    for (size_t i = 0; i < listTokenMaps.size(); ++i) {
+        listTokenMaps[i] = toTokenMapList(static_cast<Napi::Value>(arr[i]).As<Napi::Array>());
+    }
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    return fromStack(env, numArgs > 2 ? info[2] : env.Undefined(), listTokenMaps.size(), maxLength,
+                     [&](long unsigned int len, int *ids, int *lengths) {
+                         this->vec->convert_to_ids_stack_into(listTokenMaps, len, ids, lengths);
+                     });
+}
+
+Napi::Value VocabMapVectorizerWrapper::convertToIdsColumnsStack(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    auto numArgs = info.Length();
+    if (numArgs < 2 || numArgs > 3) {
+        Napi::TypeError::New(env, "Must supply 2 or 3 arguments").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Array arr = info[0].As<Napi::Array>();
+    ListColumns_T listColumns(arr.Length());
+    for (size_t i = 0; i < listColumns.size(); ++i) {
+        listColumns[i] = toListTokenList(static_cast<Napi::Value>(arr[i]).As<Napi::Array>());
+    }
+    long unsigned int maxLength = info[1].As<Napi::Number>().Int64Value();
+    try {
+        return fromStack(env, numArgs > 2 ? info[2] : env.Undefined(), listColumns.size(), maxLength,
+                         [&](long unsigned int len, int *ids, int *lengths) {
+                             this->vec->convert_to_ids_columns_stack_into(listColumns, len, ids, lengths);
+                         });
+    } catch (const std::exception &e) {
+        Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+}
+
+Napi::Value VocabMapVectorizerWrapper::countPieces(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() != 1) {
+        Napi::TypeError::New(env, "Must supply 1 argument").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    return fromCounter(this->vec->count_pieces(toTokenMapList(info[0].As<Napi::Array>())), env);
 }
 
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     VocabWrapper::Init(env, exports);
     VocabVectorizerWrapper::Init(env, exports);
     VocabMapVectorizerWrapper::Init(env, exports);
+    SpecialTokenScannerWrapper::Init(env, exports);
+    exports.Set("countCorpus", Napi::Function::New(env, countCorpus));
+    exports.Set("nativeTransformNames", fromTokenList(native_transform_names(), env));
     return exports;
 }
 
@@ -1,10 +1,290 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include "vecxx/vecxx.h"
+#include "vecxx/arrow.h"
 #define STRINGIFY(x) #x
 namespace py = pybind11;
 
+// Vocab lookup and apply are overloaded on the transform.  The
+// TransformPipeline overloads are bound first, so a pipeline passed from
+// Python is used natively rather than called as a function
+typedef Index_T (Vocab::*PipelineLookup_T)(const std::string&, const TransformPipeline&) const;
+typedef Index_T (Vocab::*FunctionLookup_T)(const std::string&, const Transform_T&) const;
+typedef TokenList_T (Vocab::*PipelineApply_T)(const TokenList_T&, const TransformPipeline&) const;
+typedef TokenList_T (Vocab::*FunctionApply_T)(const TokenList_T&, const Transform_T&) const;
+
+/*
+ * The encoding methods of the vectorizers release the GIL once their
+ * arguments are copied into native containers, and take it back to build
+ * the results, so Python threads can encode at the same time.  A Python
+ * transform still takes the GIL for each call, which serializes those
+ * threads again, so the batch methods can be asked to refuse one
+ */
+template<typename Vectorizer>
+void check_native_only(const Vectorizer& vec, bool native_only) {
+    if (native_only && !vec.transform().is_native()) {
+	throw std::invalid_argument("native_only was set, but the transform calls back into Python");
+    }
+}
+
+/*
+ * NumPy outputs for the *_array methods.  Ids are encoded as int32, and an
+ * int32 result is an array that takes over the vector they were encoded
+ * into, so nothing is copied.  An int64 result is widened from it.  A
+ * caller's out array must be C-contiguous, writeable, int32 or int64 and
+ * of the expected shape; int32 ones are encoded into directly
+ */
+static_assert(sizeof(int) == sizeof(int32_t), "ids are encoded as int32");
+
+bool is_int64(const py::object& dtype) {
+    py::dtype dt = py::dtype::from_args(dtype);
+    if (dt.equal(py::dtype::of<int32_t>())) {
+	return false;
+    }
+    if (dt.equal(py::dtype::of<int64_t>())) {
+	return true;
+    }
+    throw std::invalid_argument("ids can only be int32 or int64");
+}
+
+py::array to_array(VecList_T&& ids, const std::vector<size_t>& shape, bool int64) {
+    if (int64) {
+	py::array_t<int64_t> wide(shape);
+	int64_t* p = wide.mutable_data();
+	{
+	    py::gil_scoped_release release;
+	    std::copy(ids.begin(), ids.end(), p);
+	}
+	return wide;
+    }
+    auto owned = new VecList_T(std::move(ids));
+    py::capsule base(owned, [](void* p) { delete reinterpret_cast<VecList_T*>(p); });
+    return py::array_t<int32_t>(shape, owned->data(), base);
+}
+
+// out as an array of shape, or an error saying what is wrong with it
+py::array check_out(const py::object& out, const std::vector<size_t>& shape) {
+    if (!py::isinstance<py::array>(out)) {
+	throw std::invalid_argument("out must be a NumPy array");
+    }
+    py::array a = py::reinterpret_borrow<py::array>(out);
+    if (!(a.flags() & py::array::c_style) || !a.writeable()) {
+	throw std::invalid_argument("out must be writeable and C-contiguous");
+    }
+    bool same = (size_t)a.ndim() == shape.size();
+    for (size_t i = 0; same && i < shape.size(); ++i) {
+	same = (size_t)a.shape(i) == shape[i];
+    }
+    if (!same) {
+	throw std::invalid_argument("out does not have the shape of the ids");
+    }
+    return a;
+}
+
+/*
+ * Run encode(ids, lengths) with the GIL released, into a new (n, len)
+ * array or into out, and return the ids and lengths
+ */
+template<typename Encode>
+py::tuple encode_stack_array(size_t n, size_t len, const py::object& dtype, const py::object& out, Encode encode) {
+    std::vector<size_t> shape{n, len};
+    VecList_T lengths(n);
+    if (out.is_none()) {
+	bool int64 = is_int64(dtype);
+	VecList_T ids(n * len);
+	{
+	    py::gil_scoped_release release;
+	    encode(ids.data(), lengths.data());
+	}
+	return py::make_tuple(to_array(std::move(ids), shape, int64),
+			      to_array(std::move(lengths), {n}, int64));
+    }
+    py::array a = check_out(out, shape);
+    bool int64 = is_int64(a.dtype());
+    void* p = a.mutable_data();
+    if (int64) {
+	VecList_T ids(n * len);
+	py::gil_scoped_release release;
+	encode(ids.data(), lengths.data());
+	std::copy(ids.begin(), ids.end(), (int64_t*)p);
+    }
+    else {
+	py::gil_scoped_release release;
+	encode((int*)p, lengths.data());
+    }
+    return py::make_tuple(a, to_array(std::move(lengths), {n}, int64));
+}
+
+/*
+ * Columns for encode_column, read natively from the buffers of an Arrow
+ * array or stream (through the Arrow PyCapsule interface, so pyarrow is
+ * not needed to build this) or of a NumPy string array, rather than
+ * converting every token to a Python str and back.  A column of strings
+ * holds sentences, and a column of lists of strings holds tokens
+ */
+struct Column {
+    bool token_lists;
+    TokenList_T texts;
+    ListTokenList_T list_tokens;
+};
+
+template<typename T>
+T* capsule_pointer(const py::handle& capsule, const char* name) {
+    auto p = (T*)PyCapsule_GetPointer(capsule.ptr(), name);
+    if (p == NULL) {
+	throw py::error_already_set();
+    }
+    return p;
+}
+
+void read_arrow_array(const ArrowSchema& schema, const ArrowArray& array, Column& column) {
+    if (column.token_lists) {
+	read_arrow_token_lists(schema, array, column.list_tokens);
+    }
+    else {
+	read_arrow_strings(schema, array, column.texts);
+    }
+}
+
+void read_arrow_stream(ArrowArrayStream* stream, Column& column) {
+    ArrowSchema schema;
+    if (stream->get_schema(stream, &schema) != 0) {
+	throw std::runtime_error(std::string("Could not read the Arrow stream: ") + stream->get_last_error(stream));
+    }
+    std::unique_ptr<ArrowSchema, void (*)(ArrowSchema*)> schema_guard(&schema, [](ArrowSchema* s) { s->release(s); });
+    column.token_lists = arrow_is_token_lists(schema);
+    while (true) {
+	ArrowArray array;
+	if (stream->get_next(stream, &array) != 0) {
+	    throw std::runtime_error(std::string("Could not read the Arrow stream: ") + stream->get_last_error(stream));
+	}
+	if (array.release == NULL) {
+	    break;
+	}
+	std::unique_ptr<ArrowArray, void (*)(ArrowArray*)> array_guard(&array, [](ArrowArray* a) { a->release(a); });
+	read_arrow_array(schema, array, column);
+    }
+}
+
+std::string numpy_cell(const char* p, size_t width, bool unicode) {
+    if (!unicode) {
+	return std::string(p, std::find(p, p + width, '\0'));
+    }
+    std::string s;
+    auto cps = (const uint32_t*)p;
+    for (size_t i = 0; i < width / 4 && cps[i] != 0; ++i) {
+	utf8_append(s, cps[i]);
+    }
+    return s;
+}
+
+// A 1-D array of sentences, or a 2-D array of tokens padded with ""
+void read_numpy_strings(const py::array& strings, Column& column) {
+    char kind = strings.dtype().kind();
+    if ((kind != 'U' && kind != 'S') || strings.ndim() < 1 || strings.ndim() > 2) {
+	throw std::invalid_argument("Expected a 1-D or 2-D NumPy array of str or bytes");
+    }
+    // Code points in native byte order, one row after another
+    py::array a = py::module::import("numpy").attr("ascontiguousarray")(
+	strings, strings.dtype().attr("newbyteorder")("="));
+    const size_t width = a.itemsize();
+    const size_t rows = a.shape(0);
+    const size_t cols = a.ndim() == 2 ? a.shape(1) : 1;
+    auto p = (const char*)a.data();
+    column.token_lists = a.ndim() == 2;
+    for (size_t i = 0; i < rows; ++i) {
+	if (!column.token_lists) {
+	    column.texts.push_back(numpy_cell(p + i * width, width, kind == 'U'));
+	    continue;
+	}
+	column.list_tokens.push_back(TokenList_T());
+	for (size_t j = 0; j < cols; ++j) {
+	    auto token = numpy_cell(p + (i * cols + j) * width, width, kind == 'U');
+	    if (!token.empty()) {
+		column.list_tokens.back().push_back(token);
+	    }
+	}
+    }
+}
+
+void read_column(const py::object& data, Column& column) {
+    column.token_lists = false;
+    if (py::hasattr(data, "__arrow_c_array__")) {
+	py::tuple capsules = data.attr("__arrow_c_array__")();
+	auto schema = capsule_pointer<ArrowSchema>(capsules[0], "arrow_schema");
+	auto array = capsule_pointer<ArrowArray>(capsules[1], "arrow_array");
+	column.token_lists = arrow_is_token_lists(*schema);
+	read_arrow_array(*schema, *array, column);
+    }
+    else if (py::hasattr(data, "__arrow_c_stream__")) {
+	py::object capsule = data.attr("__arrow_c_stream__")();
+	read_arrow_stream(capsule_pointer<ArrowArrayStream>(capsule, "arrow_array_stream"), column);
+    }
+    else if (py::isinstance<py::array>(data)) {
+	read_numpy_strings(py::reinterpret_borrow<py::array>(data), column);
+    }
+    else {
+	throw std::invalid_argument("Expected an Arrow array or stream, or a NumPy array of strings");
+    }
+}
+
+template<typename T>
+py::object arrow_capsule(T* p, const char* name, void (*destructor)(PyObject*)) {
+    return py::reinterpret_steal<py::object>(PyCapsule_New(p, name, destructor));
+}
+
+// A read-only view of one of the buffers of a RaggedIds, which it keeps alive
+py::array ragged_view(const py::object& self, const VecList_T& v) {
+    py::array a = py::array_t<int32_t>(v.size(), v.data(), self);
+    a.attr("setflags")(py::arg("write")=false);
+    return a;
+}
+
+/*
+ * Vocabs pickle as a compiled directory (see Vocab::shared_dir) and their
+ * special tokens, so unpickling one, in a data loader worker say, maps the
+ * same files instead of reading the text files again.  An in-memory vocab
+ * is compiled into shared memory the first time it is pickled, and that
+ * copy lasts as long as the vocab, so a pickle is only good on the same
+ * machine while the vocab it came from is alive (and has not had tokens
+ * added twice since, see Vocab::_shared_dir)
+ */
+py::tuple vocab_state(const Vocab& vocab) {
+    std::string dir;
+    {
+	py::gil_scoped_release release;
+	dir = vocab.shared_dir();
+    }
+    return py::make_tuple(dir, vocab.pad_id(), vocab.start_id(), vocab.end_id(), vocab.unk_id(),
+			  vocab.pad_str(), vocab.start_str(), vocab.end_str(), vocab.unk_str(),
+			  vocab.extra_tokens());
+}
+
+struct VocabState {
+    std::string dir;
+    Index_T pad, start, end, unk;
+    std::string pad_str, start_str, end_str, unk_str;
+    TokenList_T extra_tokens;
+
+    VocabState(const py::tuple& t, size_t size=10) {
+	if (t.size() != size) {
+	    throw std::runtime_error("Not a pickled vocab");
+	}
+	dir = t[0].cast<std::string>();
+	pad = t[1].cast<Index_T>();
+	start = t[2].cast<Index_T>();
+	end = t[3].cast<Index_T>();
+	unk = t[4].cast<Index_T>();
+	pad_str = t[5].cast<std::string>();
+	start_str = t[6].cast<std::string>();
+	end_str = t[7].cast<std::string>();
+	unk_str = t[8].cast<std::string>();
+	extra_tokens = t[9].cast<TokenList_T>();
+    }
+};
+
 PYBIND11_MODULE(vecxx, m) {
 
     #ifdef VERSION_INFO
@@ -14,8 +294,10 @@ PYBIND11_MODULE(vecxx, m) {
     #endif
     m.doc() = "pybind11 vecxx plugin";
     py::class_<Vocab>(m, "Vocab")
-      .def("lookup", &Vocab::lookup)
-      .def("apply", &Vocab::apply)
+      .def("lookup", static_cast<PipelineLookup_T>(&Vocab::lookup))
+      .def("lookup", static_cast<FunctionLookup_T>(&Vocab::lookup))
+      .def("apply", static_cast<PipelineApply_T>(&Vocab::apply))
+      .def("apply", static_cast<FunctionApply_T>(&Vocab::apply))
       ;
     py::class_<BPEVocab, Vocab>(m, "BPEVocab")
       .def(py::init<std::string, std::string, Index_T, Index_T, Index_T, Index_T,
@@ -33,9 +315,15 @@ PYBIND11_MODULE(vecxx, m) {
 	   py::arg("extra_tokens")=TokenList_T()
 	   
 	   )
-      .def("lookup", &BPEVocab::lookup)
+      .def("lookup", static_cast<PipelineLookup_T>(&Vocab::lookup))
+      .def("lookup", static_cast<FunctionLookup_T>(&Vocab::lookup))
       .def("rlookup", &BPEVocab::rlookup)
-      .def("compile_vocab", &BPEVocab::compile_vocab)
+      .def("compile_vocab", &BPEVocab::compile_vocab,
+	   py::arg("target_dir"),
+	   py::arg("offset_width")=0
+	   )
+      .def("add_tokens", &BPEVocab::add_tokens, py::arg("tokens"))
+      .def("compile_delta", &BPEVocab::compile_delta, py::arg("target_dir"))
       .def_property_readonly("pad_id", &BPEVocab::pad_id)
       .def_property_readonly("start_id", &BPEVocab::start_id)
       .def_property_readonly("end_id", &BPEVocab::end_id)
@@ -46,7 +334,19 @@ PYBIND11_MODULE(vecxx, m) {
       .def_property_readonly("unk_str", &BPEVocab::unk_str)
       .def_readonly("special_tokens", &BPEVocab::special_tokens)
       .def_readonly("vocab", &BPEVocab::vocab)
-      .def("apply", &BPEVocab::apply)
+      .def("apply", static_cast<PipelineApply_T>(&Vocab::apply))
+      .def("apply", static_cast<FunctionApply_T>(&Vocab::apply))
+      .def("shared_dir", &BPEVocab::shared_dir, py::call_guard<py::gil_scoped_release>())
+      .def(py::pickle(
+	       [](const BPEVocab& vocab) {
+		   return vocab_state(vocab);
+	       },
+	       [](const py::tuple& t) {
+		   VocabState s(t);
+		   py::gil_scoped_release release;
+		   return new BPEVocab(s.dir, s.dir, s.pad, s.start, s.end, s.unk,
+				       s.pad_str, s.start_str, s.end_str, s.unk_str, s.extra_tokens);
+	       }))
       ;
       
     py::class_<WordVocab, Vocab>(m, "WordVocab")
@@ -93,8 +393,46 @@ PYBIND11_MODULE(vecxx, m) {
 	   py::arg("min_freq")=0
 	   
 	   )
-      .def("lookup", &WordVocab::lookup)
-      .def("compile_vocab", &WordVocab::compile_vocab)
+      .def_static("from_corpus",
+		  [](const TokenList_T& files, const std::string& splitter, const Transform_T& transform,
+		     int min_freq, size_t max_size, size_t num_threads,
+		     Index_T pad, Index_T start, Index_T end, Index_T unk,
+		     std::string pad_str, std::string start_str, std::string end_str, std::string unk_str,
+		     const TokenList_T& extra_tokens) {
+		      CorpusCounter counter(splitter, transform, num_threads);
+		      {
+			  // A Python transform will reacquire the GIL as it is called
+			  py::gil_scoped_release release;
+			  counter.count(files);
+		      }
+		      return new WordVocab(counter, pad, start, end, unk,
+					   pad_str, start_str, end_str, unk_str,
+					   extra_tokens, min_freq, max_size);
+		  },
+		  py::arg("files"),
+		  py::arg("splitter")=" ",
+		  py::arg("transform")=Transform_T(),
+		  py::arg("min_freq")=0,
+		  py::arg("max_size")=0,
+		  py::arg("num_threads")=0,
+		  py::arg("pad")=0,
+		  py::arg("start")=1,
+		  py::arg("end")=2,
+		  py::arg("unk")=3,
+		  py::arg("pad_str")="<PAD>",
+		  py::arg("start_str")="<GO>",
+		  py::arg("end_str")="<EOS>",
+		  py::arg("unk_str")="<UNK>",
+		  py::arg("extra_tokens")=TokenList_T()
+		  )
+      .def("lookup", static_cast<PipelineLookup_T>(&Vocab::lookup))
+      .def("lookup", static_cast<FunctionLookup_T>(&Vocab::lookup))
+      .def("compile_vocab", &WordVocab::compile_vocab,
+	   py::arg("target_dir"),
+	   py::arg("offset_width")=0
+	   )
+      .def("add_tokens", &WordVocab::add_tokens, py::arg("tokens"))
+      .def("compile_delta", &WordVocab::compile_delta, py::arg("target_dir"))
       .def_property_readonly("pad_id", &WordVocab::pad_id)
       .def_property_readonly("start_id", &WordVocab::start_id)
       .def_property_readonly("end_id", &WordVocab::end_id)
@@ -105,16 +443,269 @@ PYBIND11_MODULE(vecxx, m) {
       .def_property_readonly("unk_str", &WordVocab::unk_str)
       .def_readonly("special_tokens", &WordVocab::special_tokens)
       .def_readonly("vocab", &WordVocab::vocab)
-      .def("apply", &WordVocab::apply)
+      .def("apply", static_cast<PipelineApply_T>(&Vocab::apply))
+      .def("apply", static_cast<FunctionApply_T>(&Vocab::apply))
+      .def("shared_dir", &WordVocab::shared_dir, py::call_guard<py::gil_scoped_release>())
+      .def(py::pickle(
+	       [](const WordVocab& vocab) {
+		   return vocab_state(vocab);
+	       },
+	       [](const py::tuple& t) {
+		   VocabState s(t);
+		   py::gil_scoped_release release;
+		   return new WordVocab(s.dir, s.pad, s.start, s.end, s.unk,
+					s.pad_str, s.start_str, s.end_str, s.unk_str, s.extra_tokens);
+	       }))
+      ;
+
+    py::class_<ReloadableVocab, Vocab>(m, "ReloadableVocab")
+      .def(py::init<std::string, std::string, Index_T, Index_T, Index_T, Index_T,
+	   std::string, std::string, std::string, std::string, const TokenList_T&>(),
+	   py::arg("vocab_file"),
+	   py::arg("codes_file")="",
+	   py::arg("pad")=0,
+	   py::arg("start")=1,
+	   py::arg("end")=2,
+	   py::arg("unk")=3,
+	   py::arg("pad_str")="<PAD>",
+	   py::arg("start_str")="<GO>",
+	   py::arg("end_str")="<EOS>",
+	   py::arg("unk_str")="<UNK>",
+	   py::arg("extra_tokens")=TokenList_T()
+	   )
+      .def("reload", &ReloadableVocab::reload,
+	   py::arg("vocab_file"),
+	   py::arg("codes_file")="",
+	   py::call_guard<py::gil_scoped_release>()
+	   )
+      .def_property_readonly("version", &ReloadableVocab::version)
+      .def("lookup", static_cast<PipelineLookup_T>(&Vocab::lookup))
+      .def("lookup", static_cast<FunctionLookup_T>(&Vocab::lookup))
+      .def("rlookup", &ReloadableVocab::rlookup)
+      .def("compile_vocab", &ReloadableVocab::compile_vocab,
+	   py::arg("target_dir"),
+	   py::arg("offset_width")=0
+	   )
+      .def_property_readonly("pad_id", &ReloadableVocab::pad_id)
+      .def_property_readonly("start_id", &ReloadableVocab::start_id)
+      .def_property_readonly("end_id", &ReloadableVocab::end_id)
+      .def_property_readonly("unk_id", &ReloadableVocab::unk_id)
+      .def_property_readonly("pad_str", &ReloadableVocab::pad_str)
+      .def_property_readonly("start_str", &ReloadableVocab::start_str)
+      .def_property_readonly("end_str", &ReloadableVocab::end_str)
+      .def_property_readonly("unk_str", &ReloadableVocab::unk_str)
+      .def("apply", static_cast<PipelineApply_T>(&Vocab::apply))
+      .def("apply", static_cast<FunctionApply_T>(&Vocab::apply))
+      .def("shared_dir", &ReloadableVocab::shared_dir, py::call_guard<py::gil_scoped_release>())
+      // The current version is pickled, as a vocab that can still be reloaded
+      .def(py::pickle(
+	       [](const ReloadableVocab& vocab) {
+		   py::list state(vocab_state(vocab));
+		   state.append(vocab.is_bpe());
+		   return py::tuple(state);
+	       },
+	       [](const py::tuple& t) {
+		   VocabState s(t, 11);
+		   bool is_bpe = t[10].cast<bool>();
+		   py::gil_scoped_release release;
+		   return new ReloadableVocab(s.dir, is_bpe ? s.dir : "", s.pad, s.start, s.end, s.unk,
+					      s.pad_str, s.start_str, s.end_str, s.unk_str, s.extra_tokens);
+	       }))
       ;
     
-    py::class_<VocabVectorizer>(m, "VocabVectorizer")
-      .def(py::init<Vocab*, const TokenList_T&, const TokenList_T&>(),
+    m.def("count_corpus", &count_corpus,
+	  py::arg("files"),
+	  py::arg("splitter")=" ",
+	  py::arg("transform")=Transform_T(),
+	  py::arg("num_threads")=0,
+	  py::call_guard<py::gil_scoped_release>()
+	  );
+
+    m.def("native_transform",
+	  [](const std::string& name) {
+	      // Returned as a plain function, so passing it back as a
+	      // transform stays in C++
+	      return Transform_T(native_transform(name));
+	  },
+	  py::arg("name")
+	  );
+    m.def("native_transform_names", &native_transform_names);
+
+    py::class_<TransformPipeline>(m, "TransformPipeline")
+      .def(py::init<>())
+      .def(py::init<const std::string&>(),
+	   py::arg("spec")
+	   )
+      .def(py::init<const TokenList_T&>(),
+	   py::arg("names")
+	   )
+      .def("__call__",
+	   [](const TransformPipeline& pipeline, const std::string& s) {
+	       return std::string(pipeline.apply(s));
+	   },
+	   py::arg("s")
+	   )
+      .def(py::init([](const MemoizedTransform& memoized) {
+		  return new TransformPipeline(Transform_T(memoized));
+	      }),
+	   py::arg("transform")
+	   )
+      .def_property_readonly("names", &TransformPipeline::names)
+      .def_property_readonly("is_identity", &TransformPipeline::is_identity)
+      .def_property_readonly("is_native", &TransformPipeline::is_native)
+      .def(py::pickle(
+	       [](const TransformPipeline& pipeline) {
+		   if (!pipeline.is_native()) {
+		       throw py::type_error("Only a TransformPipeline of native steps can be pickled");
+		   }
+		   return pipeline.names();
+	       },
+	       [](const TokenList_T& names) {
+		   return new TransformPipeline(names);
+	       }))
+      ;
+
+    // There is deliberately no __call__: anything callable would be taken
+    // as a plain Python transform and called back through the interpreter,
+    // so this converts to a TransformPipeline instead
+    py::class_<MemoizedTransform>(m, "MemoizedTransform")
+      .def(py::init<const Transform_T&, size_t>(),
+	   py::arg("transform"),
+	   py::arg("capacity")=(size_t)TransformCache::DEFAULT_CAPACITY
+	   )
+      .def("apply", &MemoizedTransform::operator(),
+	   py::arg("s")
+	   )
+      .def("stats",
+	   [](const MemoizedTransform& memoized) {
+	       TransformCacheStats stats = memoized.cache().stats();
+	       py::dict d;
+	       d["hits"] = stats.hits;
+	       d["misses"] = stats.misses;
+	       d["evictions"] = stats.evictions;
+	       d["size"] = stats.size;
+	       d["capacity"] = stats.capacity;
+	       d["hit_rate"] = stats.hit_rate();
+	       return d;
+	   })
+      .def("clear",
+	   [](const MemoizedTransform& memoized) {
+	       memoized.cache().clear();
+	   })
+      ;
+    py::implicitly_convertible<MemoizedTransform, TransformPipeline>();
+
+    m.def("compact_vocab", &compact_vocab,
+	  py::arg("dir"),
+	  py::arg("target_dir")
+	  );
+
+    py::class_<SpecialTokenScanner>(m, "SpecialTokenScanner")
+      .def(py::init<const TokenList_T&>(),
+	   py::arg("tokens")
+	   )
+      .def(py::init([](const Vocab& vocab) {
+		  return new SpecialTokenScanner(vocab.get_special_tokens());
+	      }),
+	   py::arg("vocab")
+	   )
+      .def("scan",
+	   [](const SpecialTokenScanner& scanner, const std::string& text) {
+	       std::vector<std::tuple<std::string, bool> > spans;
+	       for (auto& span : scanner.spans(text)) {
+		   spans.push_back(std::make_tuple(text.substr(span.begin, span.end - span.begin), span.special));
+	       }
+	       return spans;
+	   },
+	   py::arg("text")
+	   )
+      .def("tokenize", &SpecialTokenScanner::tokenize,
+	   py::arg("text")
+	   )
+      ;
+
+    py::class_<PreTokenizer>(m, "PreTokenizer")
+      .def(py::init<const TokenList_T&, const std::string&, const std::string&>(),
+	   py::arg("special_tokens")=TokenList_T(),
+	   py::arg("whitespace")=WHITESPACE,
+	   py::arg("punctuation")=""
+	   )
+      .def(py::init([](const Vocab& vocab, const std::string& whitespace, const std::string& punctuation) {
+		  return new PreTokenizer(vocab.get_special_tokens(), whitespace, punctuation);
+	      }),
 	   py::arg("vocab"),
+	   py::arg("whitespace")=WHITESPACE,
+	   py::arg("punctuation")=""
+	   )
+      .def("tokenize", static_cast<TokenList_T (PreTokenizer::*)(const std::string&) const>(&PreTokenizer::tokenize),
+	   py::arg("text")
+	   )
+      .def_property_readonly("special_tokens", &PreTokenizer::special_tokens)
+      .def_property_readonly("whitespace", &PreTokenizer::whitespace)
+      .def_property_readonly("punctuation", &PreTokenizer::punctuation)
+      .def(py::pickle(
+	       [](const PreTokenizer& pretokenizer) {
+		   return py::make_tuple(pretokenizer.special_tokens(), pretokenizer.whitespace(), pretokenizer.punctuation());
+	       },
+	       [](const py::tuple& t) {
+		   return new PreTokenizer(t[0].cast<TokenList_T>(), t[1].cast<std::string>(), t[2].cast<std::string>());
+	       }))
+      ;
+
+    py::class_<RaggedIds>(m, "RaggedIds")
+      .def("__len__", &RaggedIds::size)
+      .def_property_readonly("values", [](const py::object& self) {
+	      return ragged_view(self, self.cast<const RaggedIds&>().values());
+	  })
+      .def_property_readonly("offsets", [](const py::object& self) {
+	      return ragged_view(self, self.cast<const RaggedIds&>().offsets());
+	  })
+      // The Arrow PyCapsule interface, so pyarrow.array() takes this as a list<int32> array
+      .def("__arrow_c_array__", [](const RaggedIds& ids, const py::object& requested_schema) {
+	      std::unique_ptr<ArrowSchema> schema(new ArrowSchema());
+	      std::unique_ptr<ArrowArray> array(new ArrowArray());
+	      ids.export_arrow(schema.get(), array.get());
+	      auto schema_capsule = arrow_capsule(schema.release(), "arrow_schema", [](PyObject* capsule) {
+		      auto p = (ArrowSchema*)PyCapsule_GetPointer(capsule, "arrow_schema");
+		      if (p->release != NULL) {
+			  p->release(p);
+		      }
+		      delete p;
+		  });
+	      auto array_capsule = arrow_capsule(array.release(), "arrow_array", [](PyObject* capsule) {
+		      auto p = (ArrowArray*)PyCapsule_GetPointer(capsule, "arrow_array");
+		      if (p->release != NULL) {
+			  p->release(p);
+		      }
+		      delete p;
+		  });
+	      return py::make_tuple(schema_capsule, array_capsule);
+	  },
+	  py::arg("requested_schema")=py::none()
+	  )
+      ;
+
+    // Built with make_vocab_vectorizer, so common setups get a VocabVectorizerT
+    // Unpickled vectorizers keep their vocab alive in __dict__
+    py::class_<VocabVectorizer>(m, "VocabVectorizer", py::dynamic_attr())
+      .def(py::init([](Vocab* vocab, const TokenList_T& emit_begin_tok, const TokenList_T& emit_end_tok) {
+		  return make_vocab_vectorizer(vocab, TransformPipeline(), emit_begin_tok, emit_end_tok);
+	      }),
+	   py::arg("vocab"),
+	   py::arg("emit_begin_tok")=TokenList_T(),
+	   py::arg("emit_end_tok")=TokenList_T()
+	   )
+      .def(py::init([](Vocab* vocab, const TransformPipeline& transform, const TokenList_T& emit_begin_tok, const TokenList_T& emit_end_tok) {
+		  return make_vocab_vectorizer(vocab, transform, emit_begin_tok, emit_end_tok);
+	      }),
+	   py::arg("vocab"),
+	   py::arg("transform"),
 	   py::arg("emit_begin_tok")=TokenList_T(),
 	   py::arg("emit_end_tok")=TokenList_T()
 	   )
-      .def(py::init<Vocab*, const Transform_T&, const TokenList_T&, const TokenList_T&>(),
+      .def(py::init([](Vocab* vocab, const Transform_T& transform, const TokenList_T& emit_begin_tok, const TokenList_T& emit_end_tok) {
+		  return make_vocab_vectorizer(vocab, TransformPipeline(transform), emit_begin_tok, emit_end_tok);
+	      }),
 	   py::arg("vocab"),
 	   py::arg("transform"),
 	   py::arg("emit_begin_tok")=TokenList_T(),
@@ -123,16 +714,153 @@ PYBIND11_MODULE(vecxx, m) {
       .def("decode", &VocabVectorizer::decode)
       .def("piece_to_id", &VocabVectorizer::piece_to_id)
       .def("convert_to_pieces", &VocabVectorizer::convert_to_pieces,
-	   py::arg("tokens")
+	   py::arg("tokens"),
+	   py::call_guard<py::gil_scoped_release>()
 	   )
       .def("convert_to_ids", &VocabVectorizer::convert_to_ids,
 	   py::arg("tokens"),
-	   py::arg("max_len")=0
+	   py::arg("max_len")=0,
+	   py::call_guard<py::gil_scoped_release>()
 	   )
-      .def("convert_to_ids_stack", &VocabVectorizer::convert_to_ids_stack,
+      .def("convert_to_ids_stack",
+	   [](const VocabVectorizer& vec, const ListTokenList_T& tokens, long unsigned int len, bool native_only) {
+	       check_native_only(vec, native_only);
+	       py::gil_scoped_release release;
+	       return vec.convert_to_ids_stack(tokens, len);
+	   },
 	   py::arg("tokens"),
-	   py::arg("len")
+	   py::arg("len"),
+	   py::arg("native_only")=false
 	   )
+      .def("encode_text", &VocabVectorizer::encode_text,
+	   py::arg("text"),
+	   py::arg("max_len")=0,
+	   py::call_guard<py::gil_scoped_release>()
+	   )
+      .def("encode_text_stack",
+	   [](const VocabVectorizer& vec, const TokenList_T& texts, long unsigned int len, bool native_only) {
+	       check_native_only(vec, native_only);
+	       py::gil_scoped_release release;
+	       return vec.encode_text_stack(texts, len);
+	   },
+	   py::arg("texts"),
+	   py::arg("len"),
+	   py::arg("native_only")=false
+	   )
+      .def("convert_to_ids_array",
+	   [](const VocabVectorizer& vec, const TokenList_T& tokens, long unsigned int max_len, const py::object& dtype, const py::object& out) {
+	       std::tuple<VecList_T, long unsigned int> rv;
+	       if (out.is_none()) {
+		   bool int64 = is_int64(dtype);
+		   {
+		       py::gil_scoped_release release;
+		       rv = vec.convert_to_ids(tokens, max_len);
+		   }
+		   size_t n = std::get<0>(rv).size();
+		   return py::make_tuple(to_array(std::move(std::get<0>(rv)), {n}, int64), std::get<1>(rv));
+	       }
+	       // The row is as long as out, so only it is copied
+	       if (!py::isinstance<py::array>(out) || py::reinterpret_borrow<py::array>(out).ndim() != 1) {
+		   throw std::invalid_argument("out must be a 1-D NumPy array");
+	       }
+	       size_t n = py::reinterpret_borrow<py::array>(out).shape(0);
+	       if (max_len != 0 && max_len != n) {
+		   throw std::invalid_argument("max_len does not match the length of out");
+	       }
+	       py::array a = check_out(out, {n});
+	       bool int64 = is_int64(a.dtype());
+	       void* p = a.mutable_data();
+	       {
+		   py::gil_scoped_release release;
+		   rv = vec.convert_to_ids(tokens, n);
+		   auto& ids = std::get<0>(rv);
+		   if (int64) {
+		       std::copy(ids.begin(), ids.end(), (int64_t*)p);
+		   }
+		   else {
+		       std::copy(ids.begin(), ids.end(), (int*)p);
+		   }
+	       }
+	       return py::make_tuple(a, std::get<1>(rv));
+	   },
+	   py::arg("tokens"),
+	   py::arg("max_len")=0,
+	   py::arg("dtype")="int32",
+	   py::arg("out")=py::none()
+	   )
+      .def("convert_to_ids_stack_array",
+	   [](const VocabVectorizer& vec, const ListTokenList_T& tokens, long unsigned int len, const py::object& dtype, const py::object& out, bool native_only) {
+	       check_native_only(vec, native_only);
+	       return encode_stack_array(tokens.size(), len, dtype, out, [&](int* ids, int* lengths) {
+		       vec.convert_to_ids_stack_into(tokens, len, ids, lengths);
+		   });
+	   },
+	   py::arg("tokens"),
+	   py::arg("len"),
+	   py::arg("dtype")="int32",
+	   py::arg("out")=py::none(),
+	   py::arg("native_only")=false
+	   )
+      .def("encode_text_stack_array",
+	   [](const VocabVectorizer& vec, const TokenList_T& texts, long unsigned int len, const py::object& dtype, const py::object& out, bool native_only) {
+	       check_native_only(vec, native_only);
+	       return encode_stack_array(texts.size(), len, dtype, out, [&](int* ids, int* lengths) {
+		       vec.encode_text_stack_into(texts, len, ids, lengths);
+		   });
+	   },
+	   py::arg("texts"),
+	   py::arg("len"),
+	   py::arg("dtype")="int32",
+	   py::arg("out")=py::none(),
+	   py::arg("native_only")=false
+	   )
+      .def("encode_column",
+	   [](const VocabVectorizer& vec, const py::object& column, long unsigned int max_len, bool native_only) {
+	       check_native_only(vec, native_only);
+	       Column c;
+	       read_column(column, c);
+	       VecList_T ids;
+	       VecList_T offsets;
+	       {
+		   py::gil_scoped_release release;
+		   if (c.token_lists) {
+		       vec.convert_to_ids_ragged(c.list_tokens, max_len, ids, offsets);
+		   }
+		   else {
+		       vec.encode_text_ragged(c.texts, max_len, ids, offsets);
+		   }
+	       }
+	       return RaggedIds(std::move(ids), std::move(offsets));
+	   },
+	   py::arg("column"),
+	   py::arg("max_len")=0,
+	   py::arg("native_only")=false
+	   )
+      .def_property("pretokenizer", &VocabVectorizer::pretokenizer, &VocabVectorizer::set_pretokenizer)
+      .def_property("num_threads", &VocabVectorizer::num_threads, &VocabVectorizer::set_num_threads)
+      // The vocab is pickled along with it, see the vocabs for how
+      .def(py::pickle(
+	       [](const py::object& self) {
+		   auto& vec = self.cast<const VocabVectorizer&>();
+		   if (!vec.transform().is_native()) {
+		       throw py::type_error("A vectorizer with a Python transform cannot be pickled, use a TransformPipeline");
+		   }
+		   return py::make_tuple(py::cast(vec.vocab(), py::return_value_policy::reference),
+					 vec.transform().names(), vec.emit_begin_tok(), vec.emit_end_tok(),
+					 vec.num_threads(), vec.pretokenizer(), self.attr("__dict__"));
+	       },
+	       [](const py::tuple& t) {
+		   if (t.size() != 7) {
+		       throw std::runtime_error("Not a pickled VocabVectorizer");
+		   }
+		   auto vec = make_vocab_vectorizer(t[0].cast<Vocab*>(), TransformPipeline(t[1].cast<TokenList_T>()),
+						    t[2].cast<TokenList_T>(), t[3].cast<TokenList_T>());
+		   vec->set_num_threads(t[4].cast<size_t>());
+		   vec->set_pretokenizer(t[5].cast<PreTokenizer>());
+		   py::dict d = t[6].cast<py::dict>();
+		   d["_vocab"] = t[0];
+		   return std::make_pair(vec, d);
+	       }))
       .def("count_pieces", &VocabVectorizer::count_pieces,
 	   py::arg("tokens")
 	   )
@@ -146,6 +874,14 @@ PYBIND11_MODULE(vecxx, m) {
 	   py::arg("fields")=TokenList_T(),
 	   py::arg("delim")="~~"
 	   )
+      .def(py::init<Vocab*, const TransformPipeline&, const TokenList_T&, const TokenList_T&, const TokenList_T&, std::string>(),
+	   py::arg("vocab"),
+	   py::arg("transform"),
+	   py::arg("emit_begin_tok")=TokenList_T(),
+	   py::arg("emit_end_tok")=TokenList_T(),
+	   py::arg("fields")=TokenList_T(),
+	   py::arg("delim")="~~"
+	   )
       .def(py::init<Vocab*, const Transform_T&, const TokenList_T&, const TokenList_T&, const TokenList_T&, std::string>(),
 	   py::arg("vocab"),
 	   py::arg("transform"),
@@ -156,15 +892,73 @@ PYBIND11_MODULE(vecxx, m) {
 	   )
       .def("piece_to_id", &VocabMapVectorizer::piece_to_id)
       .def("convert_to_pieces", &VocabMapVectorizer::convert_to_pieces,
-	   py::arg("tokens")
+	   py::arg("tokens"),
+	   py::call_guard<py::gil_scoped_release>()
 	   )
       .def("convert_to_ids", &VocabMapVectorizer::convert_to_ids,
 	   py::arg("tokens"),
-	   py::arg("max_len")=0
+	   py::arg("max_len")=0,
+	   py::call_guard<py::gil_scoped_release>()
+	   )
+      .def("convert_to_pieces_columns", &VocabMapVectorizer::convert_to_pieces_columns,
+	   py::arg("columns"),
+	   py::call_guard<py::gil_scoped_release>()
+	   )
+      .def("convert_to_ids_columns", &VocabMapVectorizer::convert_to_ids_columns,
+	   py::arg("columns"),
+	   py::arg("max_len")=0,
+	   py::call_guard<py::gil_scoped_release>()
+	   )
+      .def("convert_to_ids_stack",
+	   [](const VocabMapVectorizer& vec, const ListTokenMapList_T& tokens, long unsigned int len, bool native_only) {
+	       check_native_only(vec, native_only);
+	       py::gil_scoped_release release;
+	       return vec.convert_to_ids_stack(tokens, len);
+	   },
+	   py::arg("tokens"),
+	   py::arg("len"),
+	   py::arg("native_only")=false
+	   )
+      .def("convert_to_ids_stack_array",
+	   [](const VocabMapVectorizer& vec, const ListTokenMapList_T& tokens, long unsigned int len, const py::object& dtype, const py::object& out, bool native_only) {
+	       check_native_only(vec, native_only);
+	       return encode_stack_array(tokens.size(), len, dtype, out, [&](int* ids, int* lengths) {
+		       vec.convert_to_ids_stack_into(tokens, len, ids, lengths);
+		   });
+	   },
+	   py::arg("tokens"),
+	   py::arg("len"),
+	   py::arg("dtype")="int32",
+	   py::arg("out")=py::none(),
+	   py::arg("native_only")=false
+	   )
+      .def("convert_to_ids_columns_stack",
+	   [](const VocabMapVectorizer& vec, const ListColumns_T& columns, long unsigned int len, bool native_only) {
+	       check_native_only(vec, native_only);
+	       py::gil_scoped_release release;
+	       return vec.convert_to_ids_columns_stack(columns, len);
+	   },
+	   py::arg("columns"),
+	   py::arg("len"),
+	   py::arg("native_only")=false
+	   )
+      .def("convert_to_ids_columns_stack_array",
+	   [](const VocabMapVectorizer& vec, const ListColumns_T& columns, long unsigned int len, const py::object& dtype, const py::object& out, bool native_only) {
+	       check_native_only(vec, native_only);
+	       return encode_stack_array(columns.size(), len, dtype, out, [&](int* ids, int* lengths) {
+		       vec.convert_to_ids_columns_stack_into(columns, len, ids, lengths);
+		   });
+	   },
+	   py::arg("columns"),
+	   py::arg("len"),
+	   py::arg("dtype")="int32",
+	   py::arg("out")=py::none(),
+	   py::arg("native_only")=false
 	   )
       .def("count_pieces", &VocabMapVectorizer::count_pieces,
 	   py::arg("tokens")
 	   )
+      .def_property("num_threads", &VocabMapVectorizer::num_threads, &VocabMapVectorizer::set_num_threads)
       ;
 
     
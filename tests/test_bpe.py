@@ -65,6 +65,54 @@ def test_bpe_lookup():
     ids = [bpe.lookup(s, str.lower) for s in toks]
     assert ids == TEST_IDS_GOLD
 
+def test_extra_tokens_lookup():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k"),
+        extra_tokens=["<MASK>"]
+    )
+    # Regular ids move up by one to make room for the extra token
+    assert bpe.lookup("<MASK>", str.lower) == 4
+    assert bpe.lookup("<GO>", str.lower) == 1
+    assert bpe.lookup("name", str.lower) == 266
+    # Special tokens only match verbatim
+    assert bpe.lookup("<mask>", str.lower) == bpe.unk_id
+    vec = VocabVectorizer(bpe, transform=str.lower)
+    assert vec.convert_to_pieces(["My", "<MASK>", "name"]) == ["my", "<MASK>", "name"]
+    assert vec.decode([1, 31, 266, 2]) == "my name"
+
+def test_special_token_scanner():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    scanner = SpecialTokenScanner(bpe)
+    text = "<GO>" + TEST_SENTENCE + "<EOS>"
+    assert scanner.scan("a<GO>b") == [("a", False), ("<GO>", True), ("b", False)]
+    tokens = scanner.tokenize(text)
+    assert tokens == ["<GO>"] + TEST_SENTENCE.split() + ["<EOS>"]
+    vec = VocabVectorizer(bpe, transform=str.lower)
+    v, l = vec.convert_to_ids(tokens)
+    assert v == TEST_IDS_GOLD
+
+def test_encode_text():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    vec = VocabVectorizer(bpe, transform=str.lower)
+    v, l = vec.encode_text("<GO>" + TEST_SENTENCE + "<EOS>")
+    assert v == TEST_IDS_GOLD
+    assert l == len(TEST_IDS_GOLD)
+    v, l = vec.encode_text("<GO>" + TEST_SENTENCE, 5)
+    assert v == TEST_IDS_GOLD[:5]
+
+    pretokenizer = PreTokenizer(bpe, punctuation=".,")
+    assert pretokenizer.tokenize("Ann Arbor, Michigan.<EOS>") == ["Ann", "Arbor", ",", "Michigan", ".", "<EOS>"]
+    vec.pretokenizer = pretokenizer
+    v, l = vec.encode_text("<GO>My name is Dan. I am from Ann Arbor, Michigan, in Washtenaw County<EOS>")
+    assert v == TEST_IDS_GOLD
+
 def test_compile():
     bpe = BPEVocab(
         vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
@@ -81,6 +129,28 @@ def test_compile():
     assert v == TEST_IDS_GOLD
     assert l == len(TEST_IDS_GOLD)
 
+def test_compiled_native_lower():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    compiled_path = os.path.join(TEST_DATA, "vocab.30k.ph")
+    bpe.compile_vocab(compiled_path)
+    compiled = BPEVocab(
+        vocab_file=compiled_path,
+        codes_file=compiled_path
+    )
+    sentences = [TEST_SENTENCE.split(), "<GO> Café NAÏVE Москва <EOS>".split()]
+    for vocab in [bpe, compiled]:
+        vec = VocabVectorizer(vocab, transform=TransformPipeline("lower"), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+        generic = VocabVectorizer(vocab, transform=str.lower, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+        v, l = vec.convert_to_ids(TEST_SENTENCE.split())
+        assert v == TEST_IDS_GOLD
+        for sentence in sentences:
+            assert vec.convert_to_pieces(sentence) == generic.convert_to_pieces(sentence)
+            assert vec.convert_to_ids(sentence) == generic.convert_to_ids(sentence)
+        assert vec.convert_to_ids_stack(sentences, 12) == generic.convert_to_ids_stack(sentences, 12)
+
 def test_ids():
     bpe = BPEVocab(
         vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
@@ -151,6 +221,134 @@ def test_ids_stack():
         assert len(v[:l]) == 5
         assert all([a == b for a, b in zip(v[:l], t[:5])])
 
+def test_ids_stack_threads():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    vec = VocabVectorizer(bpe, transform=TransformPipeline("lower"), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    batch = [t.split() for t in TEST_N_SENTENCES] * 50
+    vec.num_threads = 1
+    serial = vec.convert_to_ids_stack(batch, 12)
+    for num_threads in [0, 2, 4]:
+        vec.num_threads = num_threads
+        assert vec.num_threads == num_threads
+        assert vec.convert_to_ids_stack(batch, 12) == serial
+    nv, nl = serial
+    nv = np.array(nv).reshape((len(batch), 12))
+    for v, l, t in zip(nv, nl, TEST_N_IDS_GOLD * 50):
+        assert list(v[:l]) == t
+
+def test_ids_stack_python_threads():
+    from concurrent.futures import ThreadPoolExecutor
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    vec = VocabVectorizer(bpe, transform=TransformPipeline("lower"), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    vec.num_threads = 1
+    batches = [TEST_N_SENTENCES * (i + 1) for i in range(16)]
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        results = list(pool.map(lambda texts: vec.encode_text_stack(texts, 12, native_only=True), batches))
+    for texts, (nv, nl) in zip(batches, results):
+        assert (nv, nl) == vec.convert_to_ids_stack([t.split() for t in texts], 12)
+        assert list(nv[:nl[0]]) == TEST_N_IDS_GOLD[0]
+
+    python_vec = VocabVectorizer(bpe, transform=str.lower, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        python_results = list(pool.map(lambda texts: python_vec.encode_text_stack(texts, 12), batches))
+    assert python_results == results
+    with pytest.raises(ValueError):
+        python_vec.encode_text_stack(TEST_N_SENTENCES, 12, native_only=True)
+
+def test_ids_stack_array():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    vec = VocabVectorizer(bpe, transform=TransformPipeline("lower"), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    batch = [t.split() for t in TEST_N_SENTENCES]
+    nv, nl = vec.convert_to_ids_stack(batch, 12)
+
+    av, al = vec.convert_to_ids_stack_array(batch, 12)
+    assert av.dtype == np.int32 and av.shape == (len(batch), 12)
+    assert av.ravel().tolist() == nv and al.tolist() == nl
+
+    av, al = vec.convert_to_ids_stack_array(batch, 12, dtype=np.int64)
+    assert av.dtype == np.int64 and av.ravel().tolist() == nv
+
+    for dtype in [np.int32, np.int64]:
+        out = np.full((len(batch), 12), -1, dtype=dtype)
+        av, al = vec.convert_to_ids_stack_array(batch, 12, out=out)
+        assert av is out and out.ravel().tolist() == nv and al.tolist() == nl
+    av, al = vec.encode_text_stack_array(TEST_N_SENTENCES, 12)
+    assert av.ravel().tolist() == nv
+
+    out = np.zeros(32, dtype=np.int32)
+    v, l = vec.convert_to_ids_array(TEST_SENTENCE.split(), out=out)
+    assert v is out and out[:l].tolist() == TEST_IDS_GOLD and np.sum(out[l:]) == 0
+
+    with pytest.raises(ValueError):
+        vec.convert_to_ids_stack_array(batch, 12, out=np.zeros((len(batch), 11), dtype=np.int32))
+    with pytest.raises(ValueError):
+        vec.convert_to_ids_stack_array(batch, 12, out=np.zeros((12, len(batch)), dtype=np.int32).T)
+    with pytest.raises(ValueError):
+        vec.convert_to_ids_stack_array(batch, 12, dtype=np.float32)
+
+def test_encode_column():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    vec = VocabVectorizer(bpe, transform=TransformPipeline("lower"), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    gold = [vec.encode_text(t)[0] for t in TEST_N_SENTENCES]
+
+    def rows(ids):
+        values, offsets = ids.values.tolist(), ids.offsets.tolist()
+        return [values[offsets[i]:offsets[i + 1]] for i in range(len(ids))]
+
+    assert rows(vec.encode_column(np.array(TEST_N_SENTENCES))) == gold
+    assert rows(vec.encode_column(np.array([t.encode("utf-8") for t in TEST_N_SENTENCES]))) == gold
+    assert rows(vec.encode_column(np.array(TEST_N_SENTENCES), max_len=5)) == [g[:5] for g in gold]
+    tokens = [t.split() for t in TEST_N_SENTENCES]
+    width = max(len(t) for t in tokens)
+    padded = np.array([t + [""] * (width - len(t)) for t in tokens])
+    assert rows(vec.encode_column(padded)) == [vec.convert_to_ids(t)[0] for t in tokens]
+    with pytest.raises(ValueError):
+        vec.encode_column(np.zeros(3))
+
+    pa = pytest.importorskip("pyarrow")
+    ids = vec.encode_column(pa.array(TEST_N_SENTENCES))
+    out = pa.array(ids)
+    assert out.type == pa.list_(pa.int32())
+    assert out.to_pylist() == gold
+    assert pa.array(vec.encode_column(pa.array(tokens))).to_pylist() == [vec.convert_to_ids(t)[0] for t in tokens]
+    chunked = pa.chunked_array([TEST_N_SENTENCES[:1], TEST_N_SENTENCES[1:]], type=pa.large_string())
+    assert pa.array(vec.encode_column(chunked)).to_pylist() == gold
+
+def test_pickle():
+    import pickle
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    vec = VocabVectorizer(bpe, transform=TransformPipeline("lower"), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    vec.num_threads = 2
+    copy = pickle.loads(pickle.dumps(vec))
+    assert copy.num_threads == 2
+    v, l = copy.convert_to_ids(TEST_SENTENCE.split())
+    assert v == TEST_IDS_GOLD
+    assert copy.encode_text_stack(TEST_N_SENTENCES, 12) == vec.encode_text_stack(TEST_N_SENTENCES, 12)
+
+    # The copy's vocab is mapped from a compiled directory, so pickling it
+    # again passes on the same directory
+    vocab = copy._vocab
+    assert vocab.shared_dir() == bpe.shared_dir()
+    assert pickle.loads(pickle.dumps(vocab)).shared_dir() == bpe.shared_dir()
+
+    with pytest.raises(TypeError):
+        pickle.dumps(VocabVectorizer(bpe, transform=str.lower))
+
 def test_ids_map():
     bpe = BPEVocab(
         vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
@@ -169,3 +367,160 @@ def test_ids_map():
     assert np.sum(v[l+1:]) == 0
     assert l == len(TEST_IDS_GOLD)
 
+
+def test_ids_map_columns():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    words = TEST_SENTENCE.split()
+    tags = ["X" if i % 2 else "" for i in range(len(words))]
+    map_tokens = [{"text": w, "tag": t} for w, t in zip(words, tags)]
+
+    vec = VocabMapVectorizer(bpe, transform=str.lower, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    assert vec.convert_to_ids_columns([words]) == (TEST_IDS_GOLD, len(TEST_IDS_GOLD))
+
+    vec = VocabMapVectorizer(bpe, transform=str.lower, fields=["text", "tag"], delim="~~")
+    assert vec.convert_to_pieces_columns([words, tags]) == vec.convert_to_pieces(map_tokens)
+    assert vec.convert_to_ids_columns([words, tags], 64) == vec.convert_to_ids(map_tokens, 64)
+    with pytest.raises(RuntimeError):
+        vec.convert_to_ids_columns([words, tags[1:]])
+
+
+def test_ids_map_stack():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    vec = VocabMapVectorizer(bpe, transform=TransformPipeline(["lower"]), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"],
+                             fields=["text", "tag"], delim="~~")
+    batch = []
+    columns = []
+    for i in range(200):
+        words = TEST_N_SENTENCES[i % len(TEST_N_SENTENCES)].split()
+        tags = ["X" if j % 2 else "" for j in range(len(words))]
+        batch.append([{"text": w, "tag": t} for w, t in zip(words, tags)])
+        columns.append([words, tags])
+    serial = vec.convert_to_ids_stack(batch, 12)
+    nv = np.array(serial[0]).reshape((len(batch), 12))
+    for tokens, row, row_len in zip(batch, nv, serial[1]):
+        assert vec.convert_to_ids(tokens, 12) == (row.tolist(), row_len)
+    vec.num_threads = 4
+    assert vec.convert_to_ids_stack(batch, 12) == serial
+    assert vec.convert_to_ids_columns_stack(columns, 12) == serial
+    av, al = vec.convert_to_ids_columns_stack_array(columns, 12)
+    assert av.dtype == np.int32 and av.ravel().tolist() == serial[0] and al.tolist() == serial[1]
+    av, al = vec.convert_to_ids_stack_array(batch, 12, dtype=np.int64)
+    assert av.dtype == np.int64 and av.shape == (len(batch), 12)
+    with pytest.raises(RuntimeError):
+        vec.convert_to_ids_columns_stack([columns[0], [columns[1][0], columns[1][1][1:]]], 12)
+    with pytest.raises(ValueError):
+        VocabMapVectorizer(bpe, transform=str.lower).convert_to_ids_stack(batch, 12, native_only=True)
+
+
+def test_compile_64bit_offsets():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    compiled_path = os.path.join(TEST_DATA, "vocab.30k.64.ph")
+    bpe.compile_vocab(compiled_path, offset_width=8)
+    for store in ["ph-vocab", "ph-codes", "ph-rcodes"]:
+        with open(os.path.join(compiled_path, store, "md.txt")) as f:
+            assert f.read().split()[-1] == "8"
+    bpe = BPEVocab(
+        vocab_file=compiled_path,
+        codes_file=compiled_path
+    )
+    vec = VocabVectorizer(bpe, transform=str.lower, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    v, l = vec.convert_to_ids(TEST_SENTENCE.split())
+    assert v == TEST_IDS_GOLD
+    assert [bpe.rlookup(i) for i in v[1:-1]] == TEST_REVERSE_GOLD[1:-1]
+    with pytest.raises(ValueError):
+        bpe.compile_vocab(compiled_path, offset_width=2)
+
+
+def test_special_token_in_vocab_file(tmp_path):
+    vocab_file = str(tmp_path / "vocab.unk")
+    with open(os.path.join(TEST_DATA, "vocab.30k")) as f:
+        lines = f.readlines()
+    with open(vocab_file, "w") as f:
+        f.writelines(["<UNK> 5\n"] + lines)
+    bpe = BPEVocab(vocab_file=vocab_file, codes_file=os.path.join(TEST_DATA, "codes.30k"))
+    assert bpe.lookup("<UNK>", str.lower) == 3
+    assert bpe.rlookup(4) == "<UNK>"
+    compiled_path = str(tmp_path / "vocab.unk.ph")
+    bpe.compile_vocab(compiled_path)
+    bpe = BPEVocab(vocab_file=compiled_path, codes_file=compiled_path)
+    assert bpe.lookup("<UNK>", str.lower) == 3
+    assert bpe.rlookup(4) == "<UNK>"
+
+
+def test_add_tokens_compiled():
+    bpe = BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    compiled_path = os.path.join(TEST_DATA, "vocab.30k.delta.ph")
+    bpe.compile_vocab(compiled_path)
+    bpe = BPEVocab(
+        vocab_file=compiled_path,
+        codes_file=compiled_path
+    )
+    unk = bpe.lookup("covid", str.lower)
+    county = bpe.lookup("county", str.lower)
+    bpe.add_tokens(["covid", "county"])
+    covid = bpe.lookup("covid", str.lower)
+    assert covid != unk
+    assert bpe.lookup("county", str.lower) == county
+    bpe.compile_delta(compiled_path)
+
+    bpe = BPEVocab(
+        vocab_file=compiled_path,
+        codes_file=compiled_path
+    )
+    assert bpe.lookup("covid", str.lower) == covid
+    assert bpe.rlookup(covid) == "covid"
+
+    compacted_path = os.path.join(TEST_DATA, "vocab.30k.compact.ph")
+    compact_vocab(compiled_path, compacted_path)
+    bpe = BPEVocab(
+        vocab_file=compacted_path,
+        codes_file=compacted_path
+    )
+    assert bpe.lookup("covid", str.lower) == covid
+    vec = VocabVectorizer(bpe, transform=str.lower, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    v, l = vec.convert_to_ids(TEST_SENTENCE.split())
+    assert v == TEST_IDS_GOLD
+
+def test_reloadable_vocab():
+    compiled_path = os.path.join(TEST_DATA, "vocab.30k.reload.ph")
+    BPEVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    ).compile_vocab(compiled_path)
+    bpe = ReloadableVocab(
+        vocab_file=os.path.join(TEST_DATA, "vocab.30k"),
+        codes_file=os.path.join(TEST_DATA, "codes.30k")
+    )
+    vec = VocabVectorizer(bpe, transform=str.lower, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    v, l = vec.convert_to_ids(TEST_SENTENCE.split())
+    assert v == TEST_IDS_GOLD
+    assert bpe.version == 0
+
+    import threading
+    reloader = threading.Thread(target=bpe.reload, args=(compiled_path, compiled_path))
+    reloader.start()
+    while reloader.is_alive():
+        v, l = vec.convert_to_ids(TEST_SENTENCE.split())
+        assert v == TEST_IDS_GOLD
+    reloader.join()
+    assert bpe.version == 1
+    v, l = vec.convert_to_ids(TEST_SENTENCE.split())
+    assert v == TEST_IDS_GOLD
+
+    # A failed reload keeps the current version
+    with pytest.raises(Exception):
+        bpe.reload("i dont exist", compiled_path)
+    assert bpe.version == 1
+    assert vec.decode(v) == TEST_SENTENCE.lower()
@@ -44,6 +44,13 @@ def test_word_lookup():
     ids = [words.lookup(s, str.lower) for s in toks]
     assert ids == TEST_IDS_GOLD
 
+def test_add_tokens_empty_vocab():
+    words = WordVocab([], extra_tokens=["<X>"])
+    words.add_tokens(["a", "b"])
+    ids = [words.lookup(t, str.lower) for t in ["a", "b", "<PAD>", "<X>"]]
+    assert ids == [5, 6, 0, 4]
+
+
 def test_ids():
     words = WordVocab(
         COUNTS
@@ -74,3 +81,134 @@ def test_ids_map():
     assert v[:l] == TEST_IDS_GOLD
     assert np.sum(v[l+1:]) == 0
     assert l == len(TEST_IDS_GOLD)
+
+def test_count_corpus(tmp_path):
+    corpus = tmp_path / "corpus.txt"
+    corpus.write_text(TEST_SENTENCE + "\n" + TEST_SENTENCE.lower() + "\n")
+    counts = count_corpus([str(corpus)], transform=str.lower)
+    assert counts == {k: 2 * v for k, v in COUNTS.items()}
+
+    counts = count_corpus([str(corpus)], num_threads=1)
+    assert counts["Dan"] == 1
+    assert counts["dan"] == 1
+
+def test_vocab_from_corpus(tmp_path):
+    corpus = tmp_path / "corpus.txt"
+    corpus.write_text(TEST_SENTENCE + "\n")
+    words = WordVocab.from_corpus([str(corpus)], transform=str.lower)
+    vec = VocabVectorizer(words, transform=str.lower, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    sentence = ' '.join(vec.convert_to_pieces(TEST_SENTENCE.split()))
+    assert sentence == TEST_SENTENCE_GOLD
+    # The most frequent token gets the first id
+    assert words.lookup(",", str.lower) == 4
+
+    words = WordVocab.from_corpus([str(corpus)], transform=str.lower, max_size=1)
+    assert words.lookup(",", str.lower) == 4
+    assert words.lookup("dan", str.lower) == words.unk_id
+
+    words = WordVocab.from_corpus([str(corpus)], transform=str.lower, min_freq=1)
+    assert words.lookup(",", str.lower) == 4
+    assert words.lookup("dan", str.lower) == words.unk_id
+
+def test_native_transforms():
+    assert "lower" in native_transform_names()
+    lower = native_transform("lower")
+    assert lower("ÀNN Arbor") == "ànn arbor"
+    assert native_transform("casefold")("Straße") == "strasse"
+    assert native_transform("nfkc")("ﬁ①") == "fi1"
+    assert native_transform("nfc")("e\u0301") == "\u00e9"
+    assert native_transform("strip_accents")("Café") == "Cafe"
+    assert native_transform("remove_control")("a\u200bb\x00") == "ab"
+    assert native_transform("ascii_digits")("٣３") == "33"
+    with pytest.raises(Exception):
+        native_transform("no such transform")
+
+    words = WordVocab(COUNTS)
+    vec = VocabVectorizer(words, transform=lower, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    sentence = ' '.join(vec.convert_to_pieces(TEST_SENTENCE.split()))
+    assert sentence == TEST_SENTENCE_GOLD
+    assert words.lookup("MICHIGAN", lower) == words.lookup("michigan", str.lower)
+
+
+def test_memoized_transform():
+    calls = []
+    def lower(s):
+        calls.append(s)
+        return s.lower()
+    memoized = MemoizedTransform(lower, capacity=1000)
+    assert memoized.apply("DAN") == "dan"
+    words = WordVocab(COUNTS)
+    vec = VocabVectorizer(words, transform=memoized, emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    ids, _ = vec.convert_to_ids(TEST_SENTENCE.split())
+    num_calls = len(calls)
+    assert num_calls == len(set(calls))
+    assert vec.convert_to_ids(TEST_SENTENCE.split())[0] == ids
+    assert len(calls) == num_calls
+    stats = memoized.stats()
+    assert stats["misses"] == num_calls
+    assert stats["hits"] > 0
+    assert 0 < stats["hit_rate"] <= 1
+    assert words.lookup("MICHIGAN", memoized) == words.lookup("michigan", str.lower)
+    memoized.clear()
+    assert memoized.stats()["size"] == 0
+
+
+def test_transform_pipeline():
+    pipeline = TransformPipeline("nfkc+casefold")
+    assert pipeline.names == ["nfkc", "casefold"]
+    assert pipeline("ﬁ Straße") == "fi strasse"
+    assert TransformPipeline(["strip_accents", "lower"])("CAFÉ") == "cafe"
+    assert TransformPipeline().is_identity
+    with pytest.raises(Exception):
+        TransformPipeline("nfkc+no such transform")
+
+    words = WordVocab(COUNTS)
+    vec = VocabVectorizer(words, transform=TransformPipeline("lower"), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    sentence = ' '.join(vec.convert_to_pieces(TEST_SENTENCE.split()))
+    assert sentence == TEST_SENTENCE_GOLD
+    assert words.lookup("MİCHİGAN", TransformPipeline("nfkd+strip_accents+lower")) == words.lookup("michigan", str.lower)
+
+def test_pickle_word_vocab():
+    import pickle
+    words = WordVocab(VOCAB_LIST, extra_tokens=["<SEP>"])
+    vec = VocabVectorizer(words, transform=TransformPipeline("lower"), emit_begin_tok=["<GO>"], emit_end_tok=["<EOS>"])
+    copy = pickle.loads(pickle.dumps(vec))
+    assert copy.convert_to_ids(TEST_SENTENCE.split()) == vec.convert_to_ids(TEST_SENTENCE.split())
+    assert copy.piece_to_id("<SEP>") == vec.piece_to_id("<SEP>")
+    # Compiled once, into a directory shared by every pickle
+    assert os.path.isdir(words.shared_dir())
+    assert pickle.loads(pickle.dumps(words)).shared_dir() == words.shared_dir()
+
+def test_pickle_after_add_tokens(capfd):
+    import pickle
+    words = WordVocab(VOCAB_LIST)
+    dirs = []
+    for token in ["first", "second", "third"]:
+        words.add_tokens([token])
+        copy = pickle.loads(pickle.dumps(words))
+        assert copy.lookup(token, str.lower) == words.lookup(token, str.lower)
+        dirs.append(words.shared_dir())
+    # Only the current copy and the one before it are kept, compiled quietly
+    assert [os.path.isdir(d) for d in dirs] == [False, True, True]
+    assert "creating" not in capfd.readouterr().err
+
+
+def test_encode_column_pins_version(tmp_path):
+    first = str(tmp_path / "first.ph")
+    second = str(tmp_path / "second.ph")
+    WordVocab(["my", "name", "is", "dan"]).compile_vocab(first)
+    WordVocab(["dan", "is", "name", "my"]).compile_vocab(second)
+    words = ReloadableVocab(vocab_file=first)
+    calls = []
+
+    def reload_midway(s):
+        calls.append(s)
+        if len(calls) == 50:
+            words.reload(second)
+        return s.lower()
+
+    vec = VocabVectorizer(words, transform=reload_midway)
+    column = np.array(["My name is Dan"] * 40)
+    assert vec.encode_column(column).values.tolist() == [4, 5, 6, 7] * 40
+    assert words.version == 1
+    assert vec.encode_column(column).values.tolist() == [7, 6, 5, 4] * 40
@@ -6,9 +6,16 @@ import {
     VocabMapVectorizer,
     VocabVectorizer,
     WordVocab,
-    Vocab
+    Vocab,
+    ReloadableVocab,
+    SpecialTokenScanner,
+    countCorpus,
+    nativeTransformNames
 } from '../src';
+import { mkdtempSync, writeFileSync } from 'fs';
+import { tmpdir } from 'os';
 import { join } from 'path';
+import { Worker } from 'worker_threads';
 
 const testDir = join(__dirname, 'test_data');
 
@@ -114,7 +121,8 @@ describe('vecxx', () => {
                     emitEndToken: ['<EOS>']
                 });
                 const { ids, size } = vectorizer.convertToIds(TEST_SENTENCE.split(/\s+/));
-                expect(ids).toEqual(expectedIds);
+                expect(ids).toBeInstanceOf(Int32Array);
+                expect(Array.from(ids)).toEqual(expectedIds);
                 expect(size).toEqual(expectedIds.length);
             });
 
@@ -125,10 +133,62 @@ describe('vecxx', () => {
                     emitEndToken: ['<EOS>']
                 });
                 const { ids, size } = vectorizer.convertToIds(TEST_SENTENCE.split(/\s+/), 128);
-                expect(ids.slice(0, size)).toEqual(expectedIds);
+                expect(Array.from(ids.slice(0, size))).toEqual(expectedIds);
                 expect(ids.slice(size).reduce((sum, v) => sum + v, 0)).toEqual(0);
                 expect(size).toEqual(expectedIds.length);
             });
+
+            it('convertToIds, into an Int32Array', () => {
+                const vectorizer = new VocabVectorizer(vocab, {
+                    transform: toLower,
+                    emitBeginToken: ['<GO>'],
+                    emitEndToken: ['<EOS>']
+                });
+                const out = new Int32Array(64).fill(-1);
+                const { ids, size } = vectorizer.convertToIds(TEST_SENTENCE.split(/\s+/), 0, out);
+                expect(ids).toBe(out);
+                expect(size).toEqual(expectedIds.length);
+                expect(Array.from(out.slice(0, size))).toEqual(expectedIds);
+                expect(out.slice(size).every((v) => v === 0)).toBe(true);
+                expect(() => vectorizer.convertToIds(['dan'], 128, out)).toThrow();
+            });
+
+            it('convertToIdsStack', () => {
+                const vectorizer = new VocabVectorizer(vocab, {
+                    transform: toLower,
+                    emitBeginToken: ['<GO>'],
+                    emitEndToken: ['<EOS>']
+                });
+                const tokensList = [TEST_SENTENCE.split(/\s+/), ['Dan'], []];
+                const { ids, lengths } = vectorizer.convertToIdsStack(tokensList, 32);
+                expect(ids.length).toEqual(3 * 32);
+                expect(Array.from(lengths)).toEqual([expectedIds.length, 3, 2]);
+                tokensList.forEach((tokens, i) => {
+                    const row = vectorizer.convertToIds(tokens, 32);
+                    expect(ids.slice(i * 32, (i + 1) * 32)).toEqual(row.ids);
+                });
+                const out = new Int32Array(3 * 32);
+                expect(vectorizer.convertToIdsStack(tokensList, 0, out).ids).toBe(out);
+                expect(out).toEqual(ids);
+            });
+
+            it('encodes asynchronously', async () => {
+                const vectorizer = new VocabVectorizer(vocab, {
+                    transform: 'lower',
+                    emitBeginToken: ['<GO>'],
+                    emitEndToken: ['<EOS>']
+                });
+                const tokensList = [TEST_SENTENCE.split(/\s+/), ['Dan'], []];
+                const row = await vectorizer.convertToIdsAsync(tokensList[0]);
+                expect(Array.from(row.ids)).toEqual(expectedIds);
+                expect(row.size).toEqual(expectedIds.length);
+                const stack = await vectorizer.convertToIdsStackAsync(tokensList, 32);
+                expect(stack).toEqual(vectorizer.convertToIdsStack(tokensList, 32));
+                const texts = await vectorizer.encodeTextStackAsync([TEST_SENTENCE], 32);
+                expect(texts).toEqual(vectorizer.encodeTextStack([TEST_SENTENCE], 32));
+                const jsTransform = new VocabVectorizer(vocab, { transform: toLower });
+                expect(() => jsTransform.convertToIdsAsync(tokensList[0])).toThrow();
+            });
         });
 
         describe('VocabMapVectorizer', () => {
@@ -156,7 +216,7 @@ describe('vecxx', () => {
                 });
                 const tokenMaps = TEST_SENTENCE.split(/\s+/).map((text) => ({ text }));
                 const { ids, size } = vectorizer.convertToIds(tokenMaps);
-                expect(ids).toEqual(expectedIds);
+                expect(Array.from(ids)).toEqual(expectedIds);
                 expect(size).toEqual(expectedIds.length);
             });
 
@@ -168,10 +228,52 @@ describe('vecxx', () => {
                 });
                 const tokenMaps = TEST_SENTENCE.split(/\s+/).map((text) => ({ text }));
                 const { ids, size } = vectorizer.convertToIds(tokenMaps, 128);
-                expect(ids.slice(0, size)).toEqual(expectedIds);
+                expect(Array.from(ids.slice(0, size))).toEqual(expectedIds);
                 expect(ids.slice(size).reduce((sum, v) => sum + v, 0)).toEqual(0);
                 expect(size).toEqual(expectedIds.length);
             });
+
+            it('takes columns', () => {
+                const words = TEST_SENTENCE.split(/\s+/);
+                const tags = words.map((_, i) => (i % 2 ? 'X' : ''));
+                const tokenMaps = words.map((text, i) => ({ text, tag: tags[i] }));
+                const vectorizer = new VocabMapVectorizer(vocab, {
+                    transform: toLower,
+                    emitBeginToken: ['<GO>'],
+                    emitEndToken: ['<EOS>']
+                });
+                expect(Array.from(vectorizer.convertToIdsColumns([words]).ids)).toEqual(expectedIds);
+                const tagged = new VocabMapVectorizer(vocab, { transform: toLower, fields: ['text', 'tag'] });
+                expect(tagged.convertToPiecesColumns([words, tags])).toEqual(tagged.convertToPieces(tokenMaps));
+                expect(tagged.convertToIdsColumns([words, tags], 64)).toEqual(tagged.convertToIds(tokenMaps, 64));
+                expect(() => tagged.convertToIdsColumns([words, tags.slice(1)])).toThrow();
+            });
+
+            it('stacks a batch', () => {
+                const batch = [TEST_SENTENCE, 'My name is Dan .', 'in Washtenaw County'].map((sentence) => {
+                    const words = sentence.split(/\s+/);
+                    const tags = words.map((_, i) => (i % 2 ? 'X' : ''));
+                    return { tokenMaps: words.map((text, i) => ({ text, tag: tags[i] })), columns: [words, tags] };
+                });
+                const vectorizer = new VocabMapVectorizer(vocab, { transform: 'lower', fields: ['text', 'tag'] });
+                const stacked = vectorizer.convertToIdsStack(
+                    batch.map((b) => b.tokenMaps),
+                    16
+                );
+                batch.forEach((b, i) => {
+                    const { ids, size } = vectorizer.convertToIds(b.tokenMaps, 16);
+                    expect(stacked.lengths[i]).toEqual(size);
+                    expect(stacked.ids.subarray(i * 16, (i + 1) * 16)).toEqual(ids);
+                });
+                const out = new Int32Array(batch.length * 16);
+                const columns = vectorizer.convertToIdsColumnsStack(
+                    batch.map((b) => b.columns),
+                    0,
+                    out
+                );
+                expect(columns.ids).toBe(out);
+                expect(columns).toEqual(stacked);
+            });
         });
     });
 
@@ -193,4 +295,196 @@ describe('vecxx', () => {
             expect(sentence.join(' ')).toEqual(TEST_SENTENCE_GOLD_WORD_VOCAB);
         });
     });
+
+    describe('native transforms', () => {
+        it('transforms by name', () => {
+            expect(nativeTransformNames).toContain('casefold');
+            const vocab = new WordVocab(COUNTS);
+            const vectorizer = new VocabVectorizer(vocab, {
+                transform: 'lower',
+                emitBeginToken: ['<GO>'],
+                emitEndToken: ['<EOS>']
+            });
+            expect(vectorizer.convertToPieces(TEST_SENTENCE.split(/\s+/)).join(' ')).toEqual(
+                TEST_SENTENCE_GOLD_WORD_VOCAB
+            );
+            expect(vocab.lookup('MICHIGAN', 'casefold')).toEqual(vocab.lookup('michigan'));
+        });
+
+        it('rejects unknown transform names', () => {
+            const vocab = new WordVocab(COUNTS);
+            const typo = 'lowr' as TokenTransform;
+            expect(() => new VocabVectorizer(vocab, { transform: typo })).toThrow(TypeError);
+            expect(() => new VocabVectorizer(vocab, { transform: 'lower+' })).toThrow(TypeError);
+            expect(() => new VocabMapVectorizer(vocab, { transform: typo })).toThrow(TypeError);
+            expect(() => vocab.lookup('dan', typo)).toThrow(TypeError);
+        });
+
+        it('memoizes a JS transform', () => {
+            const vocab = new WordVocab(COUNTS);
+            let calls = 0;
+            const vectorizer = new VocabVectorizer(vocab, {
+                transform: (s: string) => {
+                    calls += 1;
+                    return s.toLowerCase();
+                },
+                memoize: 1000
+            });
+            const tokens = TEST_SENTENCE.split(/\s+/);
+            const ids = vectorizer.convertToIds(tokens);
+            const callsOnce = calls;
+            expect(vectorizer.convertToIds(tokens)).toEqual(ids);
+            expect(calls).toEqual(callsOnce);
+            const stats = vectorizer.transformCacheStats();
+            expect(stats?.misses).toEqual(callsOnce);
+            expect(stats?.hitRate).toBeGreaterThan(0.5);
+            expect(new VocabVectorizer(vocab).transformCacheStats()).toBeNull();
+        });
+
+        it('chains transforms', () => {
+            const vocab = new WordVocab(COUNTS);
+            expect(vocab.lookup('MİCHİGAN', 'nfkd+strip_accents+lower')).toEqual(vocab.lookup('michigan'));
+        });
+    });
+
+    describe('ReloadableVocab', () => {
+        it('reloads while in use', async () => {
+            const vocab = new ReloadableVocab(join(testDir, 'vocab.30k'), join(testDir, 'codes.30k'));
+            const vectorizer = new VocabVectorizer(vocab, {
+                transform: toLower,
+                emitBeginToken: ['<GO>'],
+                emitEndToken: ['<EOS>']
+            });
+            const reloaded = vocab.reload(join(testDir, 'vocab.30k'), join(testDir, 'codes.30k'));
+            expect(Array.from(vectorizer.convertToIds(TEST_SENTENCE.split(/\s+/)).ids)).toEqual(TEST_IDS_GOLD);
+            expect(await reloaded).toEqual(1);
+            expect(vocab.version).toEqual(1);
+            expect(Array.from(vectorizer.convertToIds(TEST_SENTENCE.split(/\s+/)).ids)).toEqual(TEST_IDS_GOLD);
+            await expect(vocab.reload('i dont exist', 'i dont exist')).rejects.toThrow();
+            expect(vocab.version).toEqual(1);
+        });
+
+        it('throws on a missing file', () => {
+            expect(() => new ReloadableVocab('i dont exist')).toThrow();
+            expect(() => new ReloadableVocab(join(testDir, 'vocab.30k'), 'i dont exist')).toThrow();
+        });
+    });
+
+    describe('decode, compile and share', () => {
+        it('decodes and counts pieces', () => {
+            const vocab = new BPEVocab(join(testDir, 'vocab.30k'), join(testDir, 'codes.30k'));
+            const vectorizer = new VocabVectorizer(vocab, { transform: 'lower' });
+            expect(vectorizer.decode(Int32Array.from(TEST_IDS_GOLD))).toEqual(TEST_SENTENCE.toLowerCase());
+            expect(vectorizer.decode(TEST_IDS_GOLD)).toEqual(TEST_SENTENCE.toLowerCase());
+            expect(vocab.rlookup(2566)).toEqual('dan');
+            const counts = vectorizer.countPieces(TEST_SENTENCE.split(/\s+/));
+            expect(counts[',']).toEqual(2);
+            expect(counts['ar@@']).toEqual(1);
+        });
+
+        it('opens a compiled vocab from a handle', () => {
+            const vocab = new BPEVocab(join(testDir, 'vocab.30k'), join(testDir, 'codes.30k'));
+            const compiled = join(mkdtempSync(join(tmpdir(), 'vecxx-')), 'compiled');
+            vocab.compileVocab(compiled);
+            const handle = new BPEVocab(compiled, compiled).handle();
+            expect(handle.dir).toEqual(compiled);
+            expect(handle.bpe).toBe(true);
+            const shared = Vocab.fromHandle(handle);
+            const vectorizer = new VocabVectorizer(shared, { transform: 'lower' });
+            expect(Array.from(vectorizer.encodeText(`<GO>${TEST_SENTENCE}<EOS>`).ids)).toEqual(TEST_IDS_GOLD);
+            // The temporary directory for an in-memory vocab goes with it, so keep it alive
+            const words = new WordVocab(COUNTS);
+            const sharedWords = Vocab.fromHandle(words.handle());
+            expect(sharedWords.lookup('michigan')).toEqual(words.lookup('michigan'));
+        });
+
+        it('shares a vocab with a worker thread', async () => {
+            const vocab = new BPEVocab(join(testDir, 'vocab.30k'), join(testDir, 'codes.30k'));
+            const addon = join(__dirname, '..', 'build', 'Release', 'vecxx.node');
+            const worker = new Worker(
+                `const { parentPort, workerData } = require('worker_threads');
+                const { Vocab, VocabVectorizer } = require(workerData.addon);
+                const vocab = new Vocab('handle', workerData.handle);
+                const vec = new VocabVectorizer(vocab, 'lower', ['<GO>'], ['<EOS>']);
+                parentPort.postMessage(Array.from(vec.convertToIds(workerData.tokens, 0).ids));`,
+                { eval: true, workerData: { addon, handle: vocab.handle(), tokens: TEST_SENTENCE.split(/\s+/) } }
+            );
+            const ids = await new Promise((resolve, reject) => {
+                worker.once('message', resolve);
+                worker.once('error', reject);
+            });
+            expect(ids).toEqual(TEST_IDS_GOLD);
+        });
+    });
+
+    describe('SpecialTokenScanner', () => {
+        it('test scan', () => {
+            const scanner = new SpecialTokenScanner(['<GO>', '<EOS>']);
+            expect(scanner.scan('a<GO>b')).toEqual([
+                { text: 'a', special: false },
+                { text: '<GO>', special: true },
+                { text: 'b', special: false }
+            ]);
+            expect(scanner.tokenize(` ${TEST_SENTENCE}<EOS>`)).toEqual([...TEST_SENTENCE.split(/\s+/), '<EOS>']);
+        });
+
+        it('rejects anything but a vocab or a token list', () => {
+            expect(() => new SpecialTokenScanner('<GO>' as unknown as Tokens)).toThrow(TypeError);
+            expect(() => new SpecialTokenScanner({} as Vocab)).toThrow(TypeError);
+        });
+    });
+
+    describe('encodeText', () => {
+        it('encodes raw text', () => {
+            const vocab = new BPEVocab(join(testDir, 'vocab.30k'), join(testDir, 'codes.30k'));
+            const vectorizer = new VocabVectorizer(vocab, { transform: toLower });
+            expect(Array.from(vectorizer.encodeText(`<GO>${TEST_SENTENCE}<EOS>`).ids)).toEqual(TEST_IDS_GOLD);
+            const punctuated = new VocabVectorizer(vocab, {
+                transform: toLower,
+                emitBeginToken: ['<GO>'],
+                emitEndToken: ['<EOS>'],
+                pretokenizer: { punctuation: '.,' }
+            });
+            const text = 'My name is Dan. I am from Ann Arbor, Michigan, in Washtenaw County';
+            expect(Array.from(punctuated.encodeText(text).ids)).toEqual(TEST_IDS_GOLD);
+            const { ids, lengths } = punctuated.encodeTextStack([text, 'My name is Dan.'], 32);
+            expect(Array.from(lengths)).toEqual([TEST_IDS_GOLD.length, 7]);
+            expect(Array.from(ids.slice(0, TEST_IDS_GOLD.length))).toEqual(TEST_IDS_GOLD);
+            expect(Array.from(ids.slice(32, 39))).toEqual(TEST_IDS_GOLD.slice(0, 6).concat([2]));
+        });
+    });
+
+    describe('WordVocab w/corpus', () => {
+        let corpus: string;
+        beforeEach(() => {
+            corpus = join(mkdtempSync(join(tmpdir(), 'vecxx-')), 'corpus.txt');
+            writeFileSync(corpus, `${TEST_SENTENCE}\n`);
+        });
+
+        it('test count corpus', () => {
+            expect(countCorpus([corpus], { transform: toLower })).toEqual(COUNTS);
+            expect(countCorpus([corpus], { numThreads: 2 })['Dan']).toEqual(1);
+        });
+
+        it('test vocab from corpus', () => {
+            const vocab = WordVocab.fromCorpus([corpus], { transform: toLower });
+            const vectorizer = new VocabVectorizer(vocab, {
+                transform: toLower,
+                emitBeginToken: ['<GO>'],
+                emitEndToken: ['<EOS>']
+            });
+            expect(vectorizer.convertToPieces(TEST_SENTENCE.split(/\s+/)).join(' ')).toEqual(
+                TEST_SENTENCE_GOLD_WORD_VOCAB
+            );
+            expect(vocab.lookup(',')).toEqual(4);
+            const top = WordVocab.fromCorpus([corpus], { transform: toLower, maxSize: 1 });
+            expect(top.lookup('dan')).toEqual(3);
+        });
+
+        it('throws on a missing file', () => {
+            const missing = join(corpus, '..', 'missing.txt');
+            expect(() => countCorpus([missing])).toThrow();
+            expect(() => WordVocab.fromCorpus([corpus, missing])).toThrow();
+        });
+    });
 });
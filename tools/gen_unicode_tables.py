@@ -0,0 +1,152 @@
+#!/usr/bin/env python
+"""Generate include/vecxx/unicode_tables.h from Python's unicodedata.
+
+The tables back the native transforms in include/vecxx/unicode.h, and
+follow the Unicode version of the Python used to run this script:
+
+    python tools/gen_unicode_tables.py > include/vecxx/unicode_tables.h
+"""
+import sys
+import unicodedata
+
+MAX_CP = 0x110000
+HANGUL_S_BASE = 0xAC00
+HANGUL_S_COUNT = 11172
+
+
+def is_hangul_syllable(cp):
+    return HANGUL_S_BASE <= cp < HANGUL_S_BASE + HANGUL_S_COUNT
+
+
+def chars():
+    for cp in range(MAX_CP):
+        if 0xD800 <= cp < 0xE000:
+            continue
+        yield cp, chr(cp)
+
+
+def emit_array(name, ctype, values, out):
+    out.write('static const %s %s[] = {\n' % (ctype, name))
+    for i in range(0, len(values), 12):
+        out.write('    ' + ', '.join(str(v) for v in values[i:i + 12]) + ',\n')
+    if not values:
+        out.write('    0\n')
+    out.write('};\n')
+
+
+def emit_map(name, mapping, doc, out):
+    """A sorted key array, and (offset << 8 | length) into a shared pool"""
+    keys = sorted(mapping)
+    vals = []
+    pool = []
+    for k in keys:
+        seq = [ord(c) for c in mapping[k]]
+        vals.append((len(pool) << 8) | len(seq))
+        pool.extend(seq)
+    out.write('\n// %s\n' % doc)
+    out.write('static const size_t %s_SIZE = %d;\n' % (name, len(keys)))
+    emit_array(name + '_KEYS', 'uint32_t', keys, out)
+    emit_array(name + '_VALS', 'uint32_t', vals, out)
+    emit_array(name + '_POOL', 'uint32_t', pool, out)
+
+
+def ranges(pred):
+    """Runs of consecutive code points with the same non-None value"""
+    runs = []
+    start = None
+    cur = None
+    for cp in range(MAX_CP + 1):
+        v = pred(cp) if cp < MAX_CP and not (0xD800 <= cp < 0xE000) else None
+        if v != cur:
+            if cur is not None:
+                runs.append((start, cp - 1, cur))
+            start, cur = cp, v
+    return runs
+
+
+def emit_ranges(name, runs, doc, out, with_value=True):
+    out.write('\n// %s\n' % doc)
+    out.write('static const size_t %s_SIZE = %d;\n' % (name, len(runs)))
+    flat = []
+    for lo, hi, v in runs:
+        flat.extend([lo, hi, v] if with_value else [lo, hi])
+    emit_array(name, 'uint32_t', flat, out)
+
+
+def main(out):
+    lower = {}
+    casefold = {}
+    nfd = {}
+    nfkd = {}
+    for cp, c in chars():
+        if c.lower() != c:
+            lower[cp] = c.lower()
+        if c.casefold() != c:
+            casefold[cp] = c.casefold()
+        if is_hangul_syllable(cp):
+            continue
+        d = unicodedata.normalize('NFD', c)
+        kd = unicodedata.normalize('NFKD', c)
+        if d != c:
+            nfd[cp] = d
+        if kd != d:
+            nfkd[cp] = kd
+
+    # Primary composites: a canonical pair that NFC puts back together
+    compose = []
+    for cp, c in chars():
+        if is_hangul_syllable(cp):
+            continue
+        decomp = unicodedata.decomposition(c)
+        if not decomp or decomp.startswith('<'):
+            continue
+        parts = [int(p, 16) for p in decomp.split()]
+        if len(parts) != 2:
+            continue
+        if unicodedata.normalize('NFC', chr(parts[0]) + chr(parts[1])) == c:
+            compose.append(((parts[0] << 21) | parts[1], cp))
+    compose.sort()
+
+    def ccc(cp):
+        v = unicodedata.combining(chr(cp))
+        return v if v else None
+
+    def category(cats):
+        return lambda cp: 1 if unicodedata.category(chr(cp)) in cats else None
+
+    def control(cp):
+        if cp in (0x09, 0x0A, 0x0D):
+            return None
+        return 1 if unicodedata.category(chr(cp)) in ('Cc', 'Cf') else None
+
+    def digit(cp):
+        c = chr(cp)
+        if unicodedata.category(c) != 'Nd':
+            return None
+        return cp - unicodedata.decimal(c)
+
+    out.write('#ifndef __VECXX_UNICODE_TABLES_H__\n#define __VECXX_UNICODE_TABLES_H__\n\n')
+    out.write('/*\n * Generated by tools/gen_unicode_tables.py from the Unicode %s data\n'
+              ' * in Python %d.%d unicodedata.  Do not edit\n */\n'
+              % (unicodedata.unidata_version, sys.version_info[0], sys.version_info[1]))
+    out.write('#include <cstdint>\n#include <cstddef>\n\n')
+    out.write('#define VECXX_UNICODE_VERSION "%s"\n' % unicodedata.unidata_version)
+    emit_map('UNI_LOWER', lower, 'Full lowercase mappings (str.lower), without final sigma', out)
+    emit_map('UNI_CASEFOLD', casefold, 'Full case folding (str.casefold)', out)
+    emit_map('UNI_NFD', nfd, 'Full canonical decompositions, Hangul syllables are algorithmic', out)
+    emit_map('UNI_NFKD', nfkd, 'Full compatibility decompositions, where they differ from UNI_NFD', out)
+
+    out.write('\n// Primary composites, keyed by (first << 21 | second)\n')
+    out.write('static const size_t UNI_COMPOSE_SIZE = %d;\n' % len(compose))
+    emit_array('UNI_COMPOSE_KEYS', 'uint64_t', [k for k, _ in compose], out)
+    emit_array('UNI_COMPOSE_VALS', 'uint32_t', [v for _, v in compose], out)
+
+    emit_ranges('UNI_CCC', ranges(ccc), 'Canonical combining classes, (first, last, class) for non-zero classes', out)
+    emit_ranges('UNI_MN', ranges(category(('Mn',))), 'Nonspacing marks (Mn), (first, last)', out, False)
+    emit_ranges('UNI_CONTROL', ranges(control), 'Control and format characters (Cc, Cf) except tab, LF and CR, (first, last)', out, False)
+    emit_ranges('UNI_DIGIT', ranges(digit), 'Decimal digits (Nd), (first, last, code point - digit value)', out)
+    out.write('\n#endif\n')
+
+
+if __name__ == '__main__':
+    main(sys.stdout)